@@ -122,6 +122,24 @@ uint8_t array_get(const array_pt array, size_t index, void * element){
     return 0;
 }
 
+/*
+    @brief Función que retorna una referencia al elemento del índice indicado (lectura o modificación en sitio).
+    @note: La referencia deja de ser válida si el array cambia de capacidad.
+
+    @param const array_pt array: Referencia al array.
+    @param size_t index: Índice del elemento.
+
+    @retval void *: Referencia al elemento (NULL si el array o el índice no son válidos).
+*/
+void * array_at(const array_pt array, size_t index){
+    // Comprobación de array e índice válidos:
+    if ((array == NULL) || (index >= array->size)){
+        return NULL;
+    }
+
+    return (uint8_t *)array->arr + (index * array->element_size);
+}
+
 /*
     @brief Función para eliminar un elemento del array, en la posición dada.
 
@@ -159,6 +177,135 @@ uint8_t array_del(array_pt array, size_t index){
     return 0;
 }
 
+/*
+    @brief Función para eliminar, en una sola pasada, todos los elementos que cumplen un predicado, conservando el orden del resto.
+    @note: Compactación con un único cursor de escritura; los tramos de elementos conservados se desplazan con un solo memmove.
+
+    @param array_pt array: Referencia al array.
+    @param bool (*pred_fn)(const void *, void *): Referencia al predicado (elemento, contexto); true indica eliminar.
+    @param void * ctx: Referencia al contexto de usuario que se pasa al predicado (puede ser nulo).
+
+    @retval size_t: Número de elementos eliminados.
+*/
+size_t array_remove_if(array_pt array, bool (*pred_fn)(const void *, void *), void * ctx){
+    // Comprobación de array y predicado válidos:
+    if ((array == NULL) || (pred_fn == NULL)){
+        return 0;
+    }
+
+    // Recorrido del array desplazando cada tramo conservado hasta el cursor de escritura:
+    uint8_t * base = (uint8_t *)array->arr;
+    size_t write_index = 0;
+    size_t run_start = 0;
+    for (size_t i = 0; i < array->size; i++){
+        if (pred_fn(base + (i * array->element_size), ctx)){
+            if ((i > run_start) && (write_index != run_start)){
+                memmove(base + (write_index * array->element_size), base + (run_start * array->element_size), (i - run_start) * array->element_size);
+            }
+            write_index += i - run_start;
+            run_start = i + 1;
+        }
+    }
+
+    // Desplazamiento del último tramo conservado:
+    if ((array->size > run_start) && (write_index != run_start)){
+        memmove(base + (write_index * array->element_size), base + (run_start * array->element_size), (array->size - run_start) * array->element_size);
+    }
+    write_index += array->size - run_start;
+
+    // Actualización del tamaño del array:
+    size_t removed = array->size - write_index;
+    array->size = write_index;
+
+    return removed;
+}
+
+/*
+    @brief Función para eliminar, en una sola pasada, todos los elementos que cumplen un predicado, sin conservar el orden.
+    @note: Cada elemento eliminado se sustituye por el último elemento del array (una copia por eliminación).
+
+    @param array_pt array: Referencia al array.
+    @param bool (*pred_fn)(const void *, void *): Referencia al predicado (elemento, contexto); true indica eliminar.
+    @param void * ctx: Referencia al contexto de usuario que se pasa al predicado (puede ser nulo).
+
+    @retval size_t: Número de elementos eliminados.
+*/
+size_t array_remove_if_unordered(array_pt array, bool (*pred_fn)(const void *, void *), void * ctx){
+    // Comprobación de array y predicado válidos:
+    if ((array == NULL) || (pred_fn == NULL)){
+        return 0;
+    }
+
+    // Recorrido del array sustituyendo los elementos eliminados por el último:
+    uint8_t * base = (uint8_t *)array->arr;
+    size_t original_size = array->size;
+    size_t i = 0;
+    while (i < array->size){
+        if (pred_fn(base + (i * array->element_size), ctx)){
+            array->size--;
+            if (i < array->size){
+                memcpy(base + (i * array->element_size), base + (array->size * array->element_size), array->element_size);
+            }
+        } else {
+            i++;
+        }
+    }
+
+    return original_size - array->size;
+}
+
+/*
+    @brief Función para reservar capacidad para al menos capacity elementos, sin modificar el tamaño del array.
+    @note: La capacidad se redondea al múltiplo superior de ALLOC_BLOCK_SIZE. Permite crecimientos geométricos en lugar de por bloques.
+
+    @param array_pt array: Referencia al array.
+    @param size_t capacity: Capacidad mínima (número de elementos).
+
+    @retval uint8_t:
+            -> 0: No han ocurrido errores.
+            -> 1: Referencia nula al array dado.
+            -> 2: Error al ajustar el tamaño del array.
+*/
+uint8_t array_reserve(array_pt array, size_t capacity){
+    // Comprobación de array válido:
+    if (array == NULL){
+        return 1;
+    }
+
+    // Comprobación de la capacidad actual:
+    if (capacity <= array->capacity){
+        return 0;
+    }
+
+    // Reajuste del tamaño del array (en bloques completos):
+    size_t new_capacity = ((capacity + ALLOC_BLOCK_SIZE - 1) / ALLOC_BLOCK_SIZE) * ALLOC_BLOCK_SIZE;
+    void * temp_arr = realloc(array->arr, new_capacity * array->element_size);
+    if (temp_arr == NULL){
+        return 2;
+    }
+
+    array->arr = temp_arr;
+    array->capacity = new_capacity;
+
+    return 0;
+}
+
+/*
+    @brief Función para eliminar todos los elementos del array, conservando la capacidad reservada.
+
+    @param array_pt array: Referencia al array.
+
+    @retval None.
+*/
+void array_clear(array_pt array){
+    // Comprobación de array válido:
+    if (array == NULL){
+        return;
+    }
+
+    array->size = 0;
+}
+
 /*
     @brief Función que retorna el tamaño del array.
 
@@ -7,6 +7,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include <stdbool.h>
 /* ---------------------------------------------------------------- */
 
 
@@ -42,7 +43,12 @@ array_pt array_init(size_t element_size);
 void array_deinit(array_pt array);
 uint8_t array_set(array_pt array, const void * element, size_t index);
 uint8_t array_get(const array_pt array, size_t index, void * element);
+void * array_at(const array_pt array, size_t index);
 uint8_t array_del(array_pt array, size_t index);
+size_t array_remove_if(array_pt array, bool (*pred_fn)(const void *, void *), void * ctx);
+size_t array_remove_if_unordered(array_pt array, bool (*pred_fn)(const void *, void *), void * ctx);
+uint8_t array_reserve(array_pt array, size_t capacity);
+void array_clear(array_pt array);
 size_t array_size(const array_pt array);
 size_t array_element_size(const array_pt array);
 size_t array_capacity(const array_pt array);
@@ -4,22 +4,31 @@
 # Variables de entorno             #
 # -------------------------------- #
 CC=gcc
-CFLAGS_TEST="-g -Wall -O2"
-CFLAGS_LIB="-Wall -O2 -fPIC -shared"
+CFLAGS_TEST="-g -Wall -O2 -pthread"
+CFLAGS_LIB="-Wall -O2 -fPIC -shared -pthread"
 
-SRC_ARRAY=array.c
-SRC_TEST=test_array.c
+# Uso anterior sin <tipo> (./build.sh test|lib|clean): equivale al array dinámico
+if [ "$1" == "test" ] || [ "$1" == "lib" ] || [ "$1" == "clean" ]; then
+    set -- array "$1"
+fi
+
+SRC_ARRAY=$1.c
+SRC_TEST=test_$1.c
 
-TEST_PROG=test_array.elf
-LIB_PROG=array.so
+TEST_PROG=test_$1.elf
+LIB_PROG=$1.so
+
+if [ "$1" == "slotmap" ] || [ "$1" == "gapbuf" ]; then
+    SRC_ARRAY="$SRC_ARRAY array.c"
+fi
 # -------------------------------- #
 
 
 # Lógica de uso                    #
 # -------------------------------- #
-if [ "$1" == "test" ]; then
+if [ "$2" == "test" ]; then
     echo
-    echo "[BUILD-ARRAY-TEST]: Compilando programa de prueba de array..."
+    echo "[BUILD-ARRAY-TEST]: Compilando programa de prueba de $1..."
     if $CC $CFLAGS_TEST $SRC_TEST $SRC_ARRAY -o $TEST_PROG; then
         echo "[BUILD-ARRAY-TEST]: Compilación completada."
         echo "[BUILD-ARRAY-TEST]: Ejecutando programa de prueba..."
@@ -32,9 +41,9 @@ if [ "$1" == "test" ]; then
     fi
     echo
 
-elif [ "$1" == "lib" ]; then
+elif [ "$2" == "lib" ]; then
     echo
-    echo "[BUILD-ARRAY-LIB]: Compilando la librería de array..."
+    echo "[BUILD-ARRAY-LIB]: Compilando la librería de $1..."
     if $CC $CFLAGS_LIB $SRC_ARRAY -o $LIB_PROG; then
         mv $LIB_PROG ./lib
         echo "[BUILD-ARRAY-LIB]: Librearía compilada."
@@ -43,7 +52,7 @@ elif [ "$1" == "lib" ]; then
     fi
     echo
 
-elif [ "$1" == "clean" ]; then
+elif [ "$2" == "clean" ]; then
     echo
     echo "[BUILD-ARRAY-CLEAN]: Limpiando espacio de trabajo..."
     rm -f ./$TEST_PROG ./lib/$LIB_PROG
@@ -54,9 +63,16 @@ else
     echo
     echo "[BUILD-ARRAY][ERR]: Uso incorrecto u opciones inválidas."
     echo -e "\n\t[Uso]:"
-    echo -e "\t\t-> ./build.sh test: \tCompila y ejecuta el programa de test (.elf)"
-    echo -e "\t\t-> ./build.sh lib: \tCompila y genera la librería compartida (.so) bajo la carpeta lib/"
-    echo -e "\t\t-> ./build.sh clean: \tLimpia el espacio de trabajo eliminando archivos generados"
+    echo -e "\t\t-> ./build.sh <tipo> test: \tCompila y ejecuta el programa de test (.elf)"
+    echo -e "\t\t-> ./build.sh <tipo> lib: \tCompila y genera la librería compartida (.so) bajo la carpeta lib/"
+    echo -e "\t\t-> ./build.sh <tipo> clean: \tLimpia el espacio de trabajo eliminando archivos generados"
+    echo -e "\t\t-> ./build.sh test|lib|clean: \tEquivale a ./build.sh array test|lib|clean"
+    echo -e "\n\n\t<tipo>:"
+    echo -e "\t\tarray: \tEjecuta el script para el array dinámico"
+    echo -e "\t\tseqarray: \tEjecuta el script para el array con lecturas optimistas (seqlock)"
+    echo -e "\t\tcvector: \tEjecuta el script para el vector concurrente de solo inserción al final"
+    echo -e "\t\tslotmap: \tEjecuta el script para el slot map con manejadores generacionales"
+    echo -e "\t\tgapbuf: \tEjecuta el script para el gap buffer (edición en torno a un cursor)"
     echo
     exit 1
 fi
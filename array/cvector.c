@@ -0,0 +1,304 @@
+#include "cvector.h"
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static inline size_t _cvector_locate(size_t index, size_t * out_offset);
+static inline size_t _cvector_flags_size(size_t segment);
+static uint8_t * _cvector_segment(cvector_pt vector, size_t segment);
+static const uint8_t * _cvector_published(const cvector_pt vector, size_t index);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar un vector concurrente de solo inserción al final.
+    @note: Los elementos se guardan en segmentos de tamaño creciente (el segmento k tiene ALLOC_BLOCK_SIZE << k posiciones)
+           que nunca se mueven: las referencias a los elementos son estables y no hay realloc.
+
+    @param size_t element_size: Tamaño del elemento básico del vector en bytes.
+
+    @retval cvector_pt: Puntero al vector creado.
+*/
+cvector_pt cvector_init(size_t element_size){
+    // Comprobación de los límites del tamaño del elemento básico del vector:
+    if ((element_size < MIN_ELEMENT_SIZE) || (element_size > MAX_ELEMENT_SIZE)){
+        return NULL;
+    }
+
+    // Reserva memoria para la estructura (alineada a línea de caché):
+    cvector_pt vector = (cvector_pt)aligned_alloc(CVECTOR_CACHE_LINE, sizeof(cvector_t));
+    if (vector == NULL){
+        return NULL;
+    }
+
+    // Inicio de los miembros de la estructura (los segmentos se crean bajo demanda):
+    atomic_init(&vector->reserved, 0);
+    for (size_t i = 0; i < CVECTOR_MAX_SEGMENTS; i++){
+        atomic_init(&vector->segments[i], NULL);
+    }
+    vector->element_size = element_size;
+
+    return vector;
+}
+
+/*
+    @brief Función para destruir y liberar un vector y sus segmentos.
+    @note: Ningún hilo debe estar usando el vector; las referencias obtenidas con cvector_at dejan de ser válidas.
+
+    @param cvector_pt * vector: Referencia a la referencia del vector.
+
+    @retval None.
+*/
+void cvector_deinit(cvector_pt * vector){
+    // Comprobación de que el vector no sea nulo:
+    if ((vector == NULL) || (*vector == NULL)){
+        return;
+    }
+
+    // Liberación de los segmentos creados:
+    for (size_t i = 0; i < CVECTOR_MAX_SEGMENTS; i++){
+        free(atomic_load_explicit(&(*vector)->segments[i], memory_order_relaxed));
+    }
+
+    free(*vector);
+    *vector = NULL;
+}
+
+/*
+    @brief Función para insertar un elemento al final del vector desde cualquier hilo.
+    @note: La posición se reserva con un único fetch_add; el elemento se copia y después se publica (release), de modo que
+           los lectores solo ven elementos completos.
+    @note: Si falla la creación del segmento, la posición reservada queda sin publicar (cvector_get retorna 3 para ella).
+
+    @param cvector_pt vector: Referencia al vector.
+    @param const void * element: Referencia al elemento a insertar.
+
+    @retval size_t: Índice del elemento insertado (CVECTOR_INVALID_INDEX si el vector/elemento no es válido o no hay memoria).
+*/
+size_t cvector_push_back(cvector_pt vector, const void * element){
+    // Comprobación de vector y elemento válido:
+    if ((vector == NULL) || (element == NULL)){
+        return CVECTOR_INVALID_INDEX;
+    }
+
+    // Reserva de la posición y localización de su segmento:
+    size_t index = atomic_fetch_add_explicit(&vector->reserved, 1, memory_order_relaxed);
+    size_t offset;
+    size_t segment = _cvector_locate(index, &offset);
+    if (segment >= CVECTOR_MAX_SEGMENTS){
+        return CVECTOR_INVALID_INDEX;
+    }
+
+    uint8_t * base = _cvector_segment(vector, segment);
+    if (base == NULL){
+        return CVECTOR_INVALID_INDEX;
+    }
+
+    // Copia del elemento y publicación de la posición:
+    memcpy(base + _cvector_flags_size(segment) + offset * vector->element_size, element, vector->element_size);
+    atomic_store_explicit((atomic_uchar *)base + offset, 1, memory_order_release);
+
+    return index;
+}
+
+/*
+    @brief Función para obtener un elemento del vector, del índice indicado, en la variable indicada.
+
+    @param const cvector_pt vector: Referencia al vector.
+    @param size_t index: Índice del elemento a obtener.
+    @param void * element: Referencia a la variable donde se copiará el elemento.
+
+    @retval uint8_t:
+            -> 0: No han ocurrido errores.
+            -> 1: El vector/elemento es nulo.
+            -> 2: El índice no es válido (no se ha reservado).
+            -> 3: La posición está reservada pero su elemento aún no se ha publicado.
+*/
+uint8_t cvector_get(const cvector_pt vector, size_t index, void * element){
+    // Comprobación de vector y elemento válido:
+    if ((vector == NULL) || (element == NULL)){
+        return 1;
+    }
+
+    // Comprobación del índice:
+    if (index >= atomic_load_explicit(&vector->reserved, memory_order_relaxed)){
+        return 2;
+    }
+
+    // Copia del elemento si ya está publicado:
+    const uint8_t * data = _cvector_published(vector, index);
+    if (data == NULL){
+        return 3;
+    }
+    memcpy(element, data, vector->element_size);
+
+    return 0;
+}
+
+/*
+    @brief Función para obtener una referencia estable a un elemento publicado.
+    @note: La referencia es válida hasta cvector_deinit (los elementos nunca se mueven ni se modifican).
+
+    @param const cvector_pt vector: Referencia al vector.
+    @param size_t index: Índice del elemento.
+
+    @retval const void *: Referencia al elemento (nula si el vector no es válido o el elemento no se ha publicado).
+*/
+const void * cvector_at(const cvector_pt vector, size_t index){
+    // Comprobación de vector e índice válidos:
+    if ((vector == NULL) || (index >= atomic_load_explicit(&vector->reserved, memory_order_relaxed))){
+        return NULL;
+    }
+
+    return _cvector_published(vector, index);
+}
+
+/*
+    @brief Función que retorna el final del tramo de elementos publicados consecutivos que empieza en la posición dada.
+    @note: Útil para consumir el vector en orden: todos los índices de [from, retorno) se pueden leer.
+
+    @param const cvector_pt vector: Referencia al vector.
+    @param size_t from: Índice de inicio del tramo.
+
+    @retval size_t: Primer índice no publicado a partir de from (from si el vector no es válido).
+*/
+size_t cvector_published_prefix(const cvector_pt vector, size_t from){
+    // Comprobación de vector válido:
+    if (vector == NULL){
+        return from;
+    }
+
+    // Avance mientras las posiciones estén publicadas:
+    size_t reserved = atomic_load_explicit(&vector->reserved, memory_order_relaxed);
+    while ((from < reserved) && (_cvector_published(vector, from) != NULL)){
+        from++;
+    }
+
+    return from;
+}
+
+/*
+    @brief Función para obtener el número de posiciones reservadas del vector.
+    @note: Incluye las posiciones cuyo elemento aún se está copiando (ver cvector_published_prefix).
+
+    @param const cvector_pt vector: Referencia al vector.
+
+    @retval size_t: Tamaño del vector (0 si no es válido).
+*/
+size_t cvector_size(const cvector_pt vector){
+    // Comprobación de vector válido:
+    if (vector == NULL){
+        return 0;
+    }
+
+    return atomic_load_explicit(&vector->reserved, memory_order_relaxed);
+}
+
+/*
+    @brief Función para obtener el tamaño del elemento del vector.
+
+    @param const cvector_pt vector: Referencia al vector.
+
+    @retval size_t: Tamaño (bytes) del elemento (0 si no es válido).
+*/
+size_t cvector_element_size(const cvector_pt vector){
+    // Comprobación de vector válido:
+    if (vector == NULL){
+        return 0;
+    }
+
+    return vector->element_size;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna que calcula el segmento y la posición dentro de él de un índice (O(1)).
+    @note: Con F = ALLOC_BLOCK_SIZE, el segmento k cubre los índices [F·(2^k - 1), F·(2^(k+1) - 1)), así que el segmento es
+           log2(índice + F) - log2(F).
+
+    @param size_t index: Índice del elemento.
+    @param size_t * out_offset: Referencia donde se guarda la posición dentro del segmento.
+
+    @retval size_t: Segmento del índice.
+*/
+static inline size_t _cvector_locate(size_t index, size_t * out_offset){
+    uint64_t biased = (uint64_t)index + ((uint64_t)1 << CVECTOR_FIRST_SHIFT);
+    size_t high_bit = 63 - (size_t)__builtin_clzll(biased);
+    *out_offset = (size_t)(biased - ((uint64_t)1 << high_bit));
+
+    return high_bit - CVECTOR_FIRST_SHIFT;
+}
+
+/*
+    @brief Función interna que retorna el tamaño (bytes) de los indicadores de publicación de un segmento (alineado a 8).
+
+    @param size_t segment: Segmento.
+
+    @retval size_t: Tamaño de los indicadores.
+*/
+static inline size_t _cvector_flags_size(size_t segment){
+    size_t capacity = (size_t)1 << (segment + CVECTOR_FIRST_SHIFT);
+    return (capacity + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+}
+
+/*
+    @brief Función interna que retorna un segmento, creándolo si aún no existe.
+    @note: Si varios hilos lo crean a la vez, solo se publica uno (CAS) y el resto liberan el suyo.
+
+    @param cvector_pt vector: Referencia al vector.
+    @param size_t segment: Segmento.
+
+    @retval uint8_t *: Referencia al segmento (nula si no hay memoria).
+*/
+static uint8_t * _cvector_segment(cvector_pt vector, size_t segment){
+    uint8_t * base = atomic_load_explicit(&vector->segments[segment], memory_order_acquire);
+    if (base != NULL){
+        return base;
+    }
+
+    // Creación del segmento: indicadores de publicación (a 0's) seguidos de los elementos:
+    size_t capacity = (size_t)1 << (segment + CVECTOR_FIRST_SHIFT);
+    uint8_t * new_base = (uint8_t *)calloc(1, _cvector_flags_size(segment) + capacity * vector->element_size);
+    if (new_base == NULL){
+        return NULL;
+    }
+
+    if (!atomic_compare_exchange_strong_explicit(&vector->segments[segment], &base, new_base, memory_order_acq_rel, memory_order_acquire)){
+        free(new_base);
+        return base;
+    }
+
+    return new_base;
+}
+
+/*
+    @brief Función interna que retorna la referencia a un elemento si ya está publicado.
+
+    @param const cvector_pt vector: Referencia al vector.
+    @param size_t index: Índice del elemento (menor que el número de posiciones reservadas).
+
+    @retval const uint8_t *: Referencia al elemento (nula si no se ha publicado).
+*/
+static const uint8_t * _cvector_published(const cvector_pt vector, size_t index){
+    size_t offset;
+    size_t segment = _cvector_locate(index, &offset);
+    if (segment >= CVECTOR_MAX_SEGMENTS){
+        return NULL;
+    }
+
+    uint8_t * base = atomic_load_explicit(&vector->segments[segment], memory_order_acquire);
+    if ((base == NULL) || !atomic_load_explicit((atomic_uchar *)base + offset, memory_order_acquire)){
+        return NULL;
+    }
+
+    return base + _cvector_flags_size(segment) + offset * vector->element_size;
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef CVECTOR_HEADER
+#define CVECTOR_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "array.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define CVECTOR_CACHE_LINE 64               // Tamaño (bytes) de la línea de caché.
+#define CVECTOR_FIRST_SHIFT 5               // log2 de la capacidad del primer segmento (ALLOC_BLOCK_SIZE elementos).
+#define CVECTOR_MAX_SEGMENTS 48             // Segmentos de la tabla (cada uno dobla al anterior).
+#define CVECTOR_INVALID_INDEX SIZE_MAX      // Índice retornado por push_back en caso de error.
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos---------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct cvector{
+    _Alignas(CVECTOR_CACHE_LINE) atomic_size_t reserved;        // Posiciones reservadas (índice de la siguiente inserción).
+    _Alignas(CVECTOR_CACHE_LINE) _Atomic(uint8_t *) segments[CVECTOR_MAX_SEGMENTS];  // Tabla de segmentos (nunca se mueven).
+    size_t element_size;                                        // Tamaño (bytes) del elemento.
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct cvector cvector_t;
+typedef cvector_t * cvector_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción del vector:
+cvector_pt cvector_init(size_t element_size);
+void cvector_deinit(cvector_pt * vector);
+
+// Inserción (cualquier hilo):
+size_t cvector_push_back(cvector_pt vector, const void * element);
+
+// Lectura (cualquier hilo):
+uint8_t cvector_get(const cvector_pt vector, size_t index, void * element);
+const void * cvector_at(const cvector_pt vector, size_t index);
+size_t cvector_published_prefix(const cvector_pt vector, size_t from);
+
+// Utilidades generales:
+size_t cvector_size(const cvector_pt vector);
+size_t cvector_element_size(const cvector_pt vector);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
@@ -0,0 +1,414 @@
+#include "gapbuf.h"
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static uint8_t _gapbuf_grow(gapbuf_pt gapbuf, size_t min_gap);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar un gap buffer (secuencia con un hueco en la posición del cursor).
+    @note: Insertar y borrar en el cursor solo cambia los límites del hueco; mover el cursor desplaza los elementos
+           que cruza (coste proporcional a la distancia).
+
+    @param size_t element_size: Tamaño (bytes) del elemento.
+
+    @retval gapbuf_pt: Referencia al buffer creado (NULL si el tamaño no es válido o no hay memoria).
+*/
+gapbuf_pt gapbuf_init(size_t element_size){
+    // Comprobación de los límites del tamaño del elemento:
+    if ((element_size < MIN_ELEMENT_SIZE) || (element_size > MAX_ELEMENT_SIZE)){
+        return NULL;
+    }
+
+    // Reserva de memoria de la estructura y del buffer (todo hueco):
+    gapbuf_pt gapbuf = (gapbuf_pt)malloc(sizeof(gapbuf_t));
+    if (gapbuf == NULL){
+        return NULL;
+    }
+
+    gapbuf->buffer = (uint8_t *)calloc(ALLOC_BLOCK_SIZE, element_size);
+    if (gapbuf->buffer == NULL){
+        free(gapbuf);
+        return NULL;
+    }
+
+    // Inicio de los miembros de la estructura:
+    gapbuf->element_size = element_size;
+    gapbuf->capacity = ALLOC_BLOCK_SIZE;
+    gapbuf->gap_start = 0;
+    gapbuf->gap_end = ALLOC_BLOCK_SIZE;
+
+    return gapbuf;
+}
+
+/*
+    @brief Función para destruir y liberar un gap buffer.
+
+    @param gapbuf_pt * gapbuf: Referencia a la referencia del buffer.
+
+    @retval None.
+*/
+void gapbuf_deinit(gapbuf_pt * gapbuf){
+    // Comprobación de que el buffer no sea nulo:
+    if ((gapbuf == NULL) || (*gapbuf == NULL)){
+        return;
+    }
+
+    free((*gapbuf)->buffer);
+    free(*gapbuf);
+    *gapbuf = NULL;
+}
+
+/*
+    @brief Función para eliminar todos los elementos (el cursor vuelve al inicio y se conserva la capacidad).
+
+    @param gapbuf_pt gapbuf: Referencia al buffer.
+
+    @retval None.
+*/
+void gapbuf_clear(gapbuf_pt gapbuf){
+    // Comprobación de buffer válido:
+    if (gapbuf == NULL){
+        return;
+    }
+
+    gapbuf->gap_start = 0;
+    gapbuf->gap_end = gapbuf->capacity;
+}
+
+/*
+    @brief Función para insertar un elemento en el cursor; el cursor queda tras el elemento insertado. Coste O(1) amortizado.
+
+    @param gapbuf_pt gapbuf: Referencia al buffer.
+    @param const void * element: Referencia al elemento.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Buffer o elemento no válidos.
+                    -> 2: Error al ampliar el buffer.
+*/
+uint8_t gapbuf_insert(gapbuf_pt gapbuf, const void * element){
+    return gapbuf_insert_n(gapbuf, element, 1);
+}
+
+/*
+    @brief Función para insertar varios elementos contiguos en el cursor; el cursor queda tras el último. Coste O(n) amortizado.
+
+    @param gapbuf_pt gapbuf: Referencia al buffer.
+    @param const void * elements: Referencia a los elementos.
+    @param size_t n: Número de elementos.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Buffer o elementos no válidos.
+                    -> 2: Error al ampliar el buffer.
+*/
+uint8_t gapbuf_insert_n(gapbuf_pt gapbuf, const void * elements, size_t n){
+    // Comprobación de buffer y elementos válidos:
+    if ((gapbuf == NULL) || ((elements == NULL) && (n > 0))){
+        return 1;
+    }
+
+    // Ampliación del hueco si no caben los elementos:
+    if ((gapbuf->gap_end - gapbuf->gap_start < n) && (_gapbuf_grow(gapbuf, n) != 0)){
+        return 2;
+    }
+
+    // Copia al inicio del hueco y avance del cursor:
+    memcpy(gapbuf->buffer + gapbuf->gap_start * gapbuf->element_size, elements, n * gapbuf->element_size);
+    gapbuf->gap_start += n;
+
+    return 0;
+}
+
+/*
+    @brief Función para eliminar los n elementos anteriores al cursor (retroceso). Coste O(1).
+
+    @param gapbuf_pt gapbuf: Referencia al buffer.
+    @param size_t n: Número de elementos a eliminar.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Buffer no válido.
+                    -> 2: Hay menos de n elementos antes del cursor.
+*/
+uint8_t gapbuf_delete_before(gapbuf_pt gapbuf, size_t n){
+    // Comprobación de buffer y número de elementos válidos:
+    if (gapbuf == NULL){
+        return 1;
+    }
+
+    if (n > gapbuf->gap_start){
+        return 2;
+    }
+
+    // El hueco absorbe los elementos:
+    gapbuf->gap_start -= n;
+
+    return 0;
+}
+
+/*
+    @brief Función para eliminar los n elementos posteriores al cursor (supresión). Coste O(1).
+
+    @param gapbuf_pt gapbuf: Referencia al buffer.
+    @param size_t n: Número de elementos a eliminar.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Buffer no válido.
+                    -> 2: Hay menos de n elementos después del cursor.
+*/
+uint8_t gapbuf_delete_after(gapbuf_pt gapbuf, size_t n){
+    // Comprobación de buffer y número de elementos válidos:
+    if (gapbuf == NULL){
+        return 1;
+    }
+
+    if (n > gapbuf->capacity - gapbuf->gap_end){
+        return 2;
+    }
+
+    // El hueco absorbe los elementos:
+    gapbuf->gap_end += n;
+
+    return 0;
+}
+
+/*
+    @brief Función para mover el cursor a una posición (0: antes del primer elemento, size: tras el último).
+    @note: Los elementos entre la posición actual y la nueva cruzan el hueco con un único memmove (coste O(distancia)).
+
+    @param gapbuf_pt gapbuf: Referencia al buffer.
+    @param size_t position: Nueva posición del cursor.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Buffer no válido.
+                    -> 2: La posición excede el número de elementos.
+*/
+uint8_t gapbuf_set_cursor(gapbuf_pt gapbuf, size_t position){
+    // Comprobación de buffer y posición válidos:
+    if (gapbuf == NULL){
+        return 1;
+    }
+
+    if (position > gapbuf_size(gapbuf)){
+        return 2;
+    }
+
+    // Desplazamiento de los elementos que cruza el cursor al otro lado del hueco:
+    size_t element_size = gapbuf->element_size;
+    if (position < gapbuf->gap_start){
+        size_t count = gapbuf->gap_start - position;
+        memmove(gapbuf->buffer + (gapbuf->gap_end - count) * element_size, gapbuf->buffer + position * element_size, count * element_size);
+        gapbuf->gap_start -= count;
+        gapbuf->gap_end -= count;
+    } else if (position > gapbuf->gap_start){
+        size_t count = position - gapbuf->gap_start;
+        memmove(gapbuf->buffer + gapbuf->gap_start * element_size, gapbuf->buffer + gapbuf->gap_end * element_size, count * element_size);
+        gapbuf->gap_start += count;
+        gapbuf->gap_end += count;
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna la posición del cursor (número de elementos anteriores a él).
+
+    @param const gapbuf_pt gapbuf: Referencia al buffer.
+
+    @retval size_t: Posición del cursor (0 si el buffer no es válido).
+*/
+size_t gapbuf_cursor(const gapbuf_pt gapbuf){
+    // Comprobación de buffer válido:
+    if (gapbuf == NULL){
+        return 0;
+    }
+
+    return gapbuf->gap_start;
+}
+
+/*
+    @brief Función para obtener una copia del elemento en un índice lógico (saltando el hueco). Coste O(1).
+
+    @param const gapbuf_pt gapbuf: Referencia al buffer.
+    @param size_t index: Índice del elemento.
+    @param void * element: Referencia donde copiar el elemento.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Buffer o referencia no válidos.
+                    -> 2: El índice no es válido.
+*/
+uint8_t gapbuf_get(const gapbuf_pt gapbuf, size_t index, void * element){
+    // Comprobación de buffer y referencia válidos:
+    if ((gapbuf == NULL) || (element == NULL)){
+        return 1;
+    }
+
+    // Búsqueda del elemento y copia:
+    void * target = gapbuf_at(gapbuf, index);
+    if (target == NULL){
+        return 2;
+    }
+    memcpy(element, target, gapbuf->element_size);
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna una referencia al elemento en un índice lógico (saltando el hueco). Coste O(1).
+    @note: La referencia deja de ser válida al editar el buffer o mover el cursor.
+
+    @param const gapbuf_pt gapbuf: Referencia al buffer.
+    @param size_t index: Índice del elemento.
+
+    @retval void *: Referencia al elemento (NULL si el buffer o el índice no son válidos).
+*/
+void * gapbuf_at(const gapbuf_pt gapbuf, size_t index){
+    // Comprobación de buffer e índice válidos:
+    if ((gapbuf == NULL) || (index >= gapbuf_size(gapbuf))){
+        return NULL;
+    }
+
+    // Los índices desde el cursor se desplazan el tamaño del hueco:
+    size_t position = (index < gapbuf->gap_start) ? index : index + (gapbuf->gap_end - gapbuf->gap_start);
+
+    return gapbuf->buffer + position * gapbuf->element_size;
+}
+
+/*
+    @brief Función para copiar todos los elementos, en orden, a un array contiguo (se sustituye su contenido).
+    @note: Se copian los dos tramos (antes y después del hueco) con un memcpy cada uno; el cursor no se mueve.
+
+    @param const gapbuf_pt gapbuf: Referencia al buffer.
+    @param array_pt out: Referencia al array destino.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Buffer o array no válidos.
+                    -> 2: El tamaño de elemento del array no coincide.
+                    -> 3: Error al ampliar el array.
+*/
+uint8_t gapbuf_export(const gapbuf_pt gapbuf, array_pt out){
+    // Comprobación de buffer y array válidos:
+    if ((gapbuf == NULL) || (out == NULL)){
+        return 1;
+    }
+
+    if (out->element_size != gapbuf->element_size){
+        return 2;
+    }
+
+    // Reserva del array y copia de ambos tramos:
+    size_t size = gapbuf_size(gapbuf);
+    if (array_reserve(out, size) != 0){
+        return 3;
+    }
+
+    size_t element_size = gapbuf->element_size;
+    size_t tail = gapbuf->capacity - gapbuf->gap_end;
+    memcpy(out->arr, gapbuf->buffer, gapbuf->gap_start * element_size);
+    memcpy((uint8_t *)out->arr + gapbuf->gap_start * element_size, gapbuf->buffer + gapbuf->gap_end * element_size, tail * element_size);
+    out->size = size;
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna el número de elementos (sin contar el hueco).
+
+    @param const gapbuf_pt gapbuf: Referencia al buffer.
+
+    @retval size_t: Número de elementos (0 si el buffer no es válido).
+*/
+size_t gapbuf_size(const gapbuf_pt gapbuf){
+    // Comprobación de buffer válido:
+    if (gapbuf == NULL){
+        return 0;
+    }
+
+    return gapbuf->capacity - (gapbuf->gap_end - gapbuf->gap_start);
+}
+
+/*
+    @brief Función que retorna el tamaño (en bytes) de un elemento.
+
+    @param const gapbuf_pt gapbuf: Referencia al buffer.
+
+    @retval size_t: Tamaño del elemento (0 si el buffer no es válido).
+*/
+size_t gapbuf_element_size(const gapbuf_pt gapbuf){
+    // Comprobación de buffer válido:
+    if (gapbuf == NULL){
+        return 0;
+    }
+
+    return gapbuf->element_size;
+}
+
+/*
+    @brief Función que retorna la capacidad del buffer (elementos más hueco).
+
+    @param const gapbuf_pt gapbuf: Referencia al buffer.
+
+    @retval size_t: Capacidad del buffer (0 si el buffer no es válido).
+*/
+size_t gapbuf_capacity(const gapbuf_pt gapbuf){
+    // Comprobación de buffer válido:
+    if (gapbuf == NULL){
+        return 0;
+    }
+
+    return gapbuf->capacity;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna que amplía el buffer (al menos al doble) para que el hueco admita min_gap elementos.
+    @note: Los elementos posteriores al hueco se desplazan al final del nuevo buffer.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param gapbuf_pt gapbuf: Referencia al buffer.
+    @param size_t min_gap: Tamaño mínimo (elementos) del hueco tras ampliar.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 2: Error al ampliar el buffer.
+*/
+static uint8_t _gapbuf_grow(gapbuf_pt gapbuf, size_t min_gap){
+    // Nueva capacidad (en bloques completos):
+    size_t size = gapbuf_size(gapbuf);
+    size_t new_capacity = 2 * gapbuf->capacity;
+    if (new_capacity < size + min_gap){
+        new_capacity = size + min_gap;
+    }
+    new_capacity = ((new_capacity + ALLOC_BLOCK_SIZE - 1) / ALLOC_BLOCK_SIZE) * ALLOC_BLOCK_SIZE;
+
+    uint8_t * temp_buffer = (uint8_t *)realloc(gapbuf->buffer, new_capacity * gapbuf->element_size);
+    if (temp_buffer == NULL){
+        return 2;
+    }
+
+    // Traslado del tramo posterior al hueco al final del buffer ampliado:
+    size_t tail = gapbuf->capacity - gapbuf->gap_end;
+    memmove(temp_buffer + (new_capacity - tail) * gapbuf->element_size, temp_buffer + gapbuf->gap_end * gapbuf->element_size, tail * gapbuf->element_size);
+
+    gapbuf->buffer = temp_buffer;
+    gapbuf->gap_end = new_capacity - tail;
+    gapbuf->capacity = new_capacity;
+
+    return 0;
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
@@ -0,0 +1,63 @@
+#ifndef GAPBUF_HEADER
+#define GAPBUF_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "array.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos---------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct gapbuf{
+    uint8_t * buffer;           // Elementos antes del hueco, hueco y elementos después del hueco.
+    size_t element_size;        // Tamaño (bytes) del elemento.
+    size_t capacity;            // Capacidad total del buffer (número de elementos, hueco incluido).
+    size_t gap_start;           // Inicio del hueco (posición del cursor).
+    size_t gap_end;             // Fin (excluido) del hueco.
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct gapbuf gapbuf_t;
+typedef gapbuf_t * gapbuf_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción del buffer:
+gapbuf_pt gapbuf_init(size_t element_size);
+void gapbuf_deinit(gapbuf_pt * gapbuf);
+void gapbuf_clear(gapbuf_pt gapbuf);
+
+// Edición en el cursor:
+uint8_t gapbuf_insert(gapbuf_pt gapbuf, const void * element);
+uint8_t gapbuf_insert_n(gapbuf_pt gapbuf, const void * elements, size_t n);
+uint8_t gapbuf_delete_before(gapbuf_pt gapbuf, size_t n);
+uint8_t gapbuf_delete_after(gapbuf_pt gapbuf, size_t n);
+
+// Movimiento del cursor:
+uint8_t gapbuf_set_cursor(gapbuf_pt gapbuf, size_t position);
+size_t gapbuf_cursor(const gapbuf_pt gapbuf);
+
+// Acceso por índice y exportación:
+uint8_t gapbuf_get(const gapbuf_pt gapbuf, size_t index, void * element);
+void * gapbuf_at(const gapbuf_pt gapbuf, size_t index);
+uint8_t gapbuf_export(const gapbuf_pt gapbuf, array_pt out);
+
+// Utilidades generales:
+size_t gapbuf_size(const gapbuf_pt gapbuf);
+size_t gapbuf_element_size(const gapbuf_pt gapbuf);
+size_t gapbuf_capacity(const gapbuf_pt gapbuf);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
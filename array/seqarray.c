@@ -0,0 +1,463 @@
+#include "seqarray.h"
+
+#include <sched.h>
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static seq_buffer_pt _seqarray_buffer_init(size_t capacity, size_t slot_words);
+static uint8_t _seqarray_grow(seqarray_pt array, size_t capacity);
+static uint8_t _seqarray_read(const seqarray_pt array, size_t index, size_t count, void * elements);
+static inline void _seqarray_store(const seqarray_pt array, seq_buffer_pt buffer, size_t index, const void * element);
+static inline void _seqarray_load(const seqarray_pt array, seq_buffer_pt buffer, size_t index, void * element);
+static inline void _seqarray_cpu_relax(void);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar (a 0's) un array dinámico con lecturas optimistas (seqlock).
+    @note: Un único hilo escritor; cualquier número de lectores leen sin bloquearse ni escribir en memoria compartida.
+           Los lectores repiten la lectura si una escritura se solapó con ella (el contador de secuencia cambió).
+
+    @param size_t element_size: Tamaño del elemento básico del array en bytes.
+
+    @retval seqarray_pt: Puntero al array creado.
+*/
+seqarray_pt seqarray_init(size_t element_size){
+    // Comprobación de los límites del tamaño del elemento básico del array:
+    if ((element_size < MIN_ELEMENT_SIZE) || (element_size > MAX_ELEMENT_SIZE)){
+        return NULL;
+    }
+
+    // Reserva memoria para la estructura (alineada a línea de caché) y el buffer inicial:
+    seqarray_pt array = (seqarray_pt)aligned_alloc(SEQARRAY_CACHE_LINE, sizeof(seqarray_t));
+    if (array == NULL){
+        return NULL;
+    }
+
+    array->element_size = element_size;
+    array->slot_words = (element_size + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    seq_buffer_pt buffer = _seqarray_buffer_init(ALLOC_BLOCK_SIZE, array->slot_words);
+    if (buffer == NULL){
+        free(array);
+        return NULL;
+    }
+
+    // Inicio de los miembros de la estructura:
+    atomic_init(&array->seq, 0);
+    atomic_init(&array->buffer, buffer);
+    atomic_init(&array->size, 0);
+    array->write_depth = 0;
+
+    return array;
+}
+
+/*
+    @brief Función para destruir y liberar un array, su buffer y los buffers retirados.
+    @note: Ningún hilo debe estar usando el array.
+
+    @param seqarray_pt * array: Referencia a la referencia del array.
+
+    @retval None.
+*/
+void seqarray_deinit(seqarray_pt * array){
+    // Comprobación de que el array no sea nulo:
+    if ((array == NULL) || (*array == NULL)){
+        return;
+    }
+
+    // Liberación del buffer actual y de los retirados:
+    seq_buffer_pt temp_buffer = atomic_load_explicit(&(*array)->buffer, memory_order_relaxed);
+    while (temp_buffer != NULL){
+        seq_buffer_pt temp_prev_buffer = temp_buffer->prev;
+        free(temp_buffer);
+        temp_buffer = temp_prev_buffer;
+    }
+
+    free(*array);
+    *array = NULL;
+}
+
+/*
+    @brief Función (escritor) para abrir una sección de escritura.
+    @note: Todas las escrituras hasta seqarray_write_end se publican con un único cambio de secuencia: los lectores ven el
+           estado anterior o el posterior completo. Las secciones se pueden anidar (seqarray_set abre la suya).
+
+    @param seqarray_pt array: Referencia al array.
+
+    @retval None.
+*/
+void seqarray_write_begin(seqarray_pt array){
+    // Comprobación de array válido:
+    if (array == NULL){
+        return;
+    }
+
+    // Secuencia impar antes de cualquier escritura de la sección:
+    if (array->write_depth++ == 0){
+        unsigned int seq = atomic_load_explicit(&array->seq, memory_order_relaxed);
+        atomic_store_explicit(&array->seq, seq + 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+    }
+}
+
+/*
+    @brief Función (escritor) para cerrar una sección de escritura.
+
+    @param seqarray_pt array: Referencia al array.
+
+    @retval None.
+*/
+void seqarray_write_end(seqarray_pt array){
+    // Comprobación de array válido (y de sección abierta):
+    if ((array == NULL) || (array->write_depth == 0)){
+        return;
+    }
+
+    // Secuencia par tras todas las escrituras de la sección:
+    if (--array->write_depth == 0){
+        unsigned int seq = atomic_load_explicit(&array->seq, memory_order_relaxed);
+        atomic_store_explicit(&array->seq, seq + 1, memory_order_release);
+    }
+}
+
+/*
+    @brief Función (escritor) para añadir un elemento al array, en la posición dada.
+    @note: Si la posición supera la capacidad, el buffer se duplica (las posiciones intermedias quedan a 0's) y el antiguo se
+           retira sin liberarse, porque puede haber lectores copiando de él. Los lectores no anuncian cuándo terminan, así que
+           los buffers retirados solo se liberan en seqarray_deinit. Como toda ampliación (también seqarray_reserve) al menos
+           duplica la capacidad, la suma de los retirados queda por debajo de la capacidad del buffer actual.
+
+    @param seqarray_pt array: Referencia al array.
+    @param const void * element: Referencia al elemento a almacenar.
+    @param size_t index: Posición del array donde almacenar el elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: El array/elemento es nulo.
+                -> 2: Error de reserva de memoria al ampliar el buffer (o posición no alcanzable duplicando la capacidad).
+*/
+uint8_t seqarray_set(seqarray_pt array, const void * element, size_t index){
+    // Comprobación de array y elemento válido:
+    if ((array == NULL) || (element == NULL)){
+        return 1;
+    }
+
+    // Ampliación del buffer si es necesario (antes de abrir la sección, el buffer antiguo sigue siendo válido):
+    seq_buffer_pt buffer = atomic_load_explicit(&array->buffer, memory_order_relaxed);
+    if (index >= buffer->capacity){
+        size_t capacity = buffer->capacity;
+        while (index >= capacity){
+            if (capacity > (SIZE_MAX / 2)){
+                return 2;
+            }
+            capacity *= 2;
+        }
+        if (_seqarray_grow(array, capacity) != 0){
+            return 2;
+        }
+        buffer = atomic_load_explicit(&array->buffer, memory_order_relaxed);
+    }
+
+    // Copia del elemento y actualización del tamaño dentro de la sección de escritura:
+    seqarray_write_begin(array);
+    _seqarray_store(array, buffer, index, element);
+    if (index >= atomic_load_explicit(&array->size, memory_order_relaxed)){
+        atomic_store_explicit(&array->size, index + 1, memory_order_relaxed);
+    }
+    seqarray_write_end(array);
+
+    return 0;
+}
+
+/*
+    @brief Función (escritor) para reservar capacidad en el array sin modificar su contenido.
+    @note: La capacidad se redondea al menos al doble de la actual: cada ampliación retira el buffer anterior hasta
+           seqarray_deinit, y así los retirados suman menos que el buffer actual aunque se reserve de uno en uno.
+
+    @param seqarray_pt array: Referencia al array.
+    @param size_t capacity: Capacidad mínima deseada (número de elementos).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: El array es nulo.
+                -> 2: Error de reserva de memoria.
+*/
+uint8_t seqarray_reserve(seqarray_pt array, size_t capacity){
+    // Comprobación de array válido:
+    if (array == NULL){
+        return 1;
+    }
+
+    // Sin cambios si la capacidad actual es suficiente:
+    size_t current = atomic_load_explicit(&array->buffer, memory_order_relaxed)->capacity;
+    if (capacity <= current){
+        return 0;
+    }
+
+    // Crecimiento geométrico (al menos el doble de la capacidad actual):
+    if ((current <= (SIZE_MAX / 2)) && (capacity < (current * 2))){
+        capacity = current * 2;
+    }
+
+    return _seqarray_grow(array, capacity);
+}
+
+/*
+    @brief Función (lector) para obtener un elemento del array, del índice indicado, en la variable indicada.
+    @note: Lectura optimista sin bloqueos: se repite si una escritura se ha solapado con ella.
+
+    @param const seqarray_pt array: Referencia al array.
+    @param size_t index: Índice del elemento a obtener.
+    @param void * element: Referencia a la variable donde se copiará el elemento.
+
+    @retval uint8_t:
+            -> 0: No han ocurrido errores.
+            -> 1: El array/elemento es nulo.
+            -> 2: El índice no es válido.
+*/
+uint8_t seqarray_get(const seqarray_pt array, size_t index, void * element){
+    // Comprobación de array y elemento válido:
+    if ((array == NULL) || (element == NULL)){
+        return 1;
+    }
+
+    return _seqarray_read(array, index, 1, element);
+}
+
+/*
+    @brief Función (lector) para obtener varios elementos consecutivos como una instantánea coherente.
+    @note: Todos los elementos copiados corresponden al mismo estado del array (ninguna escritura a medias).
+
+    @param const seqarray_pt array: Referencia al array.
+    @param size_t index: Índice del primer elemento a obtener.
+    @param size_t count: Número de elementos a obtener.
+    @param void * elements: Referencia al destino (count elementos consecutivos).
+
+    @retval uint8_t:
+            -> 0: No han ocurrido errores.
+            -> 1: El array/destino es nulo.
+            -> 2: El rango no es válido.
+*/
+uint8_t seqarray_get_range(const seqarray_pt array, size_t index, size_t count, void * elements){
+    // Comprobación de array y destino válido:
+    if ((array == NULL) || (elements == NULL)){
+        return 1;
+    }
+
+    return _seqarray_read(array, index, count, elements);
+}
+
+/*
+    @brief Función para obtener el tamaño actual del array (número de elementos).
+
+    @param const seqarray_pt array: Referencia al array.
+
+    @retval size_t: Tamaño del array (0 si no es válido).
+*/
+size_t seqarray_size(const seqarray_pt array){
+    // Comprobación de array válido:
+    if (array == NULL){
+        return 0;
+    }
+
+    return atomic_load_explicit(&array->size, memory_order_relaxed);
+}
+
+/*
+    @brief Función para obtener el tamaño del elemento del array.
+
+    @param const seqarray_pt array: Referencia al array.
+
+    @retval size_t: Tamaño (bytes) del elemento (0 si no es válido).
+*/
+size_t seqarray_element_size(const seqarray_pt array){
+    // Comprobación de array válido:
+    if (array == NULL){
+        return 0;
+    }
+
+    return array->element_size;
+}
+
+/*
+    @brief Función para obtener la capacidad actual del array (número de elementos).
+
+    @param const seqarray_pt array: Referencia al array.
+
+    @retval size_t: Capacidad del array (0 si no es válido).
+*/
+size_t seqarray_capacity(const seqarray_pt array){
+    // Comprobación de array válido:
+    if (array == NULL){
+        return 0;
+    }
+
+    return atomic_load_explicit(&array->buffer, memory_order_acquire)->capacity;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna que crea un buffer (a 0's) de la capacidad dada.
+
+    @param size_t capacity: Capacidad (número de elementos).
+    @param size_t slot_words: Palabras de 8 bytes por elemento.
+
+    @retval seq_buffer_pt: Referencia al buffer creado (nulo si no hay memoria).
+*/
+static seq_buffer_pt _seqarray_buffer_init(size_t capacity, size_t slot_words){
+    // Comprobación de desbordamiento del tamaño en bytes del buffer:
+    if (capacity > ((SIZE_MAX - sizeof(seq_buffer_t)) / sizeof(uint64_t) / slot_words)){
+        return NULL;
+    }
+
+    seq_buffer_pt buffer = (seq_buffer_pt)calloc(1, sizeof(seq_buffer_t) + capacity * slot_words * sizeof(uint64_t));
+    if (buffer == NULL){
+        return NULL;
+    }
+
+    buffer->capacity = capacity;
+    buffer->prev = NULL;
+
+    return buffer;
+}
+
+/*
+    @brief Función interna (escritor) que sustituye el buffer por uno mayor con el mismo contenido y retira el antiguo.
+    @note: Los lectores que cargaron el buffer antiguo siguen leyendo datos válidos de él (no se libera hasta seqarray_deinit);
+           no hace falta sección de escritura.
+
+    @param seqarray_pt array: Referencia al array.
+    @param size_t capacity: Nueva capacidad (número de elementos).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 2: Error de reserva de memoria.
+*/
+static uint8_t _seqarray_grow(seqarray_pt array, size_t capacity){
+    seq_buffer_pt old_buffer = atomic_load_explicit(&array->buffer, memory_order_relaxed);
+    seq_buffer_pt new_buffer = _seqarray_buffer_init(capacity, array->slot_words);
+    if (new_buffer == NULL){
+        return 2;
+    }
+
+    // Copia del contenido (el escritor es el único que modifica el buffer antiguo):
+    size_t words = old_buffer->capacity * array->slot_words;
+    for (size_t i = 0; i < words; i++){
+        atomic_store_explicit(&new_buffer->words[i], atomic_load_explicit(&old_buffer->words[i], memory_order_relaxed), memory_order_relaxed);
+    }
+
+    // Publicación del nuevo buffer y retirada del antiguo:
+    new_buffer->prev = old_buffer;
+    atomic_store_explicit(&array->buffer, new_buffer, memory_order_release);
+
+    return 0;
+}
+
+/*
+    @brief Función interna (lector) que copia un rango de elementos repitiendo la lectura hasta que no se solape con una escritura.
+    @note: El lector solo lee memoria compartida. Tras SEQARRAY_SPIN_LIMIT reintentos cede la CPU (el escritor puede estar
+           detenido a mitad de una sección).
+
+    @param const seqarray_pt array: Referencia al array.
+    @param size_t index: Índice del primer elemento.
+    @param size_t count: Número de elementos.
+    @param void * elements: Referencia al destino.
+
+    @retval uint8_t:
+            -> 0: No han ocurrido errores.
+            -> 2: El rango no es válido.
+*/
+static uint8_t _seqarray_read(const seqarray_pt array, size_t index, size_t count, void * elements){
+    for (size_t spins = 0; ; spins++){
+        unsigned int seq = atomic_load_explicit(&array->seq, memory_order_acquire);
+
+        if ((seq & 1) == 0){
+            // Copia optimista (el buffer cargado puede ser uno retirado, que sigue siendo válido):
+            size_t size = atomic_load_explicit(&array->size, memory_order_relaxed);
+            seq_buffer_pt buffer = atomic_load_explicit(&array->buffer, memory_order_acquire);
+            bool valid = (index < size) && (count <= size - index) && (index + count <= buffer->capacity);
+            for (size_t i = 0; valid && (i < count); i++){
+                _seqarray_load(array, buffer, index + i, (uint8_t *)elements + i * array->element_size);
+            }
+
+            // Validación: ninguna escritura ha empezado durante la copia:
+            atomic_thread_fence(memory_order_acquire);
+            if (atomic_load_explicit(&array->seq, memory_order_relaxed) == seq){
+                return valid ? 0 : 2;
+            }
+        }
+
+        if (spins < SEQARRAY_SPIN_LIMIT){
+            _seqarray_cpu_relax();
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+/*
+    @brief Función interna que copia un elemento en su ranura palabra a palabra (escrituras atómicas relajadas).
+
+    @param const seqarray_pt array: Referencia al array.
+    @param seq_buffer_pt buffer: Referencia al buffer.
+    @param size_t index: Índice del elemento.
+    @param const void * element: Referencia al elemento.
+
+    @retval None.
+*/
+static inline void _seqarray_store(const seqarray_pt array, seq_buffer_pt buffer, size_t index, const void * element){
+    uint64_t temp_words[(MAX_ELEMENT_SIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+    temp_words[array->slot_words - 1] = 0;
+    memcpy(temp_words, element, array->element_size);
+
+    _Atomic uint64_t * slot = buffer->words + index * array->slot_words;
+    for (size_t i = 0; i < array->slot_words; i++){
+        atomic_store_explicit(&slot[i], temp_words[i], memory_order_relaxed);
+    }
+}
+
+/*
+    @brief Función interna que copia un elemento desde su ranura palabra a palabra (lecturas atómicas relajadas).
+    @note: La copia puede solaparse con una escritura; en ese caso el lector la descarta al validar la secuencia.
+
+    @param const seqarray_pt array: Referencia al array.
+    @param seq_buffer_pt buffer: Referencia al buffer.
+    @param size_t index: Índice del elemento.
+    @param void * element: Referencia a la variable donde se copiará el elemento.
+
+    @retval None.
+*/
+static inline void _seqarray_load(const seqarray_pt array, seq_buffer_pt buffer, size_t index, void * element){
+    uint64_t temp_words[(MAX_ELEMENT_SIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+
+    _Atomic uint64_t * slot = buffer->words + index * array->slot_words;
+    for (size_t i = 0; i < array->slot_words; i++){
+        temp_words[i] = atomic_load_explicit(&slot[i], memory_order_relaxed);
+    }
+
+    memcpy(element, temp_words, array->element_size);
+}
+
+/*
+    @brief Función interna que indica a la CPU que el hilo está en espera activa.
+
+    @retval None.
+*/
+static inline void _seqarray_cpu_relax(void){
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
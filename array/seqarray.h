@@ -0,0 +1,75 @@
+#ifndef SEQARRAY_HEADER
+#define SEQARRAY_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "array.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define SEQARRAY_CACHE_LINE 64      // Tamaño (bytes) de la línea de caché.
+#define SEQARRAY_SPIN_LIMIT 64      // Reintentos de lectura con espera activa antes de ceder la CPU.
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos---------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct seq_buffer{
+    size_t capacity;                // Capacidad del buffer (número de elementos).
+    struct seq_buffer * prev;       // Buffer anterior (retirado tras crecer, se libera en seqarray_deinit).
+    _Atomic uint64_t words[];       // Elementos, en palabras atómicas de 8 bytes (los lectores pueden leer mientras se escribe).
+};
+
+struct seqarray{
+    _Alignas(SEQARRAY_CACHE_LINE) atomic_uint seq;  // Contador de secuencia (impar mientras hay una escritura en curso).
+    _Atomic(struct seq_buffer *) buffer;            // Buffer actual.
+    atomic_size_t size;                             // Tamaño (número de elementos) del array actual.
+    size_t element_size;                            // Tamaño (bytes) del elemento del array.
+    size_t slot_words;                              // Palabras de 8 bytes por elemento.
+    size_t write_depth;                             // Anidamiento de secciones de escritura (solo lo usa el escritor).
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct seq_buffer seq_buffer_t;
+typedef seq_buffer_t * seq_buffer_pt;
+
+typedef struct seqarray seqarray_t;
+typedef seqarray_t * seqarray_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción del array:
+seqarray_pt seqarray_init(size_t element_size);
+void seqarray_deinit(seqarray_pt * array);
+
+// Escritura (un único hilo escritor):
+void seqarray_write_begin(seqarray_pt array);
+void seqarray_write_end(seqarray_pt array);
+uint8_t seqarray_set(seqarray_pt array, const void * element, size_t index);
+uint8_t seqarray_reserve(seqarray_pt array, size_t capacity);
+
+// Lectura optimista (cualquier hilo):
+uint8_t seqarray_get(const seqarray_pt array, size_t index, void * element);
+uint8_t seqarray_get_range(const seqarray_pt array, size_t index, size_t count, void * elements);
+
+// Utilidades generales:
+size_t seqarray_size(const seqarray_pt array);
+size_t seqarray_element_size(const seqarray_pt array);
+size_t seqarray_capacity(const seqarray_pt array);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
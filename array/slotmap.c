@@ -0,0 +1,394 @@
+#include "slotmap.h"
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static slotmap_slot_pt _slotmap_slot(const slotmap_pt slotmap, uint64_t handle);
+static uint8_t _slotmap_reserve_one(array_pt array);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar un slot map (almacenamiento denso con manejadores generacionales).
+    @note: Un manejador (64 bits) combina la generación (32 bits altos) y la ranura (32 bits bajos) del elemento;
+           al eliminarlo la generación de la ranura cambia, de modo que los manejadores antiguos se detectan como no válidos.
+
+    @param size_t element_size: Tamaño (bytes) del elemento.
+
+    @retval slotmap_pt: Referencia al slot map creado (NULL si el tamaño no es válido o no hay memoria).
+*/
+slotmap_pt slotmap_init(size_t element_size){
+    // Comprobación de los límites del tamaño del elemento:
+    if ((element_size < MIN_ELEMENT_SIZE) || (element_size > MAX_ELEMENT_SIZE)){
+        return NULL;
+    }
+
+    // Reserva de memoria de la estructura y de sus arrays:
+    slotmap_pt slotmap = (slotmap_pt)malloc(sizeof(slotmap_t));
+    if (slotmap == NULL){
+        return NULL;
+    }
+
+    slotmap->data = array_init(element_size);
+    slotmap->dense_slots = array_init(sizeof(uint32_t));
+    slotmap->slots = array_init(sizeof(slotmap_slot_t));
+    if ((slotmap->data == NULL) || (slotmap->dense_slots == NULL) || (slotmap->slots == NULL)){
+        array_deinit(slotmap->data);
+        array_deinit(slotmap->dense_slots);
+        array_deinit(slotmap->slots);
+        free(slotmap);
+        return NULL;
+    }
+
+    // Inicio del resto de miembros de la estructura:
+    slotmap->free_head = SLOTMAP_NO_SLOT;
+
+    return slotmap;
+}
+
+/*
+    @brief Función para destruir y liberar un slot map.
+
+    @param slotmap_pt * slotmap: Referencia a la referencia del slot map.
+
+    @retval None.
+*/
+void slotmap_deinit(slotmap_pt * slotmap){
+    // Comprobación de que el slot map no sea nulo:
+    if ((slotmap == NULL) || (*slotmap == NULL)){
+        return;
+    }
+
+    array_deinit((*slotmap)->data);
+    array_deinit((*slotmap)->dense_slots);
+    array_deinit((*slotmap)->slots);
+
+    free(*slotmap);
+    *slotmap = NULL;
+}
+
+/*
+    @brief Función para eliminar todos los elementos, invalidando todos los manejadores.
+    @note: Las ranuras se conservan (y se reutilizan) con su generación avanzada.
+
+    @param slotmap_pt slotmap: Referencia al slot map.
+
+    @retval None.
+*/
+void slotmap_clear(slotmap_pt slotmap){
+    // Comprobación de slot map válido:
+    if (slotmap == NULL){
+        return;
+    }
+
+    // Liberación de la ranura de cada elemento denso:
+    uint32_t * dense_slots = (uint32_t *)slotmap->dense_slots->arr;
+    slotmap_slot_pt slots = (slotmap_slot_pt)slotmap->slots->arr;
+    for (size_t i = 0; i < slotmap->dense_slots->size; i++){
+        slotmap_slot_pt slot = &slots[dense_slots[i]];
+        slot->generation++;
+        if (slot->generation != 0){
+            slot->index = slotmap->free_head;
+            slotmap->free_head = dense_slots[i];
+        }
+    }
+
+    slotmap->data->size = 0;
+    slotmap->dense_slots->size = 0;
+}
+
+/*
+    @brief Función para insertar un elemento, obteniendo su manejador. Coste O(1) amortizado.
+    @note: El elemento se añade al final del almacenamiento denso; la ranura se toma de la lista de libres si hay alguna.
+
+    @param slotmap_pt slotmap: Referencia al slot map.
+    @param const void * element: Referencia al elemento a copiar.
+    @param uint64_t * out_handle: Referencia donde guardar el manejador del elemento (puede ser nula).
+
+    @retval uint8_t: Código de error.
+                    -> 0: Elemento insertado.
+                    -> 1: Slot map o elemento no válidos.
+                    -> 2: No hay memoria para el elemento.
+                    -> 3: Se ha alcanzado el número máximo de ranuras.
+*/
+uint8_t slotmap_insert(slotmap_pt slotmap, const void * element, uint64_t * out_handle){
+    // Comprobación de slot map y elemento válidos:
+    if ((slotmap == NULL) || (element == NULL)){
+        return 1;
+    }
+
+    if ((slotmap->free_head == SLOTMAP_NO_SLOT) && (slotmap->slots->size >= SLOTMAP_MAX_SLOTS)){
+        return 3;
+    }
+
+    // Reserva previa de espacio (ninguna estructura cambia si falta memoria):
+    if ((_slotmap_reserve_one(slotmap->data) != 0) || (_slotmap_reserve_one(slotmap->dense_slots) != 0)){
+        return 2;
+    }
+    if ((slotmap->free_head == SLOTMAP_NO_SLOT) && (_slotmap_reserve_one(slotmap->slots) != 0)){
+        return 2;
+    }
+
+    // Obtención de una ranura (libre o nueva):
+    uint32_t slot_index;
+    if (slotmap->free_head != SLOTMAP_NO_SLOT){
+        slot_index = slotmap->free_head;
+        slotmap->free_head = ((slotmap_slot_pt)slotmap->slots->arr)[slot_index].index;
+    } else {
+        slot_index = (uint32_t)slotmap->slots->size;
+        slotmap_slot_t new_slot = {.generation = 0, .index = 0};
+        array_set(slotmap->slots, &new_slot, slot_index);
+    }
+
+    // Ocupación de la ranura (generación impar) y alta del elemento al final del almacenamiento denso:
+    slotmap_slot_pt slot = &((slotmap_slot_pt)slotmap->slots->arr)[slot_index];
+    slot->generation++;
+    slot->index = (uint32_t)slotmap->data->size;
+    array_set(slotmap->data, element, slotmap->data->size);
+    array_set(slotmap->dense_slots, &slot_index, slotmap->dense_slots->size);
+
+    if (out_handle != NULL){
+        *out_handle = ((uint64_t)slot->generation << 32) | slot_index;
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función para eliminar el elemento de un manejador. Coste O(1).
+    @note: El último elemento denso ocupa el hueco (el almacenamiento sigue siendo contiguo, pero su orden cambia).
+
+    @param slotmap_pt slotmap: Referencia al slot map.
+    @param uint64_t handle: Manejador del elemento.
+    @param void * out_element: Referencia donde copiar el elemento eliminado (puede ser nula).
+
+    @retval uint8_t: Código de error.
+                    -> 0: Elemento eliminado.
+                    -> 1: Slot map no válido.
+                    -> 2: Manejador no válido (nulo, ajeno o de un elemento ya eliminado).
+*/
+uint8_t slotmap_remove(slotmap_pt slotmap, uint64_t handle, void * out_element){
+    // Comprobación de slot map y manejador válidos:
+    if (slotmap == NULL){
+        return 1;
+    }
+
+    slotmap_slot_pt slot = _slotmap_slot(slotmap, handle);
+    if (slot == NULL){
+        return 2;
+    }
+
+    // Copia del elemento eliminado y traslado del último elemento denso a su posición:
+    size_t element_size = slotmap->data->element_size;
+    uint8_t * data = (uint8_t *)slotmap->data->arr;
+    uint32_t * dense_slots = (uint32_t *)slotmap->dense_slots->arr;
+    size_t index = slot->index;
+    size_t last = slotmap->data->size - 1;
+
+    if (out_element != NULL){
+        memcpy(out_element, data + index * element_size, element_size);
+    }
+    if (index != last){
+        memcpy(data + index * element_size, data + last * element_size, element_size);
+        dense_slots[index] = dense_slots[last];
+        ((slotmap_slot_pt)slotmap->slots->arr)[dense_slots[index]].index = (uint32_t)index;
+    }
+    slotmap->data->size--;
+    slotmap->dense_slots->size--;
+
+    // Liberación de la ranura (una ranura cuya generación da la vuelta se retira para no repetir manejadores):
+    uint32_t slot_index = (uint32_t)handle;
+    slot->generation++;
+    if (slot->generation != 0){
+        slot->index = slotmap->free_head;
+        slotmap->free_head = slot_index;
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función para obtener una copia del elemento de un manejador. Coste O(1).
+
+    @param const slotmap_pt slotmap: Referencia al slot map.
+    @param uint64_t handle: Manejador del elemento.
+    @param void * element: Referencia donde copiar el elemento.
+
+    @retval uint8_t: Código de error.
+                    -> 0: Elemento copiado.
+                    -> 1: Slot map o referencia de destino no válidos.
+                    -> 2: Manejador no válido (nulo, ajeno o de un elemento ya eliminado).
+*/
+uint8_t slotmap_get(const slotmap_pt slotmap, uint64_t handle, void * element){
+    // Comprobación de slot map y referencia válidos:
+    if ((slotmap == NULL) || (element == NULL)){
+        return 1;
+    }
+
+    // Búsqueda del elemento y copia:
+    void * target = slotmap_at(slotmap, handle);
+    if (target == NULL){
+        return 2;
+    }
+    memcpy(element, target, slotmap->data->element_size);
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna una referencia al elemento de un manejador. Coste O(1).
+    @note: La referencia deja de ser válida tras cualquier inserción o eliminación (los elementos se mueven); el manejador no.
+
+    @param const slotmap_pt slotmap: Referencia al slot map.
+    @param uint64_t handle: Manejador del elemento.
+
+    @retval void *: Referencia al elemento (NULL si el slot map o el manejador no son válidos).
+*/
+void * slotmap_at(const slotmap_pt slotmap, uint64_t handle){
+    // Comprobación de slot map válido:
+    if (slotmap == NULL){
+        return NULL;
+    }
+
+    slotmap_slot_pt slot = _slotmap_slot(slotmap, handle);
+    if (slot == NULL){
+        return NULL;
+    }
+
+    return (uint8_t *)slotmap->data->arr + (size_t)slot->index * slotmap->data->element_size;
+}
+
+/*
+    @brief Función que indica si un manejador corresponde a un elemento presente.
+
+    @param const slotmap_pt slotmap: Referencia al slot map.
+    @param uint64_t handle: Manejador a comprobar.
+
+    @retval bool: true si el elemento del manejador sigue en el slot map.
+*/
+bool slotmap_contains(const slotmap_pt slotmap, uint64_t handle){
+    // Comprobación de slot map válido:
+    if (slotmap == NULL){
+        return false;
+    }
+
+    return _slotmap_slot(slotmap, handle) != NULL;
+}
+
+/*
+    @brief Función que retorna el almacenamiento denso para recorrerlo de forma contigua (slotmap_size elementos).
+    @note: La referencia deja de ser válida tras cualquier inserción o eliminación.
+
+    @param const slotmap_pt slotmap: Referencia al slot map.
+
+    @retval void *: Referencia al primer elemento (NULL si el slot map no es válido).
+*/
+void * slotmap_data(const slotmap_pt slotmap){
+    // Comprobación de slot map válido:
+    if (slotmap == NULL){
+        return NULL;
+    }
+
+    return slotmap->data->arr;
+}
+
+/*
+    @brief Función que retorna el manejador del elemento en una posición del almacenamiento denso.
+
+    @param const slotmap_pt slotmap: Referencia al slot map.
+    @param size_t index: Posición en el almacenamiento denso.
+
+    @retval uint64_t: Manejador del elemento (SLOTMAP_NULL_HANDLE si el slot map o la posición no son válidos).
+*/
+uint64_t slotmap_handle_at(const slotmap_pt slotmap, size_t index){
+    // Comprobación de slot map y posición válidos:
+    if ((slotmap == NULL) || (index >= slotmap->dense_slots->size)){
+        return SLOTMAP_NULL_HANDLE;
+    }
+
+    uint32_t slot_index = ((uint32_t *)slotmap->dense_slots->arr)[index];
+    uint32_t generation = ((slotmap_slot_pt)slotmap->slots->arr)[slot_index].generation;
+
+    return ((uint64_t)generation << 32) | slot_index;
+}
+
+/*
+    @brief Función que retorna el número de elementos.
+
+    @param const slotmap_pt slotmap: Referencia al slot map.
+
+    @retval size_t: Número de elementos (0 si el slot map no es válido).
+*/
+size_t slotmap_size(const slotmap_pt slotmap){
+    // Comprobación de slot map válido:
+    if (slotmap == NULL){
+        return 0;
+    }
+
+    return slotmap->data->size;
+}
+
+/*
+    @brief Función que retorna el tamaño (en bytes) de un elemento.
+
+    @param const slotmap_pt slotmap: Referencia al slot map.
+
+    @retval size_t: Tamaño del elemento (0 si el slot map no es válido).
+*/
+size_t slotmap_element_size(const slotmap_pt slotmap){
+    // Comprobación de slot map válido:
+    if (slotmap == NULL){
+        return 0;
+    }
+
+    return slotmap->data->element_size;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna que retorna la ranura de un manejador si su generación coincide (elemento presente).
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param const slotmap_pt slotmap: Referencia al slot map.
+    @param uint64_t handle: Manejador del elemento.
+
+    @retval slotmap_slot_pt: Ranura del elemento (NULL si el manejador no es válido).
+*/
+static slotmap_slot_pt _slotmap_slot(const slotmap_pt slotmap, uint64_t handle){
+    uint32_t slot_index = (uint32_t)handle;
+    uint32_t generation = (uint32_t)(handle >> 32);
+
+    // Las generaciones de ranuras ocupadas son impares (el manejador nulo nunca coincide):
+    if (((generation & 1) == 0) || (slot_index >= slotmap->slots->size)){
+        return NULL;
+    }
+
+    slotmap_slot_pt slot = &((slotmap_slot_pt)slotmap->slots->arr)[slot_index];
+    return (slot->generation == generation) ? slot : NULL;
+}
+
+/*
+    @brief Función interna que garantiza espacio para un elemento más en un array, con crecimiento geométrico.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param array_pt array: Referencia al array.
+
+    @retval uint8_t: Código de error.
+                    -> 0: Hay espacio para un elemento más.
+                    -> 2: No hay memoria para ampliar el array.
+*/
+static uint8_t _slotmap_reserve_one(array_pt array){
+    if ((array->size == array->capacity) && (array_reserve(array, 2 * array->capacity + ALLOC_BLOCK_SIZE) != 0)){
+        return 2;
+    }
+
+    return 0;
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
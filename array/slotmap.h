@@ -0,0 +1,75 @@
+#ifndef SLOTMAP_HEADER
+#define SLOTMAP_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "array.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define SLOTMAP_NULL_HANDLE 0               // Manejador nulo (nunca lo retorna una inserción).
+#define SLOTMAP_NO_SLOT UINT32_MAX          // Fin de la lista de ranuras libres.
+#define SLOTMAP_MAX_SLOTS (UINT32_MAX - 1)  // Número máximo de ranuras (índice de 32 bits del manejador).
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos---------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct slotmap_slot{
+    uint32_t generation;        // Generación de la ranura (impar: ocupada, par: libre).
+    uint32_t index;             // Posición del elemento en el almacenamiento denso (ocupada) o siguiente ranura libre (libre).
+};
+
+struct slotmap{
+    array_pt data;              // Elementos contiguos (almacenamiento denso).
+    array_pt dense_slots;       // Ranura (uint32_t) de cada posición del almacenamiento denso.
+    array_pt slots;             // Índice disperso de ranuras (struct slotmap_slot) al que apuntan los manejadores.
+    uint32_t free_head;         // Primera ranura libre (SLOTMAP_NO_SLOT si no hay).
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct slotmap_slot slotmap_slot_t;
+typedef slotmap_slot_t * slotmap_slot_pt;
+
+typedef struct slotmap slotmap_t;
+typedef slotmap_t * slotmap_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción del slot map:
+slotmap_pt slotmap_init(size_t element_size);
+void slotmap_deinit(slotmap_pt * slotmap);
+void slotmap_clear(slotmap_pt slotmap);
+
+// Inserción y eliminación:
+uint8_t slotmap_insert(slotmap_pt slotmap, const void * element, uint64_t * out_handle);
+uint8_t slotmap_remove(slotmap_pt slotmap, uint64_t handle, void * out_element);
+
+// Acceso por manejador:
+uint8_t slotmap_get(const slotmap_pt slotmap, uint64_t handle, void * element);
+void * slotmap_at(const slotmap_pt slotmap, uint64_t handle);
+bool slotmap_contains(const slotmap_pt slotmap, uint64_t handle);
+
+// Recorrido del almacenamiento denso:
+void * slotmap_data(const slotmap_pt slotmap);
+uint64_t slotmap_handle_at(const slotmap_pt slotmap, size_t index);
+
+// Utilidades generales:
+size_t slotmap_size(const slotmap_pt slotmap);
+size_t slotmap_element_size(const slotmap_pt slotmap);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
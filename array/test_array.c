@@ -7,6 +7,8 @@ struct test_struct{
     uint16_t c;
 };
 
+bool has_member_a(const void * element, void * ctx);
+
 int main(int argc, char ** argv){
     printf("\n--------------------------------------------------------\n");
     printf("---- PRUEBA DE FUNCIONAMIENTO DE LA LIBREARÍA ARRAY ----\n\n");
@@ -52,6 +54,39 @@ int main(int argc, char ** argv){
     printf("\t-Longitud del array: %ld Elementos\n", array_size(a));
     printf("\t-Tamaño del elemento del array: %ld Bytes\n\n", array_element_size(a));
 
+    // Eliminación en una sola pasada de los elementos sin inicializar (miembro a == 0):
+    uint8_t target_a = 0;
+    size_t removed = array_remove_if(a, has_member_a, &target_a);
+    printf("Estado del array tras eliminar %ld elementos con a=%d (conservando el orden):\n", removed, target_a);
+    printf("\t-Longitud del array: %ld Elementos\n", array_size(a));
+    array_get(a, 0, &test_rec);
+    printf("\t-Primer elemento: a=%d b=%d c=%d\n\n", test_rec.a, test_rec.b, test_rec.c);
+
+    // Eliminación sin conservar el orden (sustitución por el último elemento):
+    array_set(a, &test1, array_size(a));
+    array_set(a, &test2, array_size(a));
+    target_a = test1.a;
+    removed = array_remove_if_unordered(a, has_member_a, &target_a);
+    printf("Estado del array tras eliminar %ld elementos con a=%d (sin conservar el orden):\n", removed, target_a);
+    printf("\t-Longitud del array: %ld Elementos\n", array_size(a));
+    array_get(a, 0, &test_rec);
+    printf("\t-Primer elemento: a=%d b=%d c=%d\n\n", test_rec.a, test_rec.b, test_rec.c);
+
+    // Reserva anticipada de capacidad (sin modificar la longitud):
+    array_reserve(a, 100);
+    printf("Estado del array tras reservar 100 elementos:\n");
+    printf("\t-Capacidad del array: %ld Elementos\n", array_capacity(a));
+    printf("\t-Longitud del array: %ld Elementos\n\n", array_size(a));
+
+    // Modificación en sitio y vaciado (se conserva la capacidad):
+    ((struct test_struct *)array_at(a, 0))->b = 99;
+    array_get(a, 0, &test_rec);
+    printf("Primer elemento tras modificarlo en sitio: a=%d b=%d c=%d\n", test_rec.a, test_rec.b, test_rec.c);
+    array_clear(a);
+    printf("Estado del array tras vaciarlo:\n");
+    printf("\t-Capacidad del array: %ld Elementos\n", array_capacity(a));
+    printf("\t-Longitud del array: %ld Elementos\n\n", array_size(a));
+
     // Desinicialización del array tras finalizar con su uso:
     array_deinit(a);
 
@@ -59,4 +94,16 @@ int main(int argc, char ** argv){
     printf("---------------------------------------------------------------\n\n");
 
     return 0;
+}
+
+/*
+    @brief Predicado que indica si el miembro a del elemento coincide con el valor dado como contexto.
+
+    @param const void * element: Referencia al elemento (struct test_struct).
+    @param void * ctx: Referencia al valor buscado (uint8_t).
+
+    @retval bool: true si coinciden, false en caso contrario.
+*/
+bool has_member_a(const void * element, void * ctx){
+    return ((const struct test_struct *)element)->a == *(uint8_t *)ctx;
 }
\ No newline at end of file
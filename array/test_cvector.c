@@ -0,0 +1,91 @@
+#include "cvector.h"
+#include <stdio.h>
+#include <pthread.h>
+
+#define TEST_THREADS 4
+#define TEST_RECORDS 50000
+
+struct record{
+    uint32_t thread;                // Hilo que escribió el registro.
+    uint32_t seq;                   // Número de registro dentro del hilo.
+};
+
+struct test_args{
+    cvector_pt vector;              // Vector compartido.
+    uint32_t thread;                // Identificador del hilo.
+};
+
+// Prototipos de funciones:
+void * append_thread(void * arg);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de un vector de registros:
+    cvector_pt vector = cvector_init(sizeof(struct record));
+    printf("\nSe ha creado el vector correctamente en la dirección (%p)\n", (void *)vector);
+
+    // Inserciones desde un solo hilo y referencias estables:
+    struct record temp_record = {0, 0};
+    size_t index = cvector_push_back(vector, &temp_record);
+    const struct record * first = (const struct record *)cvector_at(vector, index);
+    for (uint32_t i = 1; i < 1000; i++){
+        temp_record.seq = i;
+        cvector_push_back(vector, &temp_record);
+    }
+    printf("1000 inserciones: tamaño %ld, el primer elemento sigue en (%p): %s\n",
+           cvector_size(vector), (void *)first, (first == cvector_at(vector, 0)) ? "sí" : "no");
+    cvector_get(vector, 999, &temp_record);
+    printf("Elemento 999: seq = %u, lectura fuera de rango (retorna %d)\n", temp_record.seq, cvector_get(vector, 5000, &temp_record));
+
+    // Inserciones concurrentes mientras el hilo principal consume el vector en orden:
+    pthread_t threads[TEST_THREADS];
+    struct test_args args[TEST_THREADS];
+    for (uint32_t i = 0; i < TEST_THREADS; i++){
+        args[i] = (struct test_args){.vector = vector, .thread = i + 1};
+        pthread_create(&threads[i], NULL, append_thread, &args[i]);
+    }
+
+    size_t total = 1000 + (size_t)TEST_THREADS * TEST_RECORDS;
+    uint32_t next_seq[TEST_THREADS + 1] = {1000};
+    size_t consumed = 1000;
+    size_t out_of_order = 0;
+    while (consumed < total){
+        size_t end = cvector_published_prefix(vector, consumed);
+        for (; consumed < end; consumed++){
+            const struct record * temp_element = (const struct record *)cvector_at(vector, consumed);
+            if (temp_element->seq != next_seq[temp_element->thread]++){
+                out_of_order++;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < TEST_THREADS; i++){
+        pthread_join(threads[i], NULL);
+    }
+    printf("\n%d hilos x %d registros: consumidos %ld de %ld, fuera de orden por hilo: %ld\n",
+           TEST_THREADS, TEST_RECORDS, consumed, cvector_size(vector), out_of_order);
+
+    // Destrucción del vector:
+    cvector_deinit(&vector);
+    printf("\nVector destruido, referencia: %p\n", (void *)vector);
+
+    return 0;
+}
+
+/*
+    @brief Función del hilo escritor: inserta TEST_RECORDS registros numerados.
+
+    @param void * arg: Referencia a los argumentos (struct test_args).
+
+    @retval void *: NULL.
+*/
+void * append_thread(void * arg){
+    struct test_args * args = (struct test_args *)arg;
+    for (uint32_t i = 0; i < TEST_RECORDS; i++){
+        struct record temp_record = {args->thread, i};
+        cvector_push_back(args->vector, &temp_record);
+    }
+
+    return NULL;
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+#include "gapbuf.h"
+#include <stdio.h>
+
+// Prototipos de funciones:
+void print_text(const gapbuf_pt gapbuf);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de un gap buffer de caracteres:
+    gapbuf_pt text = gapbuf_init(sizeof(char));
+    printf("\nSe ha creado el gap buffer correctamente en la dirección (%p)\n", (void *)text);
+
+    // Escritura al final y edición en el centro:
+    gapbuf_insert_n(text, "Hola mundo", 10);
+    print_text(text);
+
+    gapbuf_set_cursor(text, 4);
+    gapbuf_insert_n(text, ", querido", 9);
+    print_text(text);
+
+    gapbuf_delete_before(text, 9);
+    gapbuf_insert(text, ",");
+    print_text(text);
+
+    gapbuf_set_cursor(text, 0);
+    gapbuf_delete_after(text, 1);
+    gapbuf_insert_n(text, "¡h", 3);
+    gapbuf_set_cursor(text, gapbuf_size(text));
+    gapbuf_insert(text, "!");
+    print_text(text);
+
+    // Acceso por índice (el hueco no es visible) y errores de rango:
+    char c;
+    gapbuf_set_cursor(text, 5);
+    gapbuf_get(text, 5, &c);
+    printf("\nElemento en el índice 5 con el cursor en 5: '%c'\n", c);
+    printf("Acceso fuera de rango: get %u, at (%p)\n", gapbuf_get(text, gapbuf_size(text), &c), gapbuf_at(text, gapbuf_size(text)));
+    printf("Errores: cursor fuera de rango %u, borrar antes %u, borrar después %u\n", gapbuf_set_cursor(text, 100),
+           gapbuf_delete_before(text, 6), gapbuf_delete_after(text, 100));
+
+    // Exportación a un array contiguo:
+    array_pt out = array_init(sizeof(char));
+    gapbuf_export(text, out);
+    printf("\nExportado a array (%ld elementos): %.*s\n", out->size, (int)out->size, (char *)out->arr);
+    array_pt wrong = array_init(sizeof(int32_t));
+    printf("Exportación a un array de otro tamaño de elemento: %u\n", gapbuf_export(text, wrong));
+    array_deinit(wrong);
+    array_deinit(out);
+    gapbuf_deinit(&text);
+
+    // Comprobación masiva: ediciones aleatorias frente a un array plano con desplazamientos completos:
+    gapbuf_pt numbers = gapbuf_init(sizeof(uint32_t));
+    size_t n = 200000;
+    uint32_t * naive = (uint32_t *)malloc(n * sizeof(uint32_t));
+    size_t size = 0, cursor = 0, errors = 0;
+    uint32_t seed = 12345;
+    for (uint32_t i = 0; i < n; i++){
+        seed = seed * 1103515245 + 12345;
+        uint32_t op = (seed >> 16) % 10;
+        if ((op < 6) || (size == 0)){
+            errors += (gapbuf_insert(numbers, &i) != 0);
+            memmove(&naive[cursor + 1], &naive[cursor], (size - cursor) * sizeof(uint32_t));
+            naive[cursor++] = i;
+            size++;
+        } else if ((op == 6) && (cursor > 0)){
+            errors += (gapbuf_delete_before(numbers, 1) != 0);
+            memmove(&naive[cursor - 1], &naive[cursor], (size - cursor) * sizeof(uint32_t));
+            cursor--;
+            size--;
+        } else if ((op == 7) && (cursor < size)){
+            errors += (gapbuf_delete_after(numbers, 1) != 0);
+            memmove(&naive[cursor], &naive[cursor + 1], (size - cursor - 1) * sizeof(uint32_t));
+            size--;
+        } else {
+            cursor = (seed >> 4) % (size + 1);
+            errors += (gapbuf_set_cursor(numbers, cursor) != 0);
+        }
+    }
+
+    array_pt exported = array_init(sizeof(uint32_t));
+    gapbuf_export(numbers, exported);
+    errors += (gapbuf_size(numbers) != size) || (gapbuf_cursor(numbers) != cursor) || (exported->size != size);
+    for (size_t i = 0; i < size; i++){
+        uint32_t value;
+        gapbuf_get(numbers, i, &value);
+        errors += (value != naive[i]) || (((uint32_t *)exported->arr)[i] != naive[i]);
+    }
+    printf("\nEdiciones aleatorias: %ld, elementos finales: %ld (capacidad %ld), errores: %ld\n", n, size, gapbuf_capacity(numbers), errors);
+
+    free(naive);
+    array_deinit(exported);
+    gapbuf_deinit(&numbers);
+    printf("Dirección del buffer tras destruirlo: (%p)\n", (void *)numbers);
+
+    return 0;
+}
+
+/*
+    @brief Función para mostrar el texto del buffer marcando la posición del cursor con '|'.
+
+    @param const gapbuf_pt gapbuf: Referencia al buffer de caracteres.
+
+    @retval None.
+*/
+void print_text(const gapbuf_pt gapbuf){
+    printf("\"");
+    for (size_t i = 0; i < gapbuf_size(gapbuf); i++){
+        if (i == gapbuf_cursor(gapbuf)){
+            printf("|");
+        }
+        printf("%c", *(char *)gapbuf_at(gapbuf, i));
+    }
+    if (gapbuf_cursor(gapbuf) == gapbuf_size(gapbuf)){
+        printf("|");
+    }
+    printf("\" (tamaño %ld, cursor %ld, capacidad %ld)\n", gapbuf_size(gapbuf), gapbuf_cursor(gapbuf), gapbuf_capacity(gapbuf));
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include "seqarray.h"
+#include <stdio.h>
+#include <pthread.h>
+
+#define TEST_READERS 3
+#define TEST_ELEMENTS 64
+#define TEST_ROUNDS 20000
+
+struct test_args{
+    seqarray_pt array;              // Array compartido.
+    atomic_bool * done;             // Indica a los lectores que terminen.
+    size_t reads;                   // Instantáneas leídas por el hilo.
+    size_t torn;                    // Instantáneas con elementos de rondas distintas.
+};
+
+// Prototipos de funciones:
+void * reader_thread(void * arg);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de un array de uint64_t:
+    seqarray_pt array = seqarray_init(sizeof(uint64_t));
+    printf("\nSe ha creado el array correctamente en la dirección (%p)\n", (void *)array);
+
+    // Escrituras sueltas y lecturas:
+    for (uint64_t i = 0; i < 5; i++){
+        uint64_t value = i * 100;
+        seqarray_set(array, &value, i);
+    }
+    uint64_t value;
+    seqarray_get(array, 3, &value);
+    printf("Elemento 3: %lu, tamaño: %ld, capacidad: %ld\n", value, seqarray_size(array), seqarray_capacity(array));
+    printf("Lectura fuera de rango (retorna %d)\n", seqarray_get(array, 10, &value));
+
+    // Crecimiento del buffer: el antiguo se retira y se libera al destruir el array:
+    value = 7;
+    seqarray_set(array, &value, 100);
+    printf("Tras escribir en la posición 100 -> tamaño: %ld, capacidad: %ld\n", seqarray_size(array), seqarray_capacity(array));
+
+    // Reservas de una en una: cada ampliación al menos duplica, así que los buffers retirados suman menos que el actual:
+    for (size_t capacity = seqarray_capacity(array) + 1; capacity <= 3032; capacity++){
+        seqarray_reserve(array, capacity);
+    }
+    size_t retired = 0;
+    for (seq_buffer_pt buffer = atomic_load(&array->buffer)->prev; buffer != NULL; buffer = buffer->prev){
+        retired += buffer->capacity;
+    }
+    printf("Tras reservar de una en una hasta 3032 -> capacidad: %ld, elementos retirados: %ld\n", seqarray_capacity(array), retired);
+    printf("Escritura en la posición SIZE_MAX - 1 (retorna %d)\n", seqarray_set(array, &value, SIZE_MAX - 1));
+
+    // Un escritor actualiza todos los elementos en lotes mientras varios lectores toman instantáneas:
+    uint64_t round = 0;
+    seqarray_write_begin(array);
+    for (size_t i = 0; i < TEST_ELEMENTS; i++){
+        seqarray_set(array, &round, i);
+    }
+    seqarray_write_end(array);
+
+    atomic_bool done = false;
+    pthread_t readers[TEST_READERS];
+    struct test_args args[TEST_READERS];
+    for (size_t i = 0; i < TEST_READERS; i++){
+        args[i] = (struct test_args){.array = array, .done = &done, .reads = 0, .torn = 0};
+        pthread_create(&readers[i], NULL, reader_thread, &args[i]);
+    }
+
+    for (round = 1; round <= TEST_ROUNDS; round++){
+        seqarray_write_begin(array);
+        for (size_t i = 0; i < TEST_ELEMENTS; i++){
+            seqarray_set(array, &round, i);
+        }
+        seqarray_write_end(array);
+    }
+    atomic_store(&done, true);
+
+    size_t reads = 0;
+    size_t torn = 0;
+    for (size_t i = 0; i < TEST_READERS; i++){
+        pthread_join(readers[i], NULL);
+        reads += args[i].reads;
+        torn += args[i].torn;
+    }
+    printf("\n%d lotes de %d elementos con %d lectores: %ld instantáneas, incoherentes: %ld\n",
+           TEST_ROUNDS, TEST_ELEMENTS, TEST_READERS, reads, torn);
+
+    // Destrucción del array:
+    seqarray_deinit(&array);
+    printf("\nArray destruido, referencia: %p\n", (void *)array);
+
+    return 0;
+}
+
+/*
+    @brief Función del hilo lector: toma instantáneas de los primeros TEST_ELEMENTS elementos y comprueba que son de la misma ronda.
+
+    @param void * arg: Referencia a los argumentos (struct test_args).
+
+    @retval void *: NULL.
+*/
+void * reader_thread(void * arg){
+    struct test_args * args = (struct test_args *)arg;
+    uint64_t snapshot[TEST_ELEMENTS];
+    while (!atomic_load(args->done)){
+        if (seqarray_get_range(args->array, 0, TEST_ELEMENTS, snapshot) == 0){
+            for (size_t i = 1; i < TEST_ELEMENTS; i++){
+                if (snapshot[i] != snapshot[0]){
+                    args->torn++;
+                    break;
+                }
+            }
+            args->reads++;
+        }
+    }
+
+    return NULL;
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "slotmap.h"
+#include <stdio.h>
+
+struct entity{
+    uint32_t id;                    // Identificador de la entidad.
+    float x;                        // Posición horizontal.
+    float y;                        // Posición vertical.
+};
+
+// Prototipos de funciones:
+void print_dense(const slotmap_pt slotmap);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de un slot map de entidades:
+    slotmap_pt slotmap = slotmap_init(sizeof(struct entity));
+    printf("\nSe ha creado el slot map correctamente en la dirección (%p)\n", (void *)slotmap);
+
+    // Inserción de entidades (cada una con su manejador):
+    uint64_t handles[6];
+    for (uint32_t i = 0; i < 6; i++){
+        struct entity temp_entity = {.id = i, .x = i * 1.5f, .y = i * -2.0f};
+        slotmap_insert(slotmap, &temp_entity, &handles[i]);
+        printf("Entidad %u -> manejador 0x%016lx (ranura %u, generación %u)\n", i, handles[i], (uint32_t)handles[i], (uint32_t)(handles[i] >> 32));
+    }
+    print_dense(slotmap);
+
+    // Eliminación en el centro (el último elemento ocupa el hueco) y acceso por manejador:
+    struct entity temp_entity;
+    slotmap_remove(slotmap, handles[1], &temp_entity);
+    printf("\nEliminada la entidad %u\n", temp_entity.id);
+    print_dense(slotmap);
+
+    slotmap_get(slotmap, handles[5], &temp_entity);
+    printf("Acceso por el manejador de la entidad 5: id %u, (%.1f, %.1f)\n", temp_entity.id, temp_entity.x, temp_entity.y);
+    ((struct entity *)slotmap_at(slotmap, handles[5]))->x = 100.0f;
+    printf("Entidad 5 modificada en sitio: x = %.1f\n", ((struct entity *)slotmap_at(slotmap, handles[5]))->x);
+
+    // Detección de manejadores antiguos (la ranura liberada se reutiliza con otra generación):
+    temp_entity = (struct entity){.id = 42, .x = 0.0f, .y = 0.0f};
+    uint64_t reused;
+    slotmap_insert(slotmap, &temp_entity, &reused);
+    printf("\nNueva entidad 42 -> manejador 0x%016lx (ranura %u, generación %u)\n", reused, (uint32_t)reused, (uint32_t)(reused >> 32));
+    printf("Manejador antiguo de la entidad 1 válido: %d (get: %u, remove: %u)\n", slotmap_contains(slotmap, handles[1]),
+           slotmap_get(slotmap, handles[1], &temp_entity), slotmap_remove(slotmap, handles[1], NULL));
+    printf("Manejador nulo válido: %d\n", slotmap_contains(slotmap, SLOTMAP_NULL_HANDLE));
+
+    // Recorrido contiguo del almacenamiento denso con el manejador de cada posición:
+    struct entity * entities = (struct entity *)slotmap_data(slotmap);
+    printf("\nRecorrido denso:\n");
+    for (size_t i = 0; i < slotmap_size(slotmap); i++){
+        printf("\t-> [%ld] id %u, manejador 0x%016lx\n", i, entities[i].id, slotmap_handle_at(slotmap, i));
+    }
+
+    // Comprobación masiva: inserción y eliminación alternas con verificación de todos los manejadores vivos:
+    slotmap_pt many = slotmap_init(sizeof(uint32_t));
+    size_t n = 100000;
+    uint64_t * many_handles = (uint64_t *)malloc(n * sizeof(uint64_t));
+    size_t errors = 0;
+    for (uint32_t i = 0; i < n; i++){
+        slotmap_insert(many, &i, &many_handles[i]);
+    }
+    for (size_t i = 0; i < n; i += 2){
+        slotmap_remove(many, many_handles[i], NULL);
+    }
+    for (uint32_t i = 0; i < n; i++){
+        uint32_t value;
+        bool present = (slotmap_get(many, many_handles[i], &value) == 0);
+        errors += (present != (i % 2 == 1)) || (present && (value != i));
+    }
+    printf("\nElementos: %ld de %ld, errores de manejador: %ld\n", slotmap_size(many), n, errors);
+    free(many_handles);
+    slotmap_deinit(&many);
+
+    // Limpieza (invalida todos los manejadores):
+    slotmap_clear(slotmap);
+    printf("\nTras limpiar: %ld elementos, manejador de la entidad 42 válido: %d\n", slotmap_size(slotmap), slotmap_contains(slotmap, reused));
+    printf("Tamaño de elemento: %ld\n", slotmap_element_size(slotmap));
+
+    // Destrucción del slot map:
+    slotmap_deinit(&slotmap);
+    printf("Dirección del slot map tras destruirlo: (%p)\n", (void *)slotmap);
+
+    return 0;
+}
+
+/*
+    @brief Función que muestra los identificadores del almacenamiento denso en orden.
+
+    @param const slotmap_pt slotmap: Referencia al slot map.
+
+    @retval None.
+*/
+void print_dense(const slotmap_pt slotmap){
+    struct entity * entities = (struct entity *)slotmap_data(slotmap);
+    printf("Almacenamiento denso: [ ");
+    for (size_t i = 0; i < slotmap_size(slotmap); i++){
+        printf("%u ", entities[i].id);
+    }
+    printf("]\n");
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+#include "btree.h"
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_MULT 2654435761u          // Multiplicador impar: i -> i * BENCH_MULT es una biyección sobre uint32_t.
+
+// Prototipos de funciones:
+double elapsed_ms(struct timespec start, struct timespec end);
+int cmp_u32(const void * a, const void * b);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Número de elementos y de búsquedas (por argumento o por defecto):
+    size_t n = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000000;
+    size_t lookups = (argc > 2) ? strtoul(argv[2], NULL, 10) : 1000000;
+    if (n == 0){
+        n = 1;
+    }
+
+    // Referencia: búsqueda binaria sobre un array ordenado de las mismas claves:
+    uint32_t * sorted = (uint32_t *)malloc(n * sizeof(uint32_t));
+    if (sorted == NULL){
+        return 1;
+    }
+    for (size_t i = 0; i < n; i++){
+        sorted[i] = (uint32_t)i * BENCH_MULT;
+    }
+    qsort(sorted, n, sizeof(uint32_t), cmp_u32);
+
+    struct timespec start, end;
+    uint64_t check_ref = 0;
+    uint32_t seed = 12345;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < lookups; i++){
+        seed = seed * 1103515245 + 12345;
+        uint32_t key = (uint32_t)(seed % n) * BENCH_MULT;
+        uint32_t * found = (uint32_t *)bsearch(&key, sorted, n, sizeof(uint32_t), cmp_u32);
+        check_ref += (found != NULL) ? (*found ^ 0x5A5A) : 0;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double ref_find = elapsed_ms(start, end);
+    free(sorted);
+
+    printf("\nElementos: %ld (uint32 -> uint32), búsquedas aleatorias: %ld\n", n, lookups);
+    printf("%-18s %8s %14s %14s %14s\n", "", "altura", "inserción(ms)", "búsqueda(ms)", "Mbúsquedas/s");
+    printf("%-18s %8s %14s %14.3f %14.2f\n", "bsearch ordenado", "-", "-", ref_find, lookups / (ref_find * 1e3));
+
+    // Árboles con distintos tamaños de nodo (inserción en orden pseudoaleatorio y búsquedas de claves presentes):
+    size_t node_bytes[] = {64, 256, 1024, 4096};
+    bool correct = true;
+    for (size_t t = 0; t < sizeof(node_bytes) / sizeof(node_bytes[0]); t++){
+        btree_pt tree = btree_init(sizeof(uint32_t), sizeof(uint32_t), node_bytes[t], cmp_u32);
+        if (tree == NULL){
+            return 1;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (size_t i = 0; i < n; i++){
+            uint32_t key = (uint32_t)i * BENCH_MULT;
+            uint32_t value = key ^ 0x5A5A;
+            btree_insert(tree, &key, &value);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        double tree_build = elapsed_ms(start, end);
+
+        uint64_t check_tree = 0;
+        seed = 12345;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (size_t i = 0; i < lookups; i++){
+            seed = seed * 1103515245 + 12345;
+            uint32_t key = (uint32_t)(seed % n) * BENCH_MULT;
+            uint32_t value;
+            check_tree += (btree_find(tree, &key, &value) == 0) ? value : 0;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        double tree_find = elapsed_ms(start, end);
+
+        char label[32];
+        snprintf(label, sizeof(label), "btree nodo=%ld", node_bytes[t]);
+        printf("%-18s %8ld %14.3f %14.3f %14.2f\n", label, btree_height(tree), tree_build, tree_find, lookups / (tree_find * 1e3));
+
+        correct = correct && (check_tree == check_ref) && (btree_size(tree) == n);
+        btree_deinit(&tree);
+    }
+
+    printf("\nComprobación de resultados: %s\n", correct ? "correcta" : "INCORRECTA");
+
+    return 0;
+}
+
+/*
+    @brief Función que calcula el tiempo transcurrido entre dos marcas de tiempo.
+
+    @param struct timespec start: Marca de inicio.
+    @param struct timespec end: Marca de fin.
+
+    @retval double: Tiempo transcurrido en milisegundos.
+*/
+double elapsed_ms(struct timespec start, struct timespec end){
+    return (double)(end.tv_sec - start.tv_sec) * 1e3 + (double)(end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+/*
+    @brief Función de comparación de claves uint32_t (estilo qsort).
+
+    @param const void * a: Referencia a la primera clave.
+    @param const void * b: Referencia a la segunda clave.
+
+    @retval int: <0, 0 o >0 si a es menor, igual o mayor que b.
+*/
+int cmp_u32(const void * a, const void * b){
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
\ No newline at end of file
@@ -0,0 +1,1202 @@
+#include "btree.h"
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static size_t _btree_natural_align(size_t size);
+static size_t _btree_align_up(size_t size, size_t align);
+static inline uint8_t * _btree_key(const btree_pt tree, btree_node_pt node, size_t index);
+static inline uint8_t * _btree_value(const btree_pt tree, btree_node_pt node, size_t index);
+static inline btree_node_pt * _btree_children(const btree_pt tree, btree_node_pt node);
+static btree_node_pt _btree_new_node(const btree_pt tree, size_t level);
+static void _btree_free_subtree(const btree_pt tree, btree_node_pt node);
+static size_t _btree_node_lower_bound(const btree_pt tree, btree_node_pt node, const void * key);
+static size_t _btree_node_upper_bound(const btree_pt tree, btree_node_pt node, const void * key);
+static btree_node_pt _btree_find_leaf(const btree_pt tree, const void * key);
+static void _btree_leaf_insert_at(const btree_pt tree, btree_node_pt leaf, size_t pos, const void * key, const void * value);
+static void _btree_inner_insert_at(const btree_pt tree, btree_node_pt node, size_t pos, const void * key, btree_node_pt child);
+static void _btree_split_leaf(const btree_pt tree, btree_node_pt leaf, btree_node_pt right, size_t pos, const void * key, const void * value);
+static void _btree_split_inner(const btree_pt tree, btree_node_pt node, btree_node_pt right, size_t pos, const void * key, btree_node_pt child, void * out_up);
+static void _btree_borrow_left(const btree_pt tree, btree_node_pt parent, size_t index);
+static void _btree_borrow_right(const btree_pt tree, btree_node_pt parent, size_t index);
+static void _btree_merge(const btree_pt tree, btree_node_pt parent, size_t index);
+static void _btree_build_level(size_t count, size_t groups, size_t group, size_t * out_first, size_t * out_count);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar un árbol B+ (mapa ordenado) con claves y valores de tamaño fijo.
+    @note: El número de claves por nodo se calcula para que cada nodo ocupe aproximadamente node_bytes (líneas de caché o páginas).
+
+    @param size_t key_size: Tamaño (en bytes) de la clave.
+    @param size_t value_size: Tamaño (en bytes) del valor.
+    @param size_t node_bytes: Tamaño objetivo de un nodo [BTREE_MIN_NODE_BYTES, BTREE_MAX_NODE_BYTES] (0 = BTREE_DEFAULT_NODE_BYTES).
+    @param int (*cmp_fn)(const void *, const void *): Referencia a la función comparadora de claves (<0, 0, >0 al estilo de qsort).
+
+    @retval btree_pt: Referencia al árbol creado.
+*/
+btree_pt btree_init(size_t key_size, size_t value_size, size_t node_bytes, int (*cmp_fn)(const void *, const void *)){
+    // Comprobación de los límites de tamaño de clave, valor y nodo, y de la función comparadora:
+    if ((key_size < MIN_ELEMENT_SIZE) || (key_size > MAX_ELEMENT_SIZE) || (value_size < MIN_ELEMENT_SIZE) || (value_size > MAX_ELEMENT_SIZE) || (cmp_fn == NULL)){
+        return NULL;
+    }
+
+    if (node_bytes == 0){
+        node_bytes = BTREE_DEFAULT_NODE_BYTES;
+    }
+
+    if ((node_bytes < BTREE_MIN_NODE_BYTES) || (node_bytes > BTREE_MAX_NODE_BYTES)){
+        return NULL;
+    }
+
+    // Reserva de memoria para la estructura básica del árbol:
+    btree_pt tree = (btree_pt)malloc(sizeof(btree_t));
+    if (tree == NULL){
+        return NULL;
+    }
+
+    // Cálculo del número de claves por nodo y de la disposición de hojas y nodos internos:
+    size_t header = offsetof(btree_node_t, keys);
+    size_t usable = (node_bytes > header) ? node_bytes - header : 0;
+
+    tree->leaf_max = usable / (key_size + value_size);
+    if (tree->leaf_max < BTREE_MIN_NODE_KEYS){
+        tree->leaf_max = BTREE_MIN_NODE_KEYS;
+    }
+
+    tree->inner_max = (usable > sizeof(btree_node_pt)) ? (usable - sizeof(btree_node_pt)) / (key_size + sizeof(btree_node_pt)) : 0;
+    if (tree->inner_max < BTREE_MIN_NODE_KEYS){
+        tree->inner_max = BTREE_MIN_NODE_KEYS;
+    }
+
+    tree->key_size = key_size;
+    tree->value_size = value_size;
+    tree->leaf_values_offset = _btree_align_up(header + (tree->leaf_max * key_size), _btree_natural_align(value_size));
+    tree->inner_children_offset = _btree_align_up(header + (tree->inner_max * key_size), sizeof(btree_node_pt));
+    tree->leaf_bytes = tree->leaf_values_offset + (tree->leaf_max * value_size);
+    tree->inner_bytes = tree->inner_children_offset + ((tree->inner_max + 1) * sizeof(btree_node_pt));
+    tree->size = 0;
+    tree->height = 1;
+    tree->cmp_fn = cmp_fn;
+
+    // Creación de la raíz (hoja vacía):
+    tree->root = _btree_new_node(tree, 0);
+    if (tree->root == NULL){
+        free(tree);
+        return NULL;
+    }
+
+    return tree;
+}
+
+/*
+    @brief Función para destruir y liberar un árbol B+.
+
+    @param btree_pt * tree: Referencia a la referencia del árbol.
+
+    @retval None.
+*/
+void btree_deinit(btree_pt * tree){
+    // Comprobación de que el árbol no sea nulo:
+    if ((tree == NULL) || (*tree == NULL)){
+        return;
+    }
+
+    // Liberación de todos los nodos y de la estructura:
+    _btree_free_subtree(*tree, (*tree)->root);
+    free(*tree);
+    *tree = NULL;
+}
+
+/*
+    @brief Función para eliminar todos los elementos del árbol, dejando una raíz vacía.
+
+    @param btree_pt tree: Referencia al árbol.
+
+    @retval None.
+*/
+void btree_clear(btree_pt tree){
+    // Comprobación de árbol válido:
+    if (tree == NULL){
+        return;
+    }
+
+    // Liberación de todos los nodos excepto la hoja más a la izquierda, que pasa a ser la raíz vacía:
+    btree_node_pt temp_current_node = tree->root;
+    while ((temp_current_node->level != 0)){
+        btree_node_pt * children = _btree_children(tree, temp_current_node);
+        for (size_t i = 1; i <= temp_current_node->count; i++){
+            _btree_free_subtree(tree, children[i]);
+        }
+        btree_node_pt temp_child_node = children[0];
+        free(temp_current_node);
+        temp_current_node = temp_child_node;
+    }
+
+    temp_current_node->count = 0;
+    temp_current_node->next = NULL;
+    tree->root = temp_current_node;
+    tree->size = 0;
+    tree->height = 1;
+}
+
+/*
+    @brief Función para cargar un árbol vacío, en O(n), a partir de un array de entradas (clave | valor) ordenadas por clave.
+    @note: Las hojas y nodos internos se reparten uniformemente y quedan casi llenos, lo que favorece los recorridos por rango.
+
+    @param btree_pt tree: Referencia al árbol (vacío).
+    @param const array_pt entries: Referencia al array de entradas, de element_size = key_size + value_size y en orden estrictamente creciente.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Árbol o array no válidos (o tamaño de elemento distinto de clave + valor).
+                -> 2: Error de reserva de memoria (el árbol queda vacío).
+                -> 3: El árbol no está vacío o las entradas no están en orden estrictamente creciente.
+*/
+uint8_t btree_bulk_load(btree_pt tree, const array_pt entries){
+    // Comprobación de árbol y array válidos:
+    if ((tree == NULL) || (entries == NULL) || (entries->element_size != (tree->key_size + tree->value_size))){
+        return 1;
+    }
+
+    // Comprobación de árbol vacío y de entradas ordenadas:
+    if (tree->size != 0){
+        return 3;
+    }
+
+    size_t n = entries->size;
+    const uint8_t * entry = (const uint8_t *)entries->arr;
+    for (size_t i = 1; i < n; i++){
+        if (tree->cmp_fn(entry + ((i - 1) * entries->element_size), entry + (i * entries->element_size)) >= 0){
+            return 3;
+        }
+    }
+
+    if (n == 0){
+        return 0;
+    }
+
+    // Reserva de los niveles (nodos del nivel actual y su clave mínima):
+    size_t count = (n + tree->leaf_max - 1) / tree->leaf_max;
+    btree_node_pt * level = (btree_node_pt *)malloc(count * sizeof(btree_node_pt));
+    const uint8_t ** firsts = (const uint8_t **)malloc(count * sizeof(const uint8_t *));
+    if ((level == NULL) || (firsts == NULL)){
+        free(level);
+        free(firsts);
+        return 2;
+    }
+
+    // Construcción de las hojas, repartiendo las entradas uniformemente y enlazándolas:
+    size_t first;
+    size_t take;
+    size_t built = 0;
+    for (size_t i = 0; i < count; i++){
+        level[i] = _btree_new_node(tree, 0);
+        if (level[i] == NULL){
+            break;
+        }
+        built++;
+
+        _btree_build_level(n, count, i, &first, &take);
+        for (size_t j = 0; j < take; j++){
+            memcpy(_btree_key(tree, level[i], j), entry + ((first + j) * entries->element_size), tree->key_size);
+            memcpy(_btree_value(tree, level[i], j), entry + ((first + j) * entries->element_size) + tree->key_size, tree->value_size);
+        }
+        level[i]->count = take;
+        firsts[i] = _btree_key(tree, level[i], 0);
+
+        if (i > 0){
+            level[i - 1]->next = level[i];
+        }
+    }
+
+    // Construcción de los niveles internos, de abajo arriba, hasta obtener una única raíz:
+    size_t height = 1;
+    while ((built == count) && (count > 1)){
+        size_t parents = (count + tree->inner_max) / (tree->inner_max + 1);
+        size_t parents_built = 0;
+        btree_node_pt temp_parent_node;
+
+        for (size_t i = 0; i < parents; i++){
+            temp_parent_node = _btree_new_node(tree, height);
+            if (temp_parent_node == NULL){
+                break;
+            }
+
+            // Los hijos del padre i ocupan posiciones ya consumidas del nivel, por lo que se reutiliza el mismo array:
+            _btree_build_level(count, parents, i, &first, &take);
+            btree_node_pt * children = _btree_children(tree, temp_parent_node);
+            for (size_t j = 0; j < take; j++){
+                children[j] = level[first + j];
+                if (j > 0){
+                    memcpy(_btree_key(tree, temp_parent_node, j - 1), firsts[first + j], tree->key_size);
+                }
+            }
+            temp_parent_node->count = take - 1;
+
+            level[i] = temp_parent_node;
+            firsts[i] = firsts[first];
+            parents_built++;
+        }
+
+        // Fallo de reserva: los padres construidos ya apuntan a sus hijos; se liberan todos los subárboles:
+        if (parents_built < parents){
+            for (size_t i = 0; i < parents_built; i++){
+                _btree_free_subtree(tree, level[i]);
+            }
+            _btree_build_level(count, parents, parents_built, &first, &take);
+            for (size_t i = first; i < count; i++){
+                _btree_free_subtree(tree, level[i]);
+            }
+            built = 0;
+            count = 0;
+            break;
+        }
+
+        count = parents;
+        built = parents;
+        height++;
+    }
+
+    // Fallo de reserva en las hojas: liberación de las construidas:
+    if (built != count){
+        for (size_t i = 0; i < built; i++){
+            free(level[i]);
+        }
+        count = 0;
+    }
+
+    if (count == 0){
+        free(level);
+        free(firsts);
+        return 2;
+    }
+
+    // Sustitución de la raíz vacía por la construida:
+    free(tree->root);
+    tree->root = level[0];
+    tree->size = n;
+    tree->height = height;
+
+    free(level);
+    free(firsts);
+
+    return 0;
+}
+
+/*
+    @brief Función para insertar un par clave-valor, o actualizar el valor si la clave ya existe.
+    @note: Antes de modificar el árbol se reservan todos los nodos que requieren las divisiones, por lo que un fallo de memoria no lo altera.
+
+    @param btree_pt tree: Referencia al árbol.
+    @param const void * key: Referencia a la clave.
+    @param const void * value: Referencia al valor.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Árbol, clave o valor no válidos.
+                -> 2: Error de reserva de memoria.
+*/
+uint8_t btree_insert(btree_pt tree, const void * key, const void * value){
+    // Comprobación de árbol, clave y valor válidos:
+    if ((tree == NULL) || (key == NULL) || (value == NULL)){
+        return 1;
+    }
+
+    // Descenso hasta la hoja guardando el camino:
+    btree_node_pt path[BTREE_MAX_HEIGHT];
+    size_t path_index[BTREE_MAX_HEIGHT];
+    size_t depth = 0;
+    btree_node_pt temp_current_node = tree->root;
+    while ((temp_current_node->level != 0)){
+        path[depth] = temp_current_node;
+        path_index[depth] = _btree_node_upper_bound(tree, temp_current_node, key);
+        temp_current_node = _btree_children(tree, temp_current_node)[path_index[depth]];
+        depth++;
+    }
+
+    // Caso de clave existente (actualización del valor):
+    size_t pos = _btree_node_lower_bound(tree, temp_current_node, key);
+    if ((pos < temp_current_node->count) && (tree->cmp_fn(_btree_key(tree, temp_current_node, pos), key) == 0)){
+        memcpy(_btree_value(tree, temp_current_node, pos), value, tree->value_size);
+        return 0;
+    }
+
+    // Caso de hoja con espacio libre:
+    if (temp_current_node->count < tree->leaf_max){
+        _btree_leaf_insert_at(tree, temp_current_node, pos, key, value);
+        tree->size++;
+        return 0;
+    }
+
+    // Reserva previa de los nodos necesarios (hoja, nodos internos llenos del camino y nueva raíz si procede):
+    btree_node_pt spare[BTREE_MAX_HEIGHT + 1];
+    size_t needed = 1;
+    size_t level = depth;
+    while ((level > 0) && (path[level - 1]->count == tree->inner_max)){
+        needed++;
+        level--;
+    }
+    if (level == 0){
+        needed++;
+    }
+
+    for (size_t i = 0; i < needed; i++){
+        spare[i] = _btree_new_node(tree, i);
+        if (spare[i] == NULL){
+            for (size_t j = 0; j < i; j++){
+                free(spare[j]);
+            }
+            return 2;
+        }
+    }
+
+    // División de la hoja y propagación de la clave separadora hacia arriba:
+    uint8_t separator[MAX_ELEMENT_SIZE];
+    uint8_t up[MAX_ELEMENT_SIZE];
+    size_t used = 0;
+    btree_node_pt temp_right_node = spare[used++];
+    _btree_split_leaf(tree, temp_current_node, temp_right_node, pos, key, value);
+    memcpy(separator, _btree_key(tree, temp_right_node, 0), tree->key_size);
+
+    while (depth > 0){
+        depth--;
+        btree_node_pt temp_parent_node = path[depth];
+
+        if (temp_parent_node->count < tree->inner_max){
+            _btree_inner_insert_at(tree, temp_parent_node, path_index[depth], separator, temp_right_node);
+            temp_right_node = NULL;
+            break;
+        }
+
+        btree_node_pt temp_new_node = spare[used++];
+        _btree_split_inner(tree, temp_parent_node, temp_new_node, path_index[depth], separator, temp_right_node, up);
+        memcpy(separator, up, tree->key_size);
+        temp_right_node = temp_new_node;
+    }
+
+    // División de la raíz: nueva raíz con los dos nodos resultantes:
+    if (temp_right_node != NULL){
+        btree_node_pt temp_root_node = spare[used++];
+        memcpy(_btree_key(tree, temp_root_node, 0), separator, tree->key_size);
+        _btree_children(tree, temp_root_node)[0] = tree->root;
+        _btree_children(tree, temp_root_node)[1] = temp_right_node;
+        temp_root_node->count = 1;
+        tree->root = temp_root_node;
+        tree->height++;
+    }
+
+    tree->size++;
+
+    return 0;
+}
+
+/*
+    @brief Función que busca una clave y copia su valor en la variable indicada.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param const void * key: Referencia a la clave.
+    @param void * out_value: Referencia a la variable donde se copiará el valor (puede ser nulo para comprobar pertenencia).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores (clave encontrada).
+                -> 1: Árbol o clave no válidos.
+                -> 2: La clave no está en el árbol.
+*/
+uint8_t btree_find(const btree_pt tree, const void * key, void * out_value){
+    // Comprobación de árbol y clave válidos:
+    if ((tree == NULL) || (key == NULL)){
+        return 1;
+    }
+
+    // Descenso hasta la hoja y búsqueda de la clave:
+    btree_node_pt temp_leaf_node = _btree_find_leaf(tree, key);
+    size_t pos = _btree_node_lower_bound(tree, temp_leaf_node, key);
+    if ((pos == temp_leaf_node->count) || (tree->cmp_fn(_btree_key(tree, temp_leaf_node, pos), key) != 0)){
+        return 2;
+    }
+
+    if (out_value != NULL){
+        memcpy(out_value, _btree_value(tree, temp_leaf_node, pos), tree->value_size);
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función para eliminar una clave (y su valor) del árbol, redistribuyendo o fusionando nodos si quedan por debajo de la mitad.
+
+    @param btree_pt tree: Referencia al árbol.
+    @param const void * key: Referencia a la clave.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Árbol o clave no válidos.
+                -> 2: La clave no está en el árbol.
+*/
+uint8_t btree_erase(btree_pt tree, const void * key){
+    // Comprobación de árbol y clave válidos:
+    if ((tree == NULL) || (key == NULL)){
+        return 1;
+    }
+
+    // Descenso hasta la hoja guardando el camino:
+    btree_node_pt path[BTREE_MAX_HEIGHT];
+    size_t path_index[BTREE_MAX_HEIGHT];
+    size_t depth = 0;
+    btree_node_pt temp_current_node = tree->root;
+    while ((temp_current_node->level != 0)){
+        path[depth] = temp_current_node;
+        path_index[depth] = _btree_node_upper_bound(tree, temp_current_node, key);
+        temp_current_node = _btree_children(tree, temp_current_node)[path_index[depth]];
+        depth++;
+    }
+
+    // Búsqueda y eliminación de la entrada en la hoja:
+    size_t pos = _btree_node_lower_bound(tree, temp_current_node, key);
+    if ((pos == temp_current_node->count) || (tree->cmp_fn(_btree_key(tree, temp_current_node, pos), key) != 0)){
+        return 2;
+    }
+
+    size_t tail = temp_current_node->count - pos - 1;
+    memmove(_btree_key(tree, temp_current_node, pos), _btree_key(tree, temp_current_node, pos + 1), tail * tree->key_size);
+    memmove(_btree_value(tree, temp_current_node, pos), _btree_value(tree, temp_current_node, pos + 1), tail * tree->value_size);
+    temp_current_node->count--;
+    tree->size--;
+
+    // Corrección de nodos por debajo del mínimo, de la hoja hacia la raíz:
+    while (depth > 0){
+        size_t min = ((temp_current_node->level == 0) ? tree->leaf_max : tree->inner_max) / 2;
+        if (temp_current_node->count >= min){
+            break;
+        }
+
+        btree_node_pt temp_parent_node = path[depth - 1];
+        size_t index = path_index[depth - 1];
+        btree_node_pt * children = _btree_children(tree, temp_parent_node);
+
+        if ((index > 0) && (children[index - 1]->count > min)){
+            _btree_borrow_left(tree, temp_parent_node, index);
+            break;
+        }
+
+        if ((index < temp_parent_node->count) && (children[index + 1]->count > min)){
+            _btree_borrow_right(tree, temp_parent_node, index);
+            break;
+        }
+
+        _btree_merge(tree, temp_parent_node, (index > 0) ? index - 1 : index);
+        temp_current_node = temp_parent_node;
+        depth--;
+    }
+
+    // Reducción de altura si la raíz interna se ha quedado sin claves:
+    if ((tree->root->level != 0) && (tree->root->count == 0)){
+        btree_node_pt temp_old_root = tree->root;
+        tree->root = _btree_children(tree, temp_old_root)[0];
+        free(temp_old_root);
+        tree->height--;
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función que sitúa un iterador en el primer elemento (menor clave) del árbol.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param btree_iter_pt iter: Referencia al iterador.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Árbol o iterador no válidos.
+                -> 2: El árbol está vacío (el iterador queda al final).
+*/
+uint8_t btree_begin(const btree_pt tree, btree_iter_pt iter){
+    // Comprobación de árbol e iterador válidos:
+    if ((tree == NULL) || (iter == NULL)){
+        return 1;
+    }
+
+    // Descenso por el hijo más a la izquierda:
+    btree_node_pt temp_current_node = tree->root;
+    while ((temp_current_node->level != 0)){
+        temp_current_node = _btree_children(tree, temp_current_node)[0];
+    }
+
+    iter->tree = tree;
+    iter->node = (temp_current_node->count > 0) ? temp_current_node : NULL;
+    iter->index = 0;
+
+    return (iter->node != NULL) ? 0 : 2;
+}
+
+/*
+    @brief Función que sitúa un iterador en el primer elemento cuya clave es mayor o igual que la dada.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param const void * key: Referencia a la clave.
+    @param btree_iter_pt iter: Referencia al iterador.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Árbol, clave o iterador no válidos.
+                -> 2: No hay ninguna clave mayor o igual (el iterador queda al final).
+*/
+uint8_t btree_lower_bound(const btree_pt tree, const void * key, btree_iter_pt iter){
+    // Comprobación de árbol, clave e iterador válidos:
+    if ((tree == NULL) || (key == NULL) || (iter == NULL)){
+        return 1;
+    }
+
+    // Descenso hasta la hoja y búsqueda de la posición (pasando a la hoja siguiente si queda al final):
+    iter->tree = tree;
+    iter->node = _btree_find_leaf(tree, key);
+    iter->index = _btree_node_lower_bound(tree, iter->node, key);
+    if (iter->index == iter->node->count){
+        iter->node = iter->node->next;
+        iter->index = 0;
+    }
+
+    return (iter->node != NULL) ? 0 : 2;
+}
+
+/*
+    @brief Función que sitúa un iterador en el primer elemento cuya clave es estrictamente mayor que la dada.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param const void * key: Referencia a la clave.
+    @param btree_iter_pt iter: Referencia al iterador.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Árbol, clave o iterador no válidos.
+                -> 2: No hay ninguna clave mayor (el iterador queda al final).
+*/
+uint8_t btree_upper_bound(const btree_pt tree, const void * key, btree_iter_pt iter){
+    // Comprobación de árbol, clave e iterador válidos:
+    if ((tree == NULL) || (key == NULL) || (iter == NULL)){
+        return 1;
+    }
+
+    // Descenso hasta la hoja y búsqueda de la posición (pasando a la hoja siguiente si queda al final):
+    iter->tree = tree;
+    iter->node = _btree_find_leaf(tree, key);
+    iter->index = _btree_node_upper_bound(tree, iter->node, key);
+    if (iter->index == iter->node->count){
+        iter->node = iter->node->next;
+        iter->index = 0;
+    }
+
+    return (iter->node != NULL) ? 0 : 2;
+}
+
+/*
+    @brief Función que avanza un iterador al siguiente elemento en orden de clave (siguiendo el enlace entre hojas).
+    @note: Cualquier inserción o eliminación en el árbol invalida los iteradores existentes.
+
+    @param btree_iter_pt iter: Referencia al iterador.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Iterador no válido o ya al final.
+                -> 2: Se ha alcanzado el final.
+*/
+uint8_t btree_iter_next(btree_iter_pt iter){
+    // Comprobación de iterador válido:
+    if ((iter == NULL) || (iter->node == NULL)){
+        return 1;
+    }
+
+    // Avance dentro de la hoja o a la siguiente:
+    iter->index++;
+    if (iter->index == iter->node->count){
+        iter->node = iter->node->next;
+        iter->index = 0;
+    }
+
+    return (iter->node != NULL) ? 0 : 2;
+}
+
+/*
+    @brief Función que copia la clave y el valor del elemento actual de un iterador en las variables indicadas.
+
+    @param const btree_iter_pt iter: Referencia al iterador.
+    @param void * out_key: Referencia a la variable donde se copiará la clave (puede ser nulo).
+    @param void * out_value: Referencia a la variable donde se copiará el valor (puede ser nulo).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Iterador no válido.
+                -> 2: El iterador está al final.
+*/
+uint8_t btree_iter_get(const btree_iter_pt iter, void * out_key, void * out_value){
+    // Comprobación de iterador válido:
+    if ((iter == NULL) || (iter->tree == NULL)){
+        return 1;
+    }
+
+    if (iter->node == NULL){
+        return 2;
+    }
+
+    // Copia de clave y valor:
+    if (out_key != NULL){
+        memcpy(out_key, _btree_key(iter->tree, iter->node, iter->index), iter->tree->key_size);
+    }
+    if (out_value != NULL){
+        memcpy(out_value, _btree_value(iter->tree, iter->node, iter->index), iter->tree->value_size);
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna la referencia a la clave del elemento actual de un iterador (sin copia).
+
+    @param const btree_iter_pt iter: Referencia al iterador.
+
+    @retval const void *: Referencia a la clave (nulo si el iterador no es válido o está al final).
+*/
+const void * btree_iter_key(const btree_iter_pt iter){
+    // Comprobación de iterador válido:
+    if ((iter == NULL) || (iter->tree == NULL) || (iter->node == NULL)){
+        return NULL;
+    }
+
+    return _btree_key(iter->tree, iter->node, iter->index);
+}
+
+/*
+    @brief Función que retorna la referencia al valor del elemento actual de un iterador (sin copia, modificable).
+
+    @param const btree_iter_pt iter: Referencia al iterador.
+
+    @retval void *: Referencia al valor, alineada a su tamaño (nulo si el iterador no es válido o está al final).
+*/
+void * btree_iter_value(const btree_iter_pt iter){
+    // Comprobación de iterador válido:
+    if ((iter == NULL) || (iter->tree == NULL) || (iter->node == NULL)){
+        return NULL;
+    }
+
+    return _btree_value(iter->tree, iter->node, iter->index);
+}
+
+/*
+    @brief Función que aplica una función, en orden de clave, a todos los elementos con clave en el rango [low, high).
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param const void * low: Referencia al límite inferior incluido (nulo = desde el principio).
+    @param const void * high: Referencia al límite superior excluido (nulo = hasta el final).
+    @param bool (*fn)(const void *, void *, void *): Referencia a la función (clave, valor, contexto); true indica detener el recorrido.
+    @param void * ctx: Referencia al contexto de usuario que se pasa a la función (puede ser nulo).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Árbol o función no válidos.
+                -> 2: La función ha detenido el recorrido.
+*/
+uint8_t btree_range_foreach(const btree_pt tree, const void * low, const void * high, bool (*fn)(const void *, void *, void *), void * ctx){
+    // Comprobación de árbol y función válidos:
+    if ((tree == NULL) || (fn == NULL)){
+        return 1;
+    }
+
+    // Posición inicial del rango:
+    btree_node_pt temp_current_node;
+    size_t index;
+    if (low != NULL){
+        temp_current_node = _btree_find_leaf(tree, low);
+        index = _btree_node_lower_bound(tree, temp_current_node, low);
+    } else {
+        temp_current_node = tree->root;
+        while ((temp_current_node->level != 0)){
+            temp_current_node = _btree_children(tree, temp_current_node)[0];
+        }
+        index = 0;
+    }
+
+    // Recorrido por hojas enlazadas, acotando cada hoja con una bisección contra el límite superior:
+    while (temp_current_node != NULL){
+        size_t end = temp_current_node->count;
+        bool last = false;
+        if ((high != NULL) && (end > 0) && (tree->cmp_fn(_btree_key(tree, temp_current_node, end - 1), high) >= 0)){
+            end = _btree_node_lower_bound(tree, temp_current_node, high);
+            last = true;
+        }
+
+        for (; index < end; index++){
+            if (fn(_btree_key(tree, temp_current_node, index), _btree_value(tree, temp_current_node, index), ctx)){
+                return 2;
+            }
+        }
+
+        if (last){
+            break;
+        }
+
+        temp_current_node = temp_current_node->next;
+        index = 0;
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna el número de elementos del árbol.
+
+    @param const btree_pt tree: Referencia al árbol.
+
+    @retval size_t: Número de elementos.
+*/
+size_t btree_size(const btree_pt tree){
+    // Comprobación de árbol válido:
+    if (tree == NULL){
+        return 0;
+    }
+
+    return tree->size;
+}
+
+/*
+    @brief Función que retorna la altura del árbol (1 si la raíz es una hoja).
+
+    @param const btree_pt tree: Referencia al árbol.
+
+    @retval size_t: Altura del árbol.
+*/
+size_t btree_height(const btree_pt tree){
+    // Comprobación de árbol válido:
+    if (tree == NULL){
+        return 0;
+    }
+
+    return tree->height;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna que calcula la alineación natural supuesta para un dato de un tamaño dado (potencia de 2, máximo 8).
+
+    @param size_t size: Tamaño (en bytes) del dato.
+
+    @retval size_t: Alineación (en bytes).
+*/
+static size_t _btree_natural_align(size_t size){
+    size_t align = 1;
+    while ((align < size) && (align < sizeof(uint64_t))){
+        align *= 2;
+    }
+    return align;
+}
+
+/*
+    @brief Función interna que redondea un tamaño al múltiplo superior de una alineación (potencia de 2).
+
+    @param size_t size: Tamaño (en bytes).
+    @param size_t align: Alineación (en bytes, potencia de 2).
+
+    @retval size_t: Tamaño redondeado.
+*/
+static size_t _btree_align_up(size_t size, size_t align){
+    return (size + align - 1) & ~(align - 1);
+}
+
+/*
+    @brief Función interna que retorna la referencia a la clave de una posición de un nodo.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param btree_node_pt node: Referencia al nodo.
+    @param size_t index: Posición de la clave.
+
+    @retval uint8_t *: Referencia a la clave.
+*/
+static inline uint8_t * _btree_key(const btree_pt tree, btree_node_pt node, size_t index){
+    return node->keys + (index * tree->key_size);
+}
+
+/*
+    @brief Función interna que retorna la referencia al valor de una posición de una hoja.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param btree_node_pt node: Referencia a la hoja.
+    @param size_t index: Posición del valor.
+
+    @retval uint8_t *: Referencia al valor.
+*/
+static inline uint8_t * _btree_value(const btree_pt tree, btree_node_pt node, size_t index){
+    return (uint8_t *)node + tree->leaf_values_offset + (index * tree->value_size);
+}
+
+/*
+    @brief Función interna que retorna la referencia al array de hijos de un nodo interno.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param btree_node_pt node: Referencia al nodo interno.
+
+    @retval btree_node_pt *: Referencia al array de hijos (count + 1 válidos).
+*/
+static inline btree_node_pt * _btree_children(const btree_pt tree, btree_node_pt node){
+    return (btree_node_pt *)((uint8_t *)node + tree->inner_children_offset);
+}
+
+/*
+    @brief Función interna para reservar un nodo vacío (hoja o interno).
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param size_t level: Nivel del nodo (0 = hoja).
+
+    @retval btree_node_pt: Referencia al nodo (nulo si falla la reserva).
+*/
+static btree_node_pt _btree_new_node(const btree_pt tree, size_t level){
+    btree_node_pt node = (btree_node_pt)malloc((level == 0) ? tree->leaf_bytes : tree->inner_bytes);
+    if (node == NULL){
+        return NULL;
+    }
+
+    node->next = NULL;
+    node->count = 0;
+    node->level = level;
+
+    return node;
+}
+
+/*
+    @brief Función interna que libera recursivamente un subárbol.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param btree_node_pt node: Referencia a la raíz del subárbol.
+
+    @retval None.
+*/
+static void _btree_free_subtree(const btree_pt tree, btree_node_pt node){
+    if (node->level != 0){
+        btree_node_pt * children = _btree_children(tree, node);
+        for (size_t i = 0; i <= node->count; i++){
+            _btree_free_subtree(tree, children[i]);
+        }
+    }
+    free(node);
+}
+
+/*
+    @brief Función interna que busca por bisección la primera clave de un nodo mayor o igual que la dada.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param btree_node_pt node: Referencia al nodo.
+    @param const void * key: Referencia a la clave.
+
+    @retval size_t: Posición encontrada (count si todas son menores).
+*/
+static size_t _btree_node_lower_bound(const btree_pt tree, btree_node_pt node, const void * key){
+    size_t low = 0;
+    size_t high = node->count;
+    while (low < high){
+        size_t mid = low + ((high - low) / 2);
+        if (tree->cmp_fn(_btree_key(tree, node, mid), key) < 0){
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/*
+    @brief Función interna que busca por bisección la primera clave de un nodo estrictamente mayor que la dada.
+    @note: En un nodo interno, la posición coincide con el índice del hijo por el que hay que descender.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param btree_node_pt node: Referencia al nodo.
+    @param const void * key: Referencia a la clave.
+
+    @retval size_t: Posición encontrada (count si ninguna es mayor).
+*/
+static size_t _btree_node_upper_bound(const btree_pt tree, btree_node_pt node, const void * key){
+    size_t low = 0;
+    size_t high = node->count;
+    while (low < high){
+        size_t mid = low + ((high - low) / 2);
+        if (tree->cmp_fn(_btree_key(tree, node, mid), key) <= 0){
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/*
+    @brief Función interna que desciende desde la raíz hasta la hoja que debe contener una clave.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param const void * key: Referencia a la clave.
+
+    @retval btree_node_pt: Referencia a la hoja.
+*/
+static btree_node_pt _btree_find_leaf(const btree_pt tree, const void * key){
+    btree_node_pt temp_current_node = tree->root;
+    while ((temp_current_node->level != 0)){
+        temp_current_node = _btree_children(tree, temp_current_node)[_btree_node_upper_bound(tree, temp_current_node, key)];
+    }
+    return temp_current_node;
+}
+
+/*
+    @brief Función interna que inserta una entrada en una posición de una hoja con espacio libre.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param btree_node_pt leaf: Referencia a la hoja.
+    @param size_t pos: Posición de inserción.
+    @param const void * key: Referencia a la clave.
+    @param const void * value: Referencia al valor.
+
+    @retval None.
+*/
+static void _btree_leaf_insert_at(const btree_pt tree, btree_node_pt leaf, size_t pos, const void * key, const void * value){
+    size_t tail = leaf->count - pos;
+    memmove(_btree_key(tree, leaf, pos + 1), _btree_key(tree, leaf, pos), tail * tree->key_size);
+    memmove(_btree_value(tree, leaf, pos + 1), _btree_value(tree, leaf, pos), tail * tree->value_size);
+    memcpy(_btree_key(tree, leaf, pos), key, tree->key_size);
+    memcpy(_btree_value(tree, leaf, pos), value, tree->value_size);
+    leaf->count++;
+}
+
+/*
+    @brief Función interna que inserta una clave separadora y su hijo derecho en un nodo interno con espacio libre.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param btree_node_pt node: Referencia al nodo interno.
+    @param size_t pos: Posición de la clave (el hijo se inserta en pos + 1).
+    @param const void * key: Referencia a la clave separadora.
+    @param btree_node_pt child: Referencia al hijo derecho de la clave.
+
+    @retval None.
+*/
+static void _btree_inner_insert_at(const btree_pt tree, btree_node_pt node, size_t pos, const void * key, btree_node_pt child){
+    btree_node_pt * children = _btree_children(tree, node);
+    size_t tail = node->count - pos;
+    memmove(_btree_key(tree, node, pos + 1), _btree_key(tree, node, pos), tail * tree->key_size);
+    memmove(&children[pos + 2], &children[pos + 1], tail * sizeof(btree_node_pt));
+    memcpy(_btree_key(tree, node, pos), key, tree->key_size);
+    children[pos + 1] = child;
+    node->count++;
+}
+
+/*
+    @brief Función interna que divide una hoja llena al insertar una entrada, repartiendo leaf_max + 1 entradas entre ella y una nueva hoja derecha.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param btree_node_pt leaf: Referencia a la hoja llena.
+    @param btree_node_pt right: Referencia a la nueva hoja (vacía).
+    @param size_t pos: Posición de inserción de la entrada en la hoja original.
+    @param const void * key: Referencia a la clave.
+    @param const void * value: Referencia al valor.
+
+    @retval None.
+*/
+static void _btree_split_leaf(const btree_pt tree, btree_node_pt leaf, btree_node_pt right, size_t pos, const void * key, const void * value){
+    size_t max = leaf->count;
+    size_t mid = (max + 1) / 2;
+
+    // Reparto de las entradas: si la nueva va a la izquierda, la derecha se queda con una entrada más de la original:
+    size_t from = (pos < mid) ? mid - 1 : mid;
+    right->count = max - from;
+    memcpy(_btree_key(tree, right, 0), _btree_key(tree, leaf, from), right->count * tree->key_size);
+    memcpy(_btree_value(tree, right, 0), _btree_value(tree, leaf, from), right->count * tree->value_size);
+    leaf->count = from;
+
+    if (pos < mid){
+        _btree_leaf_insert_at(tree, leaf, pos, key, value);
+    } else {
+        _btree_leaf_insert_at(tree, right, pos - mid, key, value);
+    }
+
+    // Enlace de la nueva hoja:
+    right->next = leaf->next;
+    leaf->next = right;
+}
+
+/*
+    @brief Función interna que divide un nodo interno lleno al insertar una clave separadora, subiendo la clave central.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param btree_node_pt node: Referencia al nodo interno lleno.
+    @param btree_node_pt right: Referencia al nuevo nodo interno (vacío).
+    @param size_t pos: Posición de la clave a insertar (su hijo derecho va en pos + 1).
+    @param const void * key: Referencia a la clave separadora.
+    @param btree_node_pt child: Referencia al hijo derecho de la clave.
+    @param void * out_up: Referencia donde se copia la clave que sube al padre.
+
+    @retval None.
+*/
+static void _btree_split_inner(const btree_pt tree, btree_node_pt node, btree_node_pt right, size_t pos, const void * key, btree_node_pt child, void * out_up){
+    btree_node_pt * children = _btree_children(tree, node);
+    btree_node_pt * right_children = _btree_children(tree, right);
+    size_t max = node->count;
+    size_t mid = (max + 1) / 2;
+
+    if (pos < mid){
+        // La clave nueva queda a la izquierda; sube la clave mid - 1 original:
+        memcpy(out_up, _btree_key(tree, node, mid - 1), tree->key_size);
+        right->count = max - mid;
+        memcpy(_btree_key(tree, right, 0), _btree_key(tree, node, mid), right->count * tree->key_size);
+        memcpy(right_children, &children[mid], (right->count + 1) * sizeof(btree_node_pt));
+        node->count = mid - 1;
+        _btree_inner_insert_at(tree, node, pos, key, child);
+    } else if (pos == mid){
+        // Sube la propia clave nueva; su hijo pasa a ser el primero de la derecha:
+        memcpy(out_up, key, tree->key_size);
+        right->count = max - mid;
+        memcpy(_btree_key(tree, right, 0), _btree_key(tree, node, mid), right->count * tree->key_size);
+        right_children[0] = child;
+        memcpy(&right_children[1], &children[mid + 1], right->count * sizeof(btree_node_pt));
+        node->count = mid;
+    } else {
+        // La clave nueva queda a la derecha; sube la clave mid original:
+        memcpy(out_up, _btree_key(tree, node, mid), tree->key_size);
+        right->count = max - mid - 1;
+        memcpy(_btree_key(tree, right, 0), _btree_key(tree, node, mid + 1), right->count * tree->key_size);
+        memcpy(right_children, &children[mid + 1], (right->count + 1) * sizeof(btree_node_pt));
+        node->count = mid;
+        _btree_inner_insert_at(tree, right, pos - mid - 1, key, child);
+    }
+}
+
+/*
+    @brief Función interna que pasa la última entrada del hermano izquierdo al hijo index de un nodo interno.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param btree_node_pt parent: Referencia al nodo padre.
+    @param size_t index: Posición del hijo que recibe la entrada.
+
+    @retval None.
+*/
+static void _btree_borrow_left(const btree_pt tree, btree_node_pt parent, size_t index){
+    btree_node_pt node = _btree_children(tree, parent)[index];
+    btree_node_pt left = _btree_children(tree, parent)[index - 1];
+
+    if (node->level == 0){
+        // Hoja: se mueve la última entrada y la nueva primera clave pasa a ser el separador:
+        left->count--;
+        _btree_leaf_insert_at(tree, node, 0, _btree_key(tree, left, left->count), _btree_value(tree, left, left->count));
+        memcpy(_btree_key(tree, parent, index - 1), _btree_key(tree, node, 0), tree->key_size);
+    } else {
+        // Nodo interno: rotación a través del separador del padre:
+        btree_node_pt * children = _btree_children(tree, node);
+        memmove(_btree_key(tree, node, 1), _btree_key(tree, node, 0), node->count * tree->key_size);
+        memmove(&children[1], &children[0], (node->count + 1) * sizeof(btree_node_pt));
+        memcpy(_btree_key(tree, node, 0), _btree_key(tree, parent, index - 1), tree->key_size);
+        children[0] = _btree_children(tree, left)[left->count];
+        node->count++;
+
+        memcpy(_btree_key(tree, parent, index - 1), _btree_key(tree, left, left->count - 1), tree->key_size);
+        left->count--;
+    }
+}
+
+/*
+    @brief Función interna que pasa la primera entrada del hermano derecho al hijo index de un nodo interno.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param btree_node_pt parent: Referencia al nodo padre.
+    @param size_t index: Posición del hijo que recibe la entrada.
+
+    @retval None.
+*/
+static void _btree_borrow_right(const btree_pt tree, btree_node_pt parent, size_t index){
+    btree_node_pt node = _btree_children(tree, parent)[index];
+    btree_node_pt right = _btree_children(tree, parent)[index + 1];
+
+    if (node->level == 0){
+        // Hoja: se mueve la primera entrada y la nueva primera clave del hermano pasa a ser el separador:
+        memcpy(_btree_key(tree, node, node->count), _btree_key(tree, right, 0), tree->key_size);
+        memcpy(_btree_value(tree, node, node->count), _btree_value(tree, right, 0), tree->value_size);
+        node->count++;
+
+        right->count--;
+        memmove(_btree_key(tree, right, 0), _btree_key(tree, right, 1), right->count * tree->key_size);
+        memmove(_btree_value(tree, right, 0), _btree_value(tree, right, 1), right->count * tree->value_size);
+        memcpy(_btree_key(tree, parent, index), _btree_key(tree, right, 0), tree->key_size);
+    } else {
+        // Nodo interno: rotación a través del separador del padre:
+        btree_node_pt * right_children = _btree_children(tree, right);
+        memcpy(_btree_key(tree, node, node->count), _btree_key(tree, parent, index), tree->key_size);
+        _btree_children(tree, node)[node->count + 1] = right_children[0];
+        node->count++;
+
+        memcpy(_btree_key(tree, parent, index), _btree_key(tree, right, 0), tree->key_size);
+        right->count--;
+        memmove(_btree_key(tree, right, 0), _btree_key(tree, right, 1), right->count * tree->key_size);
+        memmove(&right_children[0], &right_children[1], (right->count + 1) * sizeof(btree_node_pt));
+    }
+}
+
+/*
+    @brief Función interna que fusiona los hijos index e index + 1 de un nodo interno, eliminando el separador y liberando el derecho.
+
+    @param const btree_pt tree: Referencia al árbol.
+    @param btree_node_pt parent: Referencia al nodo padre.
+    @param size_t index: Posición del separador (y del hijo izquierdo).
+
+    @retval None.
+*/
+static void _btree_merge(const btree_pt tree, btree_node_pt parent, size_t index){
+    btree_node_pt * parent_children = _btree_children(tree, parent);
+    btree_node_pt left = parent_children[index];
+    btree_node_pt right = parent_children[index + 1];
+
+    if (left->level == 0){
+        // Hojas: concatenación de entradas y reenlace:
+        memcpy(_btree_key(tree, left, left->count), _btree_key(tree, right, 0), right->count * tree->key_size);
+        memcpy(_btree_value(tree, left, left->count), _btree_value(tree, right, 0), right->count * tree->value_size);
+        left->count += right->count;
+        left->next = right->next;
+    } else {
+        // Nodos internos: el separador del padre baja entre ambos:
+        memcpy(_btree_key(tree, left, left->count), _btree_key(tree, parent, index), tree->key_size);
+        memcpy(_btree_key(tree, left, left->count + 1), _btree_key(tree, right, 0), right->count * tree->key_size);
+        memcpy(&_btree_children(tree, left)[left->count + 1], _btree_children(tree, right), (right->count + 1) * sizeof(btree_node_pt));
+        left->count += right->count + 1;
+    }
+
+    // Eliminación del separador y del hijo derecho en el padre:
+    size_t tail = parent->count - index - 1;
+    memmove(_btree_key(tree, parent, index), _btree_key(tree, parent, index + 1), tail * tree->key_size);
+    memmove(&parent_children[index + 1], &parent_children[index + 2], tail * sizeof(btree_node_pt));
+    parent->count--;
+
+    free(right);
+}
+
+/*
+    @brief Función interna que reparte uniformemente count elementos en groups grupos consecutivos y retorna el tramo de uno de ellos.
+
+    @param size_t count: Número total de elementos.
+    @param size_t groups: Número de grupos.
+    @param size_t group: Grupo consultado.
+    @param size_t * out_first: Referencia donde se guarda la posición del primer elemento del grupo.
+    @param size_t * out_count: Referencia donde se guarda el número de elementos del grupo.
+
+    @retval None.
+*/
+static void _btree_build_level(size_t count, size_t groups, size_t group, size_t * out_first, size_t * out_count){
+    size_t base = count / groups;
+    size_t extra = count % groups;
+    *out_first = (group * base) + ((group < extra) ? group : extra);
+    *out_count = base + ((group < extra) ? 1 : 0);
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
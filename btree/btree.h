@@ -0,0 +1,100 @@
+#ifndef BTREE_HEADER
+#define BTREE_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "../array/array.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define BTREE_DEFAULT_NODE_BYTES 256    // Tamaño objetivo de un nodo por defecto (4 líneas de caché de 64 bytes).
+#define BTREE_MIN_NODE_BYTES 64         // Tamaño objetivo mínimo de un nodo (una línea de caché).
+#define BTREE_MAX_NODE_BYTES 65536      // Tamaño objetivo máximo de un nodo (varias páginas).
+#define BTREE_MIN_NODE_KEYS 4           // Número mínimo de claves por nodo lleno, sea cual sea el tamaño objetivo.
+#define BTREE_MAX_HEIGHT 48             // Altura máxima del árbol (suficiente con BTREE_MIN_NODE_KEYS).
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos---------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct btree_node{
+    struct btree_node * next;   // Hoja siguiente (nulo en nodos internos y en la última hoja).
+    size_t count;               // Número de claves del nodo.
+    size_t level;               // Nivel del nodo (0 = hoja con valores, > 0 = nodo interno con hijos).
+    uint8_t keys[];             // Claves contiguas (alineadas a 8 bytes); tras ellas, valores (hoja) o referencias a hijos (interno).
+};
+
+struct btree{
+    struct btree_node * root;       // Nodo raíz (una hoja vacía si el árbol no tiene elementos).
+    size_t key_size;                // Tamaño (bytes) de la clave.
+    size_t value_size;              // Tamaño (bytes) del valor.
+    size_t leaf_max;                // Número máximo de claves de una hoja.
+    size_t inner_max;               // Número máximo de claves de un nodo interno.
+    size_t leaf_values_offset;      // Desplazamiento (bytes) de los valores dentro de una hoja.
+    size_t inner_children_offset;   // Desplazamiento (bytes) de los hijos dentro de un nodo interno.
+    size_t leaf_bytes;              // Tamaño (bytes) reservado para una hoja.
+    size_t inner_bytes;             // Tamaño (bytes) reservado para un nodo interno.
+    size_t size;                    // Número de elementos almacenados.
+    size_t height;                  // Altura del árbol (1 = la raíz es una hoja).
+    int (*cmp_fn)(const void *, const void *);  // Función comparadora de claves (al estilo de qsort).
+};
+
+struct btree_iter{
+    struct btree * tree;        // Referencia al árbol recorrido.
+    struct btree_node * node;   // Hoja actual (nulo = fin del recorrido).
+    size_t index;               // Posición dentro de la hoja actual.
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct btree_node btree_node_t;
+typedef btree_node_t * btree_node_pt;
+
+typedef struct btree btree_t;
+typedef btree_t * btree_pt;
+
+typedef struct btree_iter btree_iter_t;
+typedef btree_iter_t * btree_iter_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción del árbol:
+btree_pt btree_init(size_t key_size, size_t value_size, size_t node_bytes, int (*cmp_fn)(const void *, const void *));
+void btree_deinit(btree_pt * tree);
+void btree_clear(btree_pt tree);
+uint8_t btree_bulk_load(btree_pt tree, const array_pt entries);
+
+// Inserción, búsqueda y eliminación:
+uint8_t btree_insert(btree_pt tree, const void * key, const void * value);
+uint8_t btree_find(const btree_pt tree, const void * key, void * out_value);
+uint8_t btree_erase(btree_pt tree, const void * key);
+
+// Recorridos ordenados:
+uint8_t btree_begin(const btree_pt tree, btree_iter_pt iter);
+uint8_t btree_lower_bound(const btree_pt tree, const void * key, btree_iter_pt iter);
+uint8_t btree_upper_bound(const btree_pt tree, const void * key, btree_iter_pt iter);
+uint8_t btree_iter_next(btree_iter_pt iter);
+uint8_t btree_iter_get(const btree_iter_pt iter, void * out_key, void * out_value);
+const void * btree_iter_key(const btree_iter_pt iter);
+void * btree_iter_value(const btree_iter_pt iter);
+uint8_t btree_range_foreach(const btree_pt tree, const void * low, const void * high, bool (*fn)(const void *, void *, void *), void * ctx);
+
+// Utilidades generales:
+size_t btree_size(const btree_pt tree);
+size_t btree_height(const btree_pt tree);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
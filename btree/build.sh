@@ -0,0 +1,82 @@
+#!/bin/bash
+
+
+# Variables de entorno             #
+# -------------------------------- #
+CC=gcc
+CFLAGS_TEST="-g -Wall -O2"
+CFLAGS_LIB="-Wall -O2 -fPIC -shared"
+CFLAGS_BENCH="-Wall -O2 -march=native"
+
+SRC_BTREE="btree.c ../array/array.c"
+SRC_TEST=test_btree.c
+SRC_BENCH=bench_btree.c
+
+TEST_PROG=test_btree.elf
+BENCH_PROG=bench_btree.elf
+LIB_PROG=btree.so
+# -------------------------------- #
+
+
+# Lógica de uso                    #
+# -------------------------------- #
+if [ "$1" == "test" ]; then
+    echo
+    echo "[BUILD-BTREE-TEST]: Compilando programa de prueba de btree..."
+    if $CC $CFLAGS_TEST $SRC_TEST $SRC_BTREE -o $TEST_PROG; then
+        echo "[BUILD-BTREE-TEST]: Compilación completada."
+        echo "[BUILD-BTREE-TEST]: Ejecutando programa de prueba..."
+        echo
+        ./$TEST_PROG
+        echo
+        echo "[BUILD-BTREE-TEST]: Ejecución de programa de prueba finalizado."
+    else
+        echo "[BUILD-BTREE-TEST][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$1" == "bench" ]; then
+    echo
+    echo "[BUILD-BTREE-BENCH]: Compilando benchmark de btree..."
+    if $CC $CFLAGS_BENCH $SRC_BENCH $SRC_BTREE -o $BENCH_PROG; then
+        echo "[BUILD-BTREE-BENCH]: Compilación completada."
+        echo "[BUILD-BTREE-BENCH]: Ejecutando benchmark..."
+        echo
+        ./$BENCH_PROG "${@:2}"
+        echo
+        echo "[BUILD-BTREE-BENCH]: Ejecución de benchmark finalizada."
+    else
+        echo "[BUILD-BTREE-BENCH][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$1" == "lib" ]; then
+    echo
+    echo "[BUILD-BTREE-LIB]: Compilando la librería de btree..."
+    if $CC $CFLAGS_LIB $SRC_BTREE -o $LIB_PROG; then
+        mv $LIB_PROG ./lib
+        echo "[BUILD-BTREE-LIB]: Librearía compilada."
+    else
+        echo "[BUILD-BTREE-LIB][ERR]: Error de compilación, librería no generada."
+    fi
+    echo
+
+elif [ "$1" == "clean" ]; then
+    echo
+    echo "[BUILD-BTREE-CLEAN]: Limpiando espacio de trabajo..."
+    rm -f ./$TEST_PROG ./$BENCH_PROG ./lib/$LIB_PROG
+    echo "[BUILD-BTREE-CLEAN]: Espacio de trabajo limpio."
+    echo
+
+else
+    echo
+    echo "[BUILD-BTREE][ERR]: Uso incorrecto u opciones inválidas."
+    echo -e "\n\t[Uso]:"
+    echo -e "\t\t-> ./build.sh test: \tCompila y ejecuta el programa de test (.elf)"
+    echo -e "\t\t-> ./build.sh bench [n] [búsquedas]: \tCompila y ejecuta el benchmark frente a bsearch con varios tamaños de nodo (.elf)"
+    echo -e "\t\t-> ./build.sh lib: \tCompila y genera la librería compartida (.so) bajo la carpeta lib/"
+    echo -e "\t\t-> ./build.sh clean: \tLimpia el espacio de trabajo eliminando archivos generados"
+    echo
+    exit 1
+fi
+# -------------------------------- #
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include "btree.h"
+#include <stdio.h>
+
+struct test_entry{
+    uint32_t key;
+    uint32_t value;
+};
+
+// Prototipos de funciones:
+int cmp_u32(const void * a, const void * b);
+bool print_entry(const void * key, void * value, void * ctx);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de un árbol de uint32_t a uint32_t con nodos de 64 bytes (una línea de caché):
+    btree_pt tree = btree_init(sizeof(uint32_t), sizeof(uint32_t), 64, cmp_u32);
+    printf("\nSe ha creado el árbol correctamente en la dirección (%p)\n", (void *)tree);
+
+    // Inserción desordenada de claves (múltiplos de 10) y actualización de una existente:
+    for (uint32_t i = 0; i < 50; i++){
+        uint32_t key = ((i * 17) % 50) * 10;
+        uint32_t value = key / 10;
+        btree_insert(tree, &key, &value);
+    }
+    uint32_t key = 120;
+    uint32_t value = 999;
+    btree_insert(tree, &key, &value);
+    printf("Elementos: %ld, altura: %ld\n", btree_size(tree), btree_height(tree));
+
+    // Búsquedas exactas:
+    for (key = 119; key <= 121; key++){
+        if (btree_find(tree, &key, &value) == 0){
+            printf("Clave %u -> %u\n", key, value);
+        } else {
+            printf("Clave %u: no está en el árbol\n", key);
+        }
+    }
+
+    // Primer elemento mayor o igual que 255 y los dos siguientes (iterador):
+    btree_iter_t iter;
+    key = 255;
+    printf("\nDesde la cota inferior de %u:", key);
+    if (btree_lower_bound(tree, &key, &iter) == 0){
+        for (int i = 0; i < 3; i++){
+            btree_iter_get(&iter, &key, &value);
+            printf(" (%u, %u)", key, value);
+            if (btree_iter_next(&iter) != 0){
+                break;
+            }
+        }
+    }
+    printf("\n");
+
+    // Recorrido por rango [100, 200):
+    uint32_t low = 100;
+    uint32_t high = 200;
+    printf("Rango [%u, %u):", low, high);
+    btree_range_foreach(tree, &low, &high, print_entry, NULL);
+    printf("\n");
+
+    // Eliminación de las claves de 0 a 390 y recorrido completo del resto:
+    for (key = 0; key < 400; key += 10){
+        btree_erase(tree, &key);
+    }
+    printf("\nElementos tras eliminar: %ld, altura: %ld (eliminar de nuevo la 0: %u)\nRestantes:", btree_size(tree), btree_height(tree), btree_erase(tree, &(uint32_t){0}));
+    btree_range_foreach(tree, NULL, NULL, print_entry, NULL);
+    printf("\n");
+
+    // Carga masiva desde un array ordenado de entradas (clave | valor):
+    btree_clear(tree);
+    array_pt entries = array_init(sizeof(struct test_entry));
+    for (uint32_t i = 0; i < 1000; i++){
+        struct test_entry entry = {.key = i * 2, .value = i};
+        array_set(entries, &entry, i);
+    }
+    btree_bulk_load(tree, entries);
+    array_deinit(entries);
+
+    key = 1001;
+    btree_upper_bound(tree, &key, &iter);
+    printf("\nCarga masiva: %ld elementos, altura: %ld, primera clave mayor que %u: %u\n", btree_size(tree), btree_height(tree), key, *(const uint32_t *)btree_iter_key(&iter));
+
+    // Destrucción del árbol:
+    btree_deinit(&tree);
+    printf("\nDirección del árbol tras la eliminación: (%p)\n", (void *)tree);
+
+    return 0;
+}
+
+/*
+    @brief Función de comparación de claves uint32_t (al estilo de qsort).
+
+    @param const void * a: Referencia a la primera clave.
+    @param const void * b: Referencia a la segunda clave.
+
+    @retval int: <0, 0 o >0 si a es menor, igual o mayor que b.
+*/
+int cmp_u32(const void * a, const void * b){
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+    @brief Función que imprime una entrada del árbol durante un recorrido por rango.
+
+    @param const void * key: Referencia a la clave (uint32_t).
+    @param void * value: Referencia al valor (uint32_t).
+    @param void * ctx: Contexto de usuario (no usado).
+
+    @retval bool: false para continuar el recorrido.
+*/
+bool print_entry(const void * key, void * value, void * ctx){
+    printf(" %u", *(const uint32_t *)key);
+    return false;
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#!/bin/bash
+
+
+# Variables de entorno             #
+# -------------------------------- #
+CC=gcc
+CFLAGS_TEST="-g -Wall -O2 -pthread"
+CFLAGS_LIB="-Wall -O2 -fPIC -shared -pthread"
+
+SRC_DEQUE=$1.c
+SRC_TEST=test_$1.c
+
+TEST_PROG=test_$1.elf
+LIB_PROG=$1.so
+# -------------------------------- #
+
+
+# Lógica de uso                    #
+# -------------------------------- #
+if [ "$2" == "test" ]; then
+    echo
+    echo "[BUILD-DEQUE-TEST]: Compilando programa de prueba de $1..."
+    if $CC $CFLAGS_TEST $SRC_TEST $SRC_DEQUE -o $TEST_PROG; then
+        echo "[BUILD-DEQUE-TEST]: Compilación completada."
+        echo "[BUILD-DEQUE-TEST]: Ejecutando programa de prueba..."
+        echo
+        ./$TEST_PROG
+        echo
+        echo "[BUILD-DEQUE-TEST]: Ejecución de programa de prueba finalizado."
+    else
+        echo "[BUILD-DEQUE-TEST][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$2" == "lib" ]; then
+    echo
+    echo "[BUILD-DEQUE-LIB]: Compilando la librería de $1..."
+    if $CC $CFLAGS_LIB $SRC_DEQUE -o $LIB_PROG; then
+        mv $LIB_PROG ./lib
+        echo "[BUILD-DEQUE-LIB]: Librearía compilada."
+    else
+        echo "[BUILD-DEQUE-LIB][ERR]: Error de compilación, librería no generada."
+    fi
+    echo
+
+elif [ "$2" == "clean" ]; then
+    echo
+    echo "[BUILD-DEQUE-CLEAN]: Limpiando espacio de trabajo..."
+    rm -f ./$TEST_PROG ./lib/$LIB_PROG
+    echo "[BUILD-DEQUE-CLEAN]: Espacio de trabajo limpio."
+    echo
+
+else
+    echo
+    echo "[BUILD-DEQUE][ERR]: Uso incorrecto u opciones inválidas."
+    echo -e "\n\t[Uso]:"
+    echo -e "\t\t-> ./build.sh <tipo> test: \tCompila y ejecuta el programa de test (.elf)"
+    echo -e "\t\t-> ./build.sh <tipo> lib: \tCompila y genera la librería compartida (.so) bajo la carpeta lib/"
+    echo -e "\t\t-> ./build.sh <tipo> clean: \tLimpia el espacio de trabajo eliminando archivos generados"
+    echo -e "\n\n\t<tipo>:"
+    echo -e "\t\tdeque: \tEjecuta el script para la cola doble sobre buffer circular"
+    echo -e "\t\twsdeque: \tEjecuta el script para la cola doble de robo de trabajo (Chase-Lev)"
+    echo
+    exit 1
+fi
+# -------------------------------- #
\ No newline at end of file
@@ -0,0 +1,537 @@
+#include "deque.h"
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static inline uint8_t * _deque_slot(const deque_pt deque, size_t index);
+static uint8_t _deque_grow(deque_pt deque, size_t min_capacity);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar una cola doble sobre un buffer circular de capacidad potencia de 2.
+
+    @param size_t element_size: Tamaño del elemento en bytes (mismos límites que array_t).
+
+    @retval deque_pt: Referencia a la cola creada.
+*/
+deque_pt deque_init(size_t element_size){
+    // Comprobación de los límites del tamaño del elemento:
+    if ((element_size < MIN_ELEMENT_SIZE) || (element_size > MAX_ELEMENT_SIZE)){
+        return NULL;
+    }
+
+    // Reserva de memoria para la estructura básica y el buffer:
+    deque_pt deque = (deque_pt)malloc(sizeof(deque_t));
+    if (deque == NULL){
+        return NULL;
+    }
+
+    deque->buffer = malloc(DEQUE_MIN_CAPACITY * element_size);
+    if (deque->buffer == NULL){
+        free(deque);
+        return NULL;
+    }
+
+    // Inicio de los miembros de la estructura:
+    deque->element_size = element_size;
+    deque->capacity = DEQUE_MIN_CAPACITY;
+    deque->head = 0;
+    deque->size = 0;
+
+    return deque;
+}
+
+/*
+    @brief Función para destruir y liberar una cola doble.
+
+    @param deque_pt * deque: Referencia a la referencia de la cola.
+
+    @retval None.
+*/
+void deque_deinit(deque_pt * deque){
+    // Comprobación de que la cola no sea nula:
+    if ((deque == NULL) || (*deque == NULL)){
+        return;
+    }
+
+    // Liberación del buffer y de la estructura:
+    free((*deque)->buffer);
+    free(*deque);
+    *deque = NULL;
+}
+
+/*
+    @brief Función para eliminar todos los elementos de la cola, conservando la capacidad reservada.
+
+    @param deque_pt deque: Referencia a la cola.
+
+    @retval None.
+*/
+void deque_clear(deque_pt deque){
+    // Comprobación de cola válida:
+    if (deque == NULL){
+        return;
+    }
+
+    deque->head = 0;
+    deque->size = 0;
+}
+
+/*
+    @brief Función para reservar capacidad para al menos capacity elementos (redondeada a potencia de 2).
+
+    @param deque_pt deque: Referencia a la cola.
+    @param size_t capacity: Capacidad mínima (número de elementos).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: La cola no es válida.
+                -> 2: Error al ajustar el tamaño de la cola.
+*/
+uint8_t deque_reserve(deque_pt deque, size_t capacity){
+    // Comprobación de cola válida:
+    if (deque == NULL){
+        return 1;
+    }
+
+    if (capacity <= deque->capacity){
+        return 0;
+    }
+
+    return _deque_grow(deque, capacity);
+}
+
+/*
+    @brief Función para insertar un elemento al principio de la cola (O(1) amortizado).
+
+    @param deque_pt deque: Referencia a la cola.
+    @param const void * element: Referencia al elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o elemento no válidos.
+                -> 2: Error al ajustar el tamaño de la cola.
+*/
+uint8_t deque_push_front(deque_pt deque, const void * element){
+    // Comprobación de cola y elemento válidos:
+    if ((deque == NULL) || (element == NULL)){
+        return 1;
+    }
+
+    // Crecimiento si el buffer está lleno:
+    if ((deque->size == deque->capacity) && (_deque_grow(deque, deque->capacity * 2) != 0)){
+        return 2;
+    }
+
+    // Retroceso de la cabeza (con vuelta) y copia del elemento:
+    deque->head = (deque->head - 1) & (deque->capacity - 1);
+    memcpy((uint8_t *)deque->buffer + (deque->head * deque->element_size), element, deque->element_size);
+    deque->size++;
+
+    return 0;
+}
+
+/*
+    @brief Función para insertar un elemento al final de la cola (O(1) amortizado).
+
+    @param deque_pt deque: Referencia a la cola.
+    @param const void * element: Referencia al elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o elemento no válidos.
+                -> 2: Error al ajustar el tamaño de la cola.
+*/
+uint8_t deque_push_back(deque_pt deque, const void * element){
+    // Comprobación de cola y elemento válidos:
+    if ((deque == NULL) || (element == NULL)){
+        return 1;
+    }
+
+    // Crecimiento si el buffer está lleno:
+    if ((deque->size == deque->capacity) && (_deque_grow(deque, deque->capacity * 2) != 0)){
+        return 2;
+    }
+
+    // Copia del elemento tras el último:
+    memcpy(_deque_slot(deque, deque->size), element, deque->element_size);
+    deque->size++;
+
+    return 0;
+}
+
+/*
+    @brief Función para extraer el primer elemento de la cola (O(1)).
+
+    @param deque_pt deque: Referencia a la cola.
+    @param void * out_element: Referencia a la variable donde se copiará el elemento (puede ser nulo).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: La cola no es válida.
+                -> 2: La cola está vacía.
+*/
+uint8_t deque_pop_front(deque_pt deque, void * out_element){
+    // Comprobación de cola válida y no vacía:
+    if (deque == NULL){
+        return 1;
+    }
+
+    if (deque->size == 0){
+        return 2;
+    }
+
+    // Copia del elemento y avance de la cabeza:
+    if (out_element != NULL){
+        memcpy(out_element, _deque_slot(deque, 0), deque->element_size);
+    }
+    deque->head = (deque->head + 1) & (deque->capacity - 1);
+    deque->size--;
+
+    return 0;
+}
+
+/*
+    @brief Función para extraer el último elemento de la cola (O(1)).
+
+    @param deque_pt deque: Referencia a la cola.
+    @param void * out_element: Referencia a la variable donde se copiará el elemento (puede ser nulo).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: La cola no es válida.
+                -> 2: La cola está vacía.
+*/
+uint8_t deque_pop_back(deque_pt deque, void * out_element){
+    // Comprobación de cola válida y no vacía:
+    if (deque == NULL){
+        return 1;
+    }
+
+    if (deque->size == 0){
+        return 2;
+    }
+
+    // Copia del último elemento y reducción del tamaño:
+    deque->size--;
+    if (out_element != NULL){
+        memcpy(out_element, _deque_slot(deque, deque->size), deque->element_size);
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función para consultar el primer elemento de la cola sin extraerlo.
+
+    @param const deque_pt deque: Referencia a la cola.
+    @param void * out_element: Referencia a la variable donde se copiará el elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o variable no válidas.
+                -> 2: La cola está vacía.
+*/
+uint8_t deque_peek_front(const deque_pt deque, void * out_element){
+    return deque_get(deque, 0, out_element);
+}
+
+/*
+    @brief Función para consultar el último elemento de la cola sin extraerlo.
+
+    @param const deque_pt deque: Referencia a la cola.
+    @param void * out_element: Referencia a la variable donde se copiará el elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o variable no válidas.
+                -> 2: La cola está vacía.
+*/
+uint8_t deque_peek_back(const deque_pt deque, void * out_element){
+    // Comprobación de cola y variable válidas, y de cola no vacía:
+    if ((deque == NULL) || (out_element == NULL)){
+        return 1;
+    }
+
+    if (deque->size == 0){
+        return 2;
+    }
+
+    memcpy(out_element, _deque_slot(deque, deque->size - 1), deque->element_size);
+
+    return 0;
+}
+
+/*
+    @brief Función para insertar n elementos contiguos al final de la cola, con a lo sumo dos copias de memoria.
+
+    @param deque_pt deque: Referencia a la cola.
+    @param const void * elements: Referencia a los n elementos, contiguos y de element_size bytes cada uno.
+    @param size_t n: Número de elementos.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o elementos no válidos.
+                -> 2: Error al ajustar el tamaño de la cola (no se inserta ninguno).
+*/
+uint8_t deque_push_back_n(deque_pt deque, const void * elements, size_t n){
+    // Comprobación de cola y elementos válidos:
+    if ((deque == NULL) || ((elements == NULL) && (n > 0))){
+        return 1;
+    }
+
+    // Crecimiento si no caben todos los elementos (comprobando el desbordamiento del tamaño resultante):
+    if (n > (SIZE_MAX - deque->size)){
+        return 2;
+    }
+
+    if (((deque->size + n) > deque->capacity) && (_deque_grow(deque, deque->size + n) != 0)){
+        return 2;
+    }
+
+    // Copia en dos tramos: hasta el final del buffer y, si vuelve, desde el principio:
+    size_t tail = (deque->head + deque->size) & (deque->capacity - 1);
+    size_t first = deque->capacity - tail;
+    if (first > n){
+        first = n;
+    }
+
+    memcpy((uint8_t *)deque->buffer + (tail * deque->element_size), elements, first * deque->element_size);
+    memcpy(deque->buffer, (const uint8_t *)elements + (first * deque->element_size), (n - first) * deque->element_size);
+    deque->size += n;
+
+    return 0;
+}
+
+/*
+    @brief Función para extraer hasta n elementos del principio de la cola, con a lo sumo dos copias de memoria.
+
+    @param deque_pt deque: Referencia a la cola.
+    @param void * out_elements: Referencia al buffer de salida, de al menos n elementos (puede ser nulo para descartarlos).
+    @param size_t n: Número máximo de elementos a extraer.
+
+    @retval size_t: Número de elementos extraídos.
+*/
+size_t deque_pop_front_n(deque_pt deque, void * out_elements, size_t n){
+    // Comprobación de cola válida:
+    if (deque == NULL){
+        return 0;
+    }
+
+    if (n > deque->size){
+        n = deque->size;
+    }
+
+    // Copia en dos tramos: desde la cabeza hasta el final del buffer y, si vuelve, desde el principio:
+    if (out_elements != NULL){
+        size_t first = deque->capacity - deque->head;
+        if (first > n){
+            first = n;
+        }
+
+        memcpy(out_elements, (uint8_t *)deque->buffer + (deque->head * deque->element_size), first * deque->element_size);
+        memcpy((uint8_t *)out_elements + (first * deque->element_size), deque->buffer, (n - first) * deque->element_size);
+    }
+
+    deque->head = (deque->head + n) & (deque->capacity - 1);
+    deque->size -= n;
+
+    return n;
+}
+
+/*
+    @brief Función para obtener una copia del elemento de la posición indicada (0 = primero) en O(1).
+
+    @param const deque_pt deque: Referencia a la cola.
+    @param size_t index: Posición del elemento.
+    @param void * out_element: Referencia a la variable donde se copiará el elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o variable no válidas.
+                -> 2: El índice no es válido.
+*/
+uint8_t deque_get(const deque_pt deque, size_t index, void * out_element){
+    // Comprobación de cola y variable válidas:
+    if ((deque == NULL) || (out_element == NULL)){
+        return 1;
+    }
+
+    // Comprobación del índice:
+    if (index >= deque->size){
+        return 2;
+    }
+
+    memcpy(out_element, _deque_slot(deque, index), deque->element_size);
+
+    return 0;
+}
+
+/*
+    @brief Función para sobrescribir el elemento de la posición indicada (0 = primero) en O(1).
+
+    @param deque_pt deque: Referencia a la cola.
+    @param size_t index: Posición del elemento.
+    @param const void * element: Referencia al nuevo elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o elemento no válidos.
+                -> 2: El índice no es válido.
+*/
+uint8_t deque_set(deque_pt deque, size_t index, const void * element){
+    // Comprobación de cola y elemento válidos:
+    if ((deque == NULL) || (element == NULL)){
+        return 1;
+    }
+
+    // Comprobación del índice:
+    if (index >= deque->size){
+        return 2;
+    }
+
+    memcpy(_deque_slot(deque, index), element, deque->element_size);
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna la referencia al elemento de la posición indicada, sin copia.
+    @note: La referencia deja de ser válida tras cualquier inserción que haga crecer la cola.
+
+    @param const deque_pt deque: Referencia a la cola.
+    @param size_t index: Posición del elemento (0 = primero).
+
+    @retval void *: Referencia al elemento (nulo si la cola o el índice no son válidos).
+*/
+void * deque_at(const deque_pt deque, size_t index){
+    // Comprobación de cola e índice válidos:
+    if ((deque == NULL) || (index >= deque->size)){
+        return NULL;
+    }
+
+    return _deque_slot(deque, index);
+}
+
+/*
+    @brief Función que indica si la cola está vacía.
+
+    @param const deque_pt deque: Referencia a la cola.
+
+    @retval bool: true si está vacía (o no es válida), false en caso contrario.
+*/
+bool deque_is_empty(const deque_pt deque){
+    // Comprobación de cola válida:
+    if (deque == NULL){
+        return true;
+    }
+
+    return deque->size == 0;
+}
+
+/*
+    @brief Función que retorna el número de elementos de la cola.
+
+    @param const deque_pt deque: Referencia a la cola.
+
+    @retval size_t: Número de elementos.
+*/
+size_t deque_size(const deque_pt deque){
+    // Comprobación de cola válida:
+    if (deque == NULL){
+        return 0;
+    }
+
+    return deque->size;
+}
+
+/*
+    @brief Función que retorna la capacidad de la cola.
+
+    @param const deque_pt deque: Referencia a la cola.
+
+    @retval size_t: Capacidad (número de elementos).
+*/
+size_t deque_capacity(const deque_pt deque){
+    // Comprobación de cola válida:
+    if (deque == NULL){
+        return 0;
+    }
+
+    return deque->capacity;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna que retorna la referencia a la ranura del buffer de una posición lógica de la cola.
+
+    @param const deque_pt deque: Referencia a la cola.
+    @param size_t index: Posición lógica (0 = primero).
+
+    @retval uint8_t *: Referencia a la ranura.
+*/
+static inline uint8_t * _deque_slot(const deque_pt deque, size_t index){
+    return (uint8_t *)deque->buffer + (((deque->head + index) & (deque->capacity - 1)) * deque->element_size);
+}
+
+/*
+    @brief Función interna que amplía el buffer a la menor potencia de 2 mayor o igual que min_capacity, desenrollando el anillo.
+    @note: Los elementos se copian en una sola pasada (a lo sumo dos memcpy) al principio del nuevo buffer, con la cabeza en 0.
+
+    @param deque_pt deque: Referencia a la cola.
+    @param size_t min_capacity: Capacidad mínima requerida.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 2: Error de reserva de memoria o capacidad no representable (la cola no se modifica).
+*/
+static uint8_t _deque_grow(deque_pt deque, size_t min_capacity){
+    // Comprobación de desbordamiento de la capacidad (potencia de 2) y del tamaño en bytes del buffer:
+    if (min_capacity > (SIZE_MAX / 2)){
+        return 2;
+    }
+
+    size_t new_capacity = deque->capacity;
+    while (new_capacity < min_capacity){
+        new_capacity *= 2;
+    }
+
+    if (new_capacity > (SIZE_MAX / deque->element_size)){
+        return 2;
+    }
+
+    void * new_buffer = malloc(new_capacity * deque->element_size);
+    if (new_buffer == NULL){
+        return 2;
+    }
+
+    // Copia del tramo desde la cabeza hasta el final del buffer y del tramo que vuelve al principio:
+    size_t first = deque->capacity - deque->head;
+    if (first > deque->size){
+        first = deque->size;
+    }
+
+    memcpy(new_buffer, (uint8_t *)deque->buffer + (deque->head * deque->element_size), first * deque->element_size);
+    memcpy((uint8_t *)new_buffer + (first * deque->element_size), deque->buffer, (deque->size - first) * deque->element_size);
+
+    free(deque->buffer);
+    deque->buffer = new_buffer;
+    deque->capacity = new_capacity;
+    deque->head = 0;
+
+    return 0;
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
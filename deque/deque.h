@@ -0,0 +1,72 @@
+#ifndef DEQUE_HEADER
+#define DEQUE_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "../array/array.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define DEQUE_MIN_CAPACITY 32       // En número de elementos (potencia de 2).
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos---------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct deque{
+    void * buffer;          // Buffer circular de elementos.
+    size_t element_size;    // Tamaño (bytes) del elemento.
+    size_t capacity;        // Capacidad total (número de elementos, potencia de 2).
+    size_t head;            // Posición en el buffer del primer elemento.
+    size_t size;            // Número de elementos almacenados.
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct deque deque_t;
+typedef deque_t * deque_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción de la cola:
+deque_pt deque_init(size_t element_size);
+void deque_deinit(deque_pt * deque);
+void deque_clear(deque_pt deque);
+uint8_t deque_reserve(deque_pt deque, size_t capacity);
+
+// Inserción y extracción por los extremos:
+uint8_t deque_push_front(deque_pt deque, const void * element);
+uint8_t deque_push_back(deque_pt deque, const void * element);
+uint8_t deque_pop_front(deque_pt deque, void * out_element);
+uint8_t deque_pop_back(deque_pt deque, void * out_element);
+uint8_t deque_peek_front(const deque_pt deque, void * out_element);
+uint8_t deque_peek_back(const deque_pt deque, void * out_element);
+
+// Operaciones en bloque:
+uint8_t deque_push_back_n(deque_pt deque, const void * elements, size_t n);
+size_t deque_pop_front_n(deque_pt deque, void * out_elements, size_t n);
+
+// Acceso por índice:
+uint8_t deque_get(const deque_pt deque, size_t index, void * out_element);
+uint8_t deque_set(deque_pt deque, size_t index, const void * element);
+void * deque_at(const deque_pt deque, size_t index);
+
+// Utilidades generales:
+bool deque_is_empty(const deque_pt deque);
+size_t deque_size(const deque_pt deque);
+size_t deque_capacity(const deque_pt deque);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
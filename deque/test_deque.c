@@ -0,0 +1,81 @@
+#include "deque.h"
+#include <stdio.h>
+
+// Prototipos de funciones:
+void print_deque(const deque_pt deque);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de una cola doble de uint32_t:
+    deque_pt deque = deque_init(sizeof(uint32_t));
+    printf("\nSe ha creado la cola correctamente en la dirección (%p)\n", (void *)deque);
+
+    // Inserción por ambos extremos (la cabeza vuelve al final del buffer):
+    for (uint32_t i = 1; i <= 4; i++){
+        deque_push_back(deque, &i);
+        uint32_t value = 100 + i;
+        deque_push_front(deque, &value);
+    }
+    printf("Elementos: %ld, capacidad: %ld\n", deque_size(deque), deque_capacity(deque));
+    print_deque(deque);
+
+    // Extracción por ambos extremos y consulta:
+    uint32_t value;
+    deque_pop_front(deque, &value);
+    printf("\nExtraído del principio: %u\n", value);
+    deque_pop_back(deque, &value);
+    printf("Extraído del final: %u\n", value);
+    deque_peek_front(deque, &value);
+    printf("Primero: %u, ", value);
+    deque_peek_back(deque, &value);
+    printf("último: %u\n", value);
+
+    // Acceso y modificación por índice:
+    value = 999;
+    deque_set(deque, 2, &value);
+    deque_get(deque, 2, &value);
+    printf("Elemento en la posición 2 tras modificarlo: %u (por referencia: %u)\n", value, *(uint32_t *)deque_at(deque, 2));
+    print_deque(deque);
+
+    // Inserción en bloque (crece desenrollando el anillo) y extracción en bloque:
+    uint32_t batch[40];
+    for (uint32_t i = 0; i < 40; i++){
+        batch[i] = 1000 + i;
+    }
+    deque_push_back_n(deque, batch, 40);
+    printf("\nTras insertar 40 en bloque: %ld elementos, capacidad: %ld\n", deque_size(deque), deque_capacity(deque));
+    printf("Reserva de SIZE_MAX / 2 + 2 (retorna %d), bloque de SIZE_MAX elementos (retorna %d), capacidad: %ld\n",
+           deque_reserve(deque, SIZE_MAX / 2 + 2), deque_push_back_n(deque, batch, SIZE_MAX), deque_capacity(deque));
+
+    uint32_t out[10];
+    size_t popped = deque_pop_front_n(deque, out, 10);
+    printf("Extraídos %ld del principio:", popped);
+    for (size_t i = 0; i < popped; i++){
+        printf(" %u", out[i]);
+    }
+    printf("\nQuedan %ld elementos (primero: %u)\n", deque_size(deque), *(uint32_t *)deque_at(deque, 0));
+
+    // Limpieza y destrucción de la cola:
+    deque_clear(deque);
+    printf("\nElementos tras limpiar: %ld (extraer: %u)\n", deque_size(deque), deque_pop_front(deque, &value));
+    deque_deinit(&deque);
+    printf("\nDirección de la cola tras la eliminación: (%p)\n", (void *)deque);
+
+    return 0;
+}
+
+/*
+    @brief Función que imprime los elementos de la cola, del primero al último.
+
+    @param const deque_pt deque: Referencia a la cola de uint32_t.
+
+    @retval None.
+*/
+void print_deque(const deque_pt deque){
+    printf("Contenido:");
+    for (size_t i = 0; i < deque_size(deque); i++){
+        printf(" %u", *(uint32_t *)deque_at(deque, i));
+    }
+    printf("\n");
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "wsdeque.h"
+#include <stdio.h>
+#include <pthread.h>
+
+#define TEST_THIEVES 3
+#define TEST_TASKS 200000
+
+struct test_thief{
+    wsdeque_pt deque;               // Cola de la que roba.
+    atomic_bool * done;             // Indica que el dueño ha terminado de insertar.
+    uint64_t sum;                   // Suma de los elementos robados.
+    size_t count;                   // Número de elementos robados.
+};
+
+// Prototipos de funciones:
+void * thief_thread(void * arg);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de una cola de uint32_t:
+    wsdeque_pt deque = wsdeque_init(sizeof(uint32_t), 0);
+    printf("\nSe ha creado la cola correctamente en la dirección (%p), capacidad: %ld\n", (void *)deque, wsdeque_capacity(deque));
+
+    // Inserción por el dueño hasta forzar el crecimiento del buffer:
+    for (uint32_t i = 0; i < 40; i++){
+        wsdeque_push(deque, &i);
+    }
+    printf("Elementos: %ld, capacidad tras crecer: %ld\n", wsdeque_size(deque), wsdeque_capacity(deque));
+
+    // El dueño extrae por abajo (LIFO) y un ladrón roba por arriba (FIFO):
+    uint32_t value;
+    wsdeque_pop(deque, &value);
+    printf("Extraído por el dueño: %u, ", value);
+    wsdeque_steal(deque, &value);
+    printf("robado: %u\n", value);
+
+    while (wsdeque_pop(deque, &value) == 0);
+    printf("Cola vacía: %s (steal retorna %d)\n", wsdeque_is_empty(deque) ? "sí" : "no", wsdeque_steal(deque, &value));
+
+    // Dueño insertando y extrayendo mientras varios ladrones roban:
+    atomic_bool done = false;
+    pthread_t thieves[TEST_THIEVES];
+    struct test_thief args[TEST_THIEVES];
+    for (size_t i = 0; i < TEST_THIEVES; i++){
+        args[i] = (struct test_thief){.deque = deque, .done = &done, .sum = 0, .count = 0};
+        pthread_create(&thieves[i], NULL, thief_thread, &args[i]);
+    }
+
+    uint64_t sum = 0;
+    size_t count = 0;
+    for (uint32_t i = 0; i < TEST_TASKS; i++){
+        wsdeque_push(deque, &i);
+        if (((i % 3) == 0) && (wsdeque_pop(deque, &value) == 0)){
+            sum += value;
+            count++;
+        }
+    }
+    while (wsdeque_pop(deque, &value) == 0){
+        sum += value;
+        count++;
+    }
+    atomic_store(&done, true);
+
+    size_t stolen = 0;
+    for (size_t i = 0; i < TEST_THIEVES; i++){
+        pthread_join(thieves[i], NULL);
+        sum += args[i].sum;
+        count += args[i].count;
+        stolen += args[i].count;
+    }
+
+    uint64_t expected = (uint64_t)TEST_TASKS * (TEST_TASKS - 1) / 2;
+    printf("\n%d tareas: %ld extraídas por el dueño, %ld robadas, todas exactamente una vez: %s\n",
+           TEST_TASKS, count - stolen, stolen, ((count == TEST_TASKS) && (sum == expected)) ? "sí" : "no");
+
+    // Destrucción de la cola:
+    wsdeque_deinit(&deque);
+    printf("\nCola destruida, referencia: %p\n", (void *)deque);
+
+    return 0;
+}
+
+/*
+    @brief Función del hilo ladrón: roba elementos hasta que el dueño termina y la cola queda vacía.
+
+    @param void * arg: Referencia a los argumentos (struct test_thief).
+
+    @retval void *: NULL.
+*/
+void * thief_thread(void * arg){
+    struct test_thief * args = (struct test_thief *)arg;
+    uint32_t value;
+    while (true){
+        uint8_t status = wsdeque_steal(args->deque, &value);
+        if (status == 0){
+            args->sum += value;
+            args->count++;
+        } else if ((status == 2) && atomic_load(args->done)){
+            break;
+        }
+    }
+
+    return NULL;
+}
\ No newline at end of file
@@ -0,0 +1,362 @@
+#include "wsdeque.h"
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static ws_buffer_pt _wsdeque_buffer_init(size_t capacity, size_t slot_words);
+static ws_buffer_pt _wsdeque_grow(wsdeque_pt deque, ws_buffer_pt buffer, int64_t top, int64_t bottom);
+static inline void _wsdeque_store(wsdeque_pt deque, ws_buffer_pt buffer, int64_t index, const void * data);
+static inline void _wsdeque_load(wsdeque_pt deque, ws_buffer_pt buffer, int64_t index, void * out_data);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar una cola doble de robo de trabajo (Chase-Lev).
+    @note: Un único hilo dueño inserta y extrae por abajo; cualquier otro hilo puede robar por arriba.
+
+    @param size_t data_size: Tamaño del elemento en bytes.
+    @param size_t capacity: Capacidad inicial (número de elementos, se redondea a potencia de 2, 0 para el mínimo).
+
+    @retval wsdeque_pt: Referencia a la cola creada.
+*/
+wsdeque_pt wsdeque_init(size_t data_size, size_t capacity){
+    // Comprobación de los límites de tamaño y capacidad:
+    if ((data_size < MIN_DATA_SIZE) || (data_size > MAX_DATA_SIZE) || (capacity > ((size_t)INT64_MAX / 2) / data_size)){
+        return NULL;
+    }
+
+    // Reserva de memoria de la estructura (alineada a línea de caché):
+    wsdeque_pt deque = (wsdeque_pt)aligned_alloc(WSDEQUE_CACHE_LINE, sizeof(wsdeque_t));
+    if (deque == NULL){
+        return NULL;
+    }
+
+    size_t real_capacity = WSDEQUE_MIN_CAPACITY;
+    while (real_capacity < capacity){
+        real_capacity *= 2;
+    }
+
+    deque->data_size = data_size;
+    deque->slot_words = (data_size + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    ws_buffer_pt buffer = _wsdeque_buffer_init(real_capacity, deque->slot_words);
+    if (buffer == NULL){
+        free(deque);
+        return NULL;
+    }
+
+    // Inicio de los miembros de la estructura:
+    atomic_init(&deque->top, 0);
+    atomic_init(&deque->bottom, 0);
+    atomic_init(&deque->buffer, buffer);
+
+    return deque;
+}
+
+/*
+    @brief Función para destruir y liberar una cola junto a los buffers retirados (ningún hilo debe estar usándola).
+
+    @param wsdeque_pt * deque: Referencia a la referencia de la cola.
+
+    @retval None.
+*/
+void wsdeque_deinit(wsdeque_pt * deque){
+    // Comprobación de que la cola no sea nula:
+    if ((deque == NULL) || (*deque == NULL)){
+        return;
+    }
+
+    // Liberación del buffer actual y de los retirados:
+    ws_buffer_pt temp_buffer = atomic_load_explicit(&(*deque)->buffer, memory_order_relaxed);
+    while (temp_buffer != NULL){
+        ws_buffer_pt temp_prev_buffer = temp_buffer->prev;
+        free(temp_buffer);
+        temp_buffer = temp_prev_buffer;
+    }
+
+    free(*deque);
+    *deque = NULL;
+}
+
+/*
+    @brief Función (hilo dueño) para insertar un elemento por abajo.
+    @note: Sin operaciones atómicas de lectura-modificación-escritura; si el buffer está lleno se duplica y el antiguo se retira.
+
+    @param wsdeque_pt deque: Referencia a la cola.
+    @param const void * data: Referencia al elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o elemento no válidos.
+                -> 2: Error al ampliar el buffer.
+*/
+uint8_t wsdeque_push(wsdeque_pt deque, const void * data){
+    // Comprobación de cola y elemento válidos:
+    if ((deque == NULL) || (data == NULL)){
+        return 1;
+    }
+
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    ws_buffer_pt buffer = atomic_load_explicit(&deque->buffer, memory_order_relaxed);
+
+    // Ampliación del buffer si está lleno:
+    if (bottom - top > (int64_t)buffer->mask){
+        buffer = _wsdeque_grow(deque, buffer, top, bottom);
+        if (buffer == NULL){
+            return 2;
+        }
+    }
+
+    // Copia del elemento y publicación (release) del nuevo extremo:
+    _wsdeque_store(deque, buffer, bottom, data);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+
+    return 0;
+}
+
+/*
+    @brief Función (hilo dueño) para extraer el último elemento insertado (LIFO).
+    @note: Solo se usa CAS cuando queda un único elemento y puede competir con un ladrón.
+    @note: out_data solo se escribe si se obtiene el elemento.
+
+    @param wsdeque_pt deque: Referencia a la cola.
+    @param void * out_data: Referencia a la variable donde se copiará el elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o variable no válidas.
+                -> 2: La cola está vacía (o un ladrón se ha llevado el último elemento).
+*/
+uint8_t wsdeque_pop(wsdeque_pt deque, void * out_data){
+    // Comprobación de cola y variable válidas:
+    if ((deque == NULL) || (out_data == NULL)){
+        return 1;
+    }
+
+    // Reserva del elemento inferior antes de leer top (barrera seq_cst frente a los ladrones):
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    ws_buffer_pt buffer = atomic_load_explicit(&deque->buffer, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    // Cola vacía: restauración del extremo inferior:
+    if (top > bottom){
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return 2;
+    }
+
+    // Copia a una variable temporal (la del usuario solo se escribe si el elemento es nuestro):
+    uint64_t temp_data[(MAX_DATA_SIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+    _wsdeque_load(deque, buffer, bottom, temp_data);
+
+    // Último elemento: se disputa con los ladrones mediante CAS sobre top:
+    if (top == bottom){
+        bool won = atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed);
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        if (!won){
+            return 2;
+        }
+    }
+
+    memcpy(out_data, temp_data, deque->data_size);
+
+    return 0;
+}
+
+/*
+    @brief Función (cualquier hilo) para robar el elemento más antiguo de la cola (FIFO).
+    @note: out_data solo se escribe si se gana la carrera por el elemento.
+
+    @param wsdeque_pt deque: Referencia a la cola.
+    @param void * out_data: Referencia a la variable donde se copiará el elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o variable no válidas.
+                -> 2: La cola está vacía.
+                -> 3: Otro hilo ha ganado la carrera por el elemento (se puede reintentar).
+*/
+uint8_t wsdeque_steal(wsdeque_pt deque, void * out_data){
+    // Comprobación de cola y variable válidas:
+    if ((deque == NULL) || (out_data == NULL)){
+        return 1;
+    }
+
+    // Lectura de top antes que bottom (barrera seq_cst frente al dueño):
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+    if (top >= bottom){
+        return 2;
+    }
+
+    // Copia especulativa a una variable temporal y reclamación con CAS (se descarta si se pierde):
+    uint64_t temp_data[(MAX_DATA_SIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+    ws_buffer_pt buffer = atomic_load_explicit(&deque->buffer, memory_order_acquire);
+    _wsdeque_load(deque, buffer, top, temp_data);
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed)){
+        return 3;
+    }
+
+    // La variable del usuario solo se escribe tras ganar la carrera:
+    memcpy(out_data, temp_data, deque->data_size);
+
+    return 0;
+}
+
+/*
+    @brief Función que indica si la cola está vacía (aproximado si hay operaciones en curso).
+
+    @param const wsdeque_pt deque: Referencia a la cola.
+
+    @retval bool: true si está vacía, false en otro caso.
+*/
+bool wsdeque_is_empty(const wsdeque_pt deque){
+    return wsdeque_size(deque) == 0;
+}
+
+/*
+    @brief Función que retorna el número aproximado de elementos de la cola (exacto si no hay operaciones en curso).
+
+    @param const wsdeque_pt deque: Referencia a la cola.
+
+    @retval size_t: Número de elementos.
+*/
+size_t wsdeque_size(const wsdeque_pt deque){
+    // Comprobación de cola válida:
+    if (deque == NULL){
+        return 0;
+    }
+
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+
+    return (bottom > top) ? (size_t)(bottom - top) : 0;
+}
+
+/*
+    @brief Función que retorna la capacidad del buffer actual de la cola.
+
+    @param const wsdeque_pt deque: Referencia a la cola.
+
+    @retval size_t: Capacidad (número de elementos).
+*/
+size_t wsdeque_capacity(const wsdeque_pt deque){
+    // Comprobación de cola válida:
+    if (deque == NULL){
+        return 0;
+    }
+
+    return atomic_load_explicit(&deque->buffer, memory_order_acquire)->mask + 1;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna para reservar un buffer circular vacío.
+
+    @param size_t capacity: Capacidad (número de elementos, potencia de 2).
+    @param size_t slot_words: Palabras de 8 bytes por elemento.
+
+    @retval ws_buffer_pt: Referencia al buffer (NULL si no hay memoria).
+*/
+static ws_buffer_pt _wsdeque_buffer_init(size_t capacity, size_t slot_words){
+    ws_buffer_pt buffer = (ws_buffer_pt)malloc(sizeof(ws_buffer_t) + (capacity * slot_words * sizeof(uint64_t)));
+    if (buffer == NULL){
+        return NULL;
+    }
+
+    buffer->mask = capacity - 1;
+    buffer->prev = NULL;
+
+    return buffer;
+}
+
+/*
+    @brief Función interna (hilo dueño) que duplica el buffer copiando los elementos vivos y publica el nuevo.
+    @note: El buffer antiguo no se libera: un ladrón puede estar leyéndolo. Queda enlazado al nuevo y se libera con la cola.
+
+    @param wsdeque_pt deque: Referencia a la cola.
+    @param ws_buffer_pt buffer: Referencia al buffer actual.
+    @param int64_t top: Índice superior leído por el dueño.
+    @param int64_t bottom: Índice inferior.
+
+    @retval ws_buffer_pt: Referencia al nuevo buffer (NULL si no hay memoria).
+*/
+static ws_buffer_pt _wsdeque_grow(wsdeque_pt deque, ws_buffer_pt buffer, int64_t top, int64_t bottom){
+    ws_buffer_pt new_buffer = _wsdeque_buffer_init(2 * (buffer->mask + 1), deque->slot_words);
+    if (new_buffer == NULL){
+        return NULL;
+    }
+
+    // Copia de los elementos vivos en sus mismos índices lógicos:
+    uint64_t temp_data[(MAX_DATA_SIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+    for (int64_t i = top; i < bottom; i++){
+        _wsdeque_load(deque, buffer, i, temp_data);
+        _wsdeque_store(deque, new_buffer, i, temp_data);
+    }
+
+    new_buffer->prev = buffer;
+    atomic_store_explicit(&deque->buffer, new_buffer, memory_order_release);
+
+    return new_buffer;
+}
+
+/*
+    @brief Función interna que copia un elemento a su ranura palabra a palabra (escrituras atómicas relajadas).
+
+    @param wsdeque_pt deque: Referencia a la cola.
+    @param ws_buffer_pt buffer: Referencia al buffer.
+    @param int64_t index: Índice lógico del elemento.
+    @param const void * data: Referencia al elemento.
+
+    @retval None.
+*/
+static inline void _wsdeque_store(wsdeque_pt deque, ws_buffer_pt buffer, int64_t index, const void * data){
+    uint64_t temp_words[(MAX_DATA_SIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+    temp_words[deque->slot_words - 1] = 0;
+    memcpy(temp_words, data, deque->data_size);
+
+    _Atomic uint64_t * slot = buffer->words + (((size_t)index & buffer->mask) * deque->slot_words);
+    for (size_t i = 0; i < deque->slot_words; i++){
+        atomic_store_explicit(&slot[i], temp_words[i], memory_order_relaxed);
+    }
+}
+
+/*
+    @brief Función interna que copia un elemento desde su ranura palabra a palabra (lecturas atómicas relajadas).
+    @note: Un ladrón puede leer una ranura que el dueño reescribe; la copia se descarta entonces al fallar su CAS.
+
+    @param wsdeque_pt deque: Referencia a la cola.
+    @param ws_buffer_pt buffer: Referencia al buffer.
+    @param int64_t index: Índice lógico del elemento.
+    @param void * out_data: Referencia a la variable donde se copiará el elemento.
+
+    @retval None.
+*/
+static inline void _wsdeque_load(wsdeque_pt deque, ws_buffer_pt buffer, int64_t index, void * out_data){
+    uint64_t temp_words[(MAX_DATA_SIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+
+    _Atomic uint64_t * slot = buffer->words + (((size_t)index & buffer->mask) * deque->slot_words);
+    for (size_t i = 0; i < deque->slot_words; i++){
+        temp_words[i] = atomic_load_explicit(&slot[i], memory_order_relaxed);
+    }
+
+    memcpy(out_data, temp_words, deque->data_size);
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
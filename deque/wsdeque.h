@@ -0,0 +1,72 @@
+#ifndef WSDEQUE_HEADER
+#define WSDEQUE_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdatomic.h>
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define MIN_DATA_SIZE 1             // En bytes.
+#define MAX_DATA_SIZE 128           // En bytes.
+
+#define WSDEQUE_CACHE_LINE 64       // Tamaño (bytes) de la línea de caché usada para separar top y bottom.
+#define WSDEQUE_MIN_CAPACITY 32     // En número de elementos (potencia de 2).
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos --------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct ws_buffer{
+    size_t mask;                    // Capacidad - 1 (la capacidad es potencia de 2).
+    struct ws_buffer * prev;        // Buffer anterior (retirado tras crecer, se libera con la cola).
+    _Atomic uint64_t words[];       // Elementos, en palabras atómicas de 8 bytes (los ladrones pueden leer mientras se escribe).
+};
+
+struct wsdeque{
+    _Alignas(WSDEQUE_CACHE_LINE) _Atomic int64_t top;       // Índice del elemento más antiguo (lo avanzan los ladrones con CAS).
+    _Alignas(WSDEQUE_CACHE_LINE) _Atomic int64_t bottom;    // Índice de la siguiente inserción (solo lo escribe el dueño).
+    _Atomic(struct ws_buffer *) buffer;                     // Buffer circular actual.
+    size_t data_size;                                       // Tamaño (bytes) del elemento.
+    size_t slot_words;                                      // Palabras de 8 bytes por elemento.
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct ws_buffer ws_buffer_t;
+typedef ws_buffer_t * ws_buffer_pt;
+
+typedef struct wsdeque wsdeque_t;
+typedef wsdeque_t * wsdeque_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción de la cola:
+wsdeque_pt wsdeque_init(size_t data_size, size_t capacity);
+void wsdeque_deinit(wsdeque_pt * deque);
+
+// Operaciones del hilo dueño (extremo inferior):
+uint8_t wsdeque_push(wsdeque_pt deque, const void * data);
+uint8_t wsdeque_pop(wsdeque_pt deque, void * out_data);
+
+// Operaciones de otros hilos (extremo superior):
+uint8_t wsdeque_steal(wsdeque_pt deque, void * out_data);
+
+// Utilidades generales:
+bool wsdeque_is_empty(const wsdeque_pt deque);
+size_t wsdeque_size(const wsdeque_pt deque);
+size_t wsdeque_capacity(const wsdeque_pt deque);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
@@ -0,0 +1,63 @@
+#!/bin/bash
+
+
+# Variables de entorno             #
+# -------------------------------- #
+CC=gcc
+CFLAGS_TEST="-g -Wall -O2 -pthread"
+CFLAGS_LIB="-Wall -O2 -fPIC -shared -pthread"
+
+SRC_EBR="ebr.c ../array/array.c"
+SRC_TEST=test_ebr.c
+
+TEST_PROG=test_ebr.elf
+LIB_PROG=ebr.so
+# -------------------------------- #
+
+
+# Lógica de uso                    #
+# -------------------------------- #
+if [ "$1" == "test" ]; then
+    echo
+    echo "[BUILD-EBR-TEST]: Compilando programa de prueba de ebr..."
+    if $CC $CFLAGS_TEST $SRC_TEST $SRC_EBR -o $TEST_PROG; then
+        echo "[BUILD-EBR-TEST]: Compilación completada."
+        echo "[BUILD-EBR-TEST]: Ejecutando programa de prueba..."
+        echo
+        ./$TEST_PROG
+        echo
+        echo "[BUILD-EBR-TEST]: Ejecución de programa de prueba finalizado."
+    else
+        echo "[BUILD-EBR-TEST][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$1" == "lib" ]; then
+    echo
+    echo "[BUILD-EBR-LIB]: Compilando la librería de ebr..."
+    if $CC $CFLAGS_LIB $SRC_EBR -o $LIB_PROG; then
+        mv $LIB_PROG ./lib
+        echo "[BUILD-EBR-LIB]: Librearía compilada."
+    else
+        echo "[BUILD-EBR-LIB][ERR]: Error de compilación, librería no generada."
+    fi
+    echo
+
+elif [ "$1" == "clean" ]; then
+    echo
+    echo "[BUILD-EBR-CLEAN]: Limpiando espacio de trabajo..."
+    rm -f ./$TEST_PROG ./lib/$LIB_PROG
+    echo "[BUILD-EBR-CLEAN]: Espacio de trabajo limpio."
+    echo
+
+else
+    echo
+    echo "[BUILD-EBR][ERR]: Uso incorrecto u opciones inválidas."
+    echo -e "\n\t[Uso]:"
+    echo -e "\t\t-> ./build.sh test: \tCompila y ejecuta el programa de test (.elf)"
+    echo -e "\t\t-> ./build.sh lib: \tCompila y genera la librería compartida (.so) bajo la carpeta lib/"
+    echo -e "\t\t-> ./build.sh clean: \tLimpia el espacio de trabajo eliminando archivos generados"
+    echo
+    exit 1
+fi
+# -------------------------------- #
\ No newline at end of file
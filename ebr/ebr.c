@@ -0,0 +1,407 @@
+#include "ebr.h"
+
+#include <sched.h>
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static bool _ebr_try_advance(ebr_pt ebr);
+static size_t _ebr_collect(ebr_record_pt record, uint64_t epoch);
+static size_t _ebr_free_limbo(array_pt limbo);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar un dominio de reclamación de memoria por épocas (EBR).
+    @note: Los contenedores concurrentes retiran sus nodos desenlazados en el dominio en lugar de liberarlos con free;
+           se liberan cuando ningún hilo puede seguir teniendo una referencia a ellos.
+
+    @retval ebr_pt: Referencia al dominio creado (NULL si no hay memoria).
+*/
+ebr_pt ebr_init(void){
+    // Reserva de memoria de la estructura (alineada a línea de caché):
+    ebr_pt ebr = (ebr_pt)aligned_alloc(EBR_CACHE_LINE, sizeof(ebr_t));
+    if (ebr == NULL){
+        return NULL;
+    }
+
+    // Inicio de los miembros de la estructura:
+    atomic_init(&ebr->epoch, 0);
+    atomic_init(&ebr->records, NULL);
+
+    return ebr;
+}
+
+/*
+    @brief Función para destruir un dominio, liberando todas las retiradas pendientes y los registros de hilos.
+    @note: Ningún hilo debe estar usando el dominio; los registros dejan de ser válidos.
+
+    @param ebr_pt * ebr: Referencia a la referencia del dominio.
+
+    @retval None.
+*/
+void ebr_deinit(ebr_pt * ebr){
+    // Comprobación de que el dominio no sea nulo:
+    if ((ebr == NULL) || (*ebr == NULL)){
+        return;
+    }
+
+    // Liberación de las retiradas pendientes y de los registros:
+    ebr_record_pt temp_record = atomic_load_explicit(&(*ebr)->records, memory_order_relaxed);
+    while (temp_record != NULL){
+        ebr_record_pt temp_next_record = temp_record->next;
+        for (size_t i = 0; i < EBR_EPOCHS; i++){
+            _ebr_free_limbo(temp_record->limbo[i]);
+            array_deinit(temp_record->limbo[i]);
+        }
+        free(temp_record);
+        temp_record = temp_next_record;
+    }
+
+    free(*ebr);
+    *ebr = NULL;
+}
+
+/*
+    @brief Función para registrar el hilo actual en el dominio y obtener su registro.
+    @note: Cada hilo que entre en secciones críticas o retire referencias necesita su propio registro.
+    @note: Se reutilizan los registros de hilos que ya se dieron de baja (con sus retiradas pendientes).
+
+    @param ebr_pt ebr: Referencia al dominio.
+
+    @retval ebr_record_pt: Registro del hilo (NULL si el dominio no es válido o no hay memoria).
+*/
+ebr_record_pt ebr_register(ebr_pt ebr){
+    // Comprobación de dominio válido:
+    if (ebr == NULL){
+        return NULL;
+    }
+
+    // Búsqueda de un registro inactivo para reutilizarlo:
+    for (ebr_record_pt temp_record = atomic_load(&ebr->records); temp_record != NULL; temp_record = temp_record->next){
+        bool expected = false;
+        if (!atomic_load_explicit(&temp_record->in_use, memory_order_relaxed) &&
+            atomic_compare_exchange_strong(&temp_record->in_use, &expected, true)){
+            return temp_record;
+        }
+    }
+
+    // Creación de un registro nuevo:
+    ebr_record_pt record = (ebr_record_pt)aligned_alloc(EBR_CACHE_LINE, sizeof(ebr_record_t));
+    if (record == NULL){
+        return NULL;
+    }
+
+    for (size_t i = 0; i < EBR_EPOCHS; i++){
+        record->limbo[i] = array_init(sizeof(ebr_entry_t));
+        if (record->limbo[i] == NULL){
+            for (size_t j = 0; j < i; j++){
+                array_deinit(record->limbo[j]);
+            }
+            free(record);
+            return NULL;
+        }
+        record->limbo_epoch[i] = 0;
+    }
+    atomic_init(&record->state, 0);
+    atomic_init(&record->in_use, true);
+    record->nesting = 0;
+    record->pending = 0;
+
+    // Publicación del registro al principio de la lista:
+    ebr_record_pt temp_head = atomic_load(&ebr->records);
+    do {
+        record->next = temp_head;
+    } while (!atomic_compare_exchange_weak(&ebr->records, &temp_head, record));
+
+    return record;
+}
+
+/*
+    @brief Función para dar de baja el registro de un hilo.
+    @note: Cierra la sección crítica si quedó abierta. Las retiradas que aún no se pueden liberar quedan en el registro
+           para su siguiente dueño (o hasta ebr_deinit).
+
+    @param ebr_pt ebr: Referencia al dominio.
+    @param ebr_record_pt * record: Referencia al registro (se anula).
+
+    @retval None.
+*/
+void ebr_unregister(ebr_pt ebr, ebr_record_pt * record){
+    // Comprobación de dominio y registro válidos:
+    if ((ebr == NULL) || (record == NULL) || (*record == NULL)){
+        return;
+    }
+
+    // Salida de la sección crítica y liberación de lo que ya sea seguro:
+    (*record)->nesting = 0;
+    atomic_store_explicit(&(*record)->state, 0, memory_order_release);
+    ebr_reclaim(ebr, *record);
+
+    // Liberación del registro para otro hilo:
+    atomic_store_explicit(&(*record)->in_use, false, memory_order_release);
+    *record = NULL;
+}
+
+/*
+    @brief Función para entrar en una sección crítica (lectura o modificación de un contenedor concurrente).
+    @note: Las referencias obtenidas dentro de la sección crítica son válidas hasta ebr_exit. Admite anidamiento.
+    @note: Al entrar se liberan las listas de espera de épocas ya seguras (coste constante).
+
+    @param ebr_pt ebr: Referencia al dominio.
+    @param ebr_record_pt record: Registro del hilo.
+
+    @retval None.
+*/
+void ebr_enter(ebr_pt ebr, ebr_record_pt record){
+    // Comprobación de dominio y registro válidos:
+    if ((ebr == NULL) || (record == NULL)){
+        return;
+    }
+
+    // Secciones anidadas: solo la más externa anuncia la época:
+    if (record->nesting++ > 0){
+        return;
+    }
+
+    // Anuncio de la época observada antes de leer cualquier referencia compartida:
+    uint64_t epoch = atomic_load(&ebr->epoch);
+    atomic_store(&record->state, (epoch << 1) | 1);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    _ebr_collect(record, epoch);
+}
+
+/*
+    @brief Función para salir de una sección crítica.
+    @note: Si el hilo acumula más de EBR_LIMBO_LIMIT retiradas pendientes, espera (cediendo la CPU) hasta volver a estar
+           por debajo del límite. Así la memoria retenida por hilo queda acotada aunque otro hilo se detenga dentro de una
+           sección crítica: los hilos que retiran se frenan en lugar de acumular memoria sin límite. Los hilos registrados
+           pero fuera de una sección crítica nunca bloquean la reclamación.
+
+    @param ebr_pt ebr: Referencia al dominio.
+    @param ebr_record_pt record: Registro del hilo.
+
+    @retval None.
+*/
+void ebr_exit(ebr_pt ebr, ebr_record_pt record){
+    // Comprobación de dominio y registro válidos (y de sección abierta):
+    if ((ebr == NULL) || (record == NULL) || (record->nesting == 0)){
+        return;
+    }
+
+    // Secciones anidadas: solo la más externa sale de la época:
+    if (--record->nesting > 0){
+        return;
+    }
+    atomic_store_explicit(&record->state, 0, memory_order_release);
+
+    // Garantía de memoria acotada: espera a que se libere lo suficiente:
+    while (record->pending > EBR_LIMBO_LIMIT){
+        if (ebr_reclaim(ebr, record) == 0){
+            sched_yield();
+        }
+    }
+}
+
+/*
+    @brief Función para retirar una referencia ya desenlazada del contenedor y liberarla cuando sea seguro.
+    @note: La referencia se libera con free_fn (free si es NULL) cuando la época global haya avanzado dos veces desde la
+           retirada, es decir, cuando todos los hilos que pudieran verla hayan salido de su sección crítica.
+    @note: Cada EBR_BATCH retiradas se intenta avanzar la época y liberar por lotes.
+
+    @param ebr_pt ebr: Referencia al dominio.
+    @param ebr_record_pt record: Registro del hilo.
+    @param void * ptr: Referencia retirada.
+    @param void (*free_fn)(void *): Función de liberación (NULL para free).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Dominio, registro o referencia no válidos.
+                -> 2: Sin memoria para la lista de espera (la referencia no se ha retirado).
+*/
+uint8_t ebr_retire(ebr_pt ebr, ebr_record_pt record, void * ptr, void (*free_fn)(void *)){
+    // Comprobación de dominio, registro y referencia válidos:
+    if ((ebr == NULL) || (record == NULL) || (ptr == NULL)){
+        return 1;
+    }
+
+    // Época de la retirada: la global leída tras desenlazar la referencia (no la anunciada por el hilo, que puede ser
+    // anterior). Cualquier hilo que aún la vea anunció esa época o una previa, así que e + 2 solo se alcanza cuando ha salido:
+    uint64_t epoch = atomic_load(&ebr->epoch);
+
+    // Reutilización de la lista de la época: las épocas de retirada de un hilo no decrecen, así que lo que contenga es de
+    // hace al menos EBR_EPOCHS épocas (ya seguro porque la época global actual es al menos la de la retirada):
+    size_t index = epoch % EBR_EPOCHS;
+    if (record->limbo_epoch[index] != epoch){
+        record->pending -= _ebr_free_limbo(record->limbo[index]);
+        record->limbo_epoch[index] = epoch;
+    }
+
+    // Inserción en la lista de espera (con crecimiento geométrico):
+    array_pt limbo = record->limbo[index];
+    if ((limbo->size == limbo->capacity) && (array_reserve(limbo, 2 * limbo->capacity + ALLOC_BLOCK_SIZE) != 0)){
+        return 2;
+    }
+    ebr_entry_t entry = {ptr, (free_fn != NULL) ? free_fn : free};
+    array_set(limbo, &entry, limbo->size);
+    record->pending++;
+
+    // Reclamación por lotes:
+    if ((record->pending % EBR_BATCH) == 0){
+        ebr_reclaim(ebr, record);
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función para intentar avanzar la época global y liberar las retiradas del hilo que ya sean seguras.
+
+    @param ebr_pt ebr: Referencia al dominio.
+    @param ebr_record_pt record: Registro del hilo.
+
+    @retval size_t: Número de referencias liberadas.
+*/
+size_t ebr_reclaim(ebr_pt ebr, ebr_record_pt record){
+    // Comprobación de dominio y registro válidos:
+    if ((ebr == NULL) || (record == NULL)){
+        return 0;
+    }
+
+    _ebr_try_advance(ebr);
+    return _ebr_collect(record, atomic_load(&ebr->epoch));
+}
+
+/*
+    @brief Función para esperar a que se liberen todas las retiradas pendientes del hilo.
+    @note: Debe llamarse fuera de una sección crítica; espera a que los hilos que estén dentro de una salgan de ella.
+
+    @param ebr_pt ebr: Referencia al dominio.
+    @param ebr_record_pt record: Registro del hilo.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Dominio o registro no válidos.
+                -> 2: El hilo está dentro de una sección crítica.
+*/
+uint8_t ebr_synchronize(ebr_pt ebr, ebr_record_pt record){
+    // Comprobación de dominio y registro válidos:
+    if ((ebr == NULL) || (record == NULL)){
+        return 1;
+    }
+
+    // Comprobación de sección crítica cerrada (esperar dentro de una no terminaría nunca):
+    if (record->nesting > 0){
+        return 2;
+    }
+
+    while (record->pending > 0){
+        if (ebr_reclaim(ebr, record) == 0){
+            sched_yield();
+        }
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función para obtener el número de retiradas del hilo pendientes de liberar.
+
+    @param const ebr_record_pt record: Registro del hilo.
+
+    @retval size_t: Retiradas pendientes (0 si el registro no es válido).
+*/
+size_t ebr_pending(const ebr_record_pt record){
+    // Comprobación de registro válido:
+    if (record == NULL){
+        return 0;
+    }
+
+    return record->pending;
+}
+
+/*
+    @brief Función para obtener la época global actual.
+
+    @param const ebr_pt ebr: Referencia al dominio.
+
+    @retval uint64_t: Época global (0 si el dominio no es válido).
+*/
+uint64_t ebr_epoch(const ebr_pt ebr){
+    // Comprobación de dominio válido:
+    if (ebr == NULL){
+        return 0;
+    }
+
+    return atomic_load(&ebr->epoch);
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna que avanza la época global si todos los hilos en sección crítica ya han observado la actual.
+
+    @param ebr_pt ebr: Referencia al dominio.
+
+    @retval bool: true si la época ha avanzado (por este u otro hilo), false si algún hilo la retiene.
+*/
+static bool _ebr_try_advance(ebr_pt ebr){
+    uint64_t epoch = atomic_load(&ebr->epoch);
+
+    for (ebr_record_pt temp_record = atomic_load(&ebr->records); temp_record != NULL; temp_record = temp_record->next){
+        uint64_t state = atomic_load(&temp_record->state);
+        if ((state & 1) && ((state >> 1) != epoch)){
+            return false;
+        }
+    }
+
+    return atomic_compare_exchange_strong(&ebr->epoch, &epoch, epoch + 1) || (epoch != atomic_load(&ebr->epoch));
+}
+
+/*
+    @brief Función interna que libera las listas de espera del hilo cuyas retiradas ya son seguras en la época dada.
+    @note: Una retirada de la época e es segura cuando la época global es e + 2 o posterior.
+
+    @param ebr_record_pt record: Registro del hilo.
+    @param uint64_t epoch: Época global observada.
+
+    @retval size_t: Número de referencias liberadas.
+*/
+static size_t _ebr_collect(ebr_record_pt record, uint64_t epoch){
+    size_t freed = 0;
+    for (size_t i = 0; i < EBR_EPOCHS; i++){
+        if ((record->limbo[i]->size > 0) && (record->limbo_epoch[i] + 2 <= epoch)){
+            freed += _ebr_free_limbo(record->limbo[i]);
+        }
+    }
+    record->pending -= freed;
+
+    return freed;
+}
+
+/*
+    @brief Función interna que libera todas las referencias de una lista de espera y la vacía.
+
+    @param array_pt limbo: Lista de espera (struct ebr_entry).
+
+    @retval size_t: Número de referencias liberadas.
+*/
+static size_t _ebr_free_limbo(array_pt limbo){
+    ebr_entry_pt entries = (ebr_entry_pt)limbo->arr;
+    size_t count = limbo->size;
+    for (size_t i = 0; i < count; i++){
+        entries[i].free_fn(entries[i].ptr);
+    }
+    limbo->size = 0;
+
+    return count;
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
@@ -0,0 +1,88 @@
+#ifndef EBR_HEADER
+#define EBR_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#include "../array/array.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define EBR_CACHE_LINE 64           // Tamaño (bytes) de la línea de caché usada para separar registros.
+#define EBR_EPOCHS 3                // Listas de espera (limbo) por hilo: época actual y las dos anteriores.
+#define EBR_BATCH 64                // Retiradas entre intentos de avanzar la época y liberar.
+#define EBR_LIMBO_LIMIT 4096        // Retiradas pendientes por hilo a partir de las que ebr_exit espera a liberar.
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos --------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct ebr_entry{
+    void * ptr;                     // Referencia retirada.
+    void (*free_fn)(void *);        // Función de liberación.
+};
+
+struct ebr_record{
+    _Alignas(EBR_CACHE_LINE) _Atomic uint64_t state;    // (época << 1) | 1 dentro de una sección crítica, 0 fuera.
+    atomic_bool in_use;             // Indica si el registro está asignado a un hilo.
+    struct ebr_record * next;       // Siguiente registro (inmutable tras publicarse).
+
+    size_t nesting;                 // Profundidad de secciones críticas anidadas.
+    uint64_t limbo_epoch[EBR_EPOCHS];   // Época de las retiradas de cada lista de espera.
+    array_pt limbo[EBR_EPOCHS];     // Listas de espera (struct ebr_entry) por época.
+    size_t pending;                 // Retiradas pendientes de liberar en total.
+};
+
+struct ebr{
+    _Alignas(EBR_CACHE_LINE) _Atomic uint64_t epoch;    // Época global.
+    _Alignas(EBR_CACHE_LINE) _Atomic(struct ebr_record *) records;  // Lista de registros de hilos.
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct ebr_entry ebr_entry_t;
+typedef ebr_entry_t * ebr_entry_pt;
+
+typedef struct ebr_record ebr_record_t;
+typedef ebr_record_t * ebr_record_pt;
+
+typedef struct ebr ebr_t;
+typedef ebr_t * ebr_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción del dominio de reclamación:
+ebr_pt ebr_init(void);
+void ebr_deinit(ebr_pt * ebr);
+
+// Registro de hilos:
+ebr_record_pt ebr_register(ebr_pt ebr);
+void ebr_unregister(ebr_pt ebr, ebr_record_pt * record);
+
+// Secciones críticas:
+void ebr_enter(ebr_pt ebr, ebr_record_pt record);
+void ebr_exit(ebr_pt ebr, ebr_record_pt record);
+
+// Retirada y liberación:
+uint8_t ebr_retire(ebr_pt ebr, ebr_record_pt record, void * ptr, void (*free_fn)(void *));
+size_t ebr_reclaim(ebr_pt ebr, ebr_record_pt record);
+uint8_t ebr_synchronize(ebr_pt ebr, ebr_record_pt record);
+
+// Utilidades generales:
+size_t ebr_pending(const ebr_record_pt record);
+uint64_t ebr_epoch(const ebr_pt ebr);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include "ebr.h"
+#include <stdio.h>
+#include <pthread.h>
+
+#define TEST_READERS 3
+#define TEST_UPDATES 20000
+
+struct config{
+    uint64_t version;               // Versión de la configuración.
+    uint64_t check;                 // Copia de la versión (detecta lecturas de memoria liberada).
+};
+
+struct test_args{
+    ebr_pt ebr;                     // Dominio de reclamación compartido.
+    _Atomic(struct config *) * current;     // Configuración publicada.
+    atomic_bool * done;             // Indica a los lectores que terminen.
+    size_t reads;                   // Lecturas realizadas por el hilo.
+    size_t errors;                  // Lecturas incoherentes.
+};
+
+// Prototipos de funciones:
+void config_free(void * ptr);
+void * reader_thread(void * arg);
+
+// Contador de configuraciones liberadas:
+atomic_size_t freed = 0;
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación del dominio y registro del hilo principal:
+    ebr_pt ebr = ebr_init();
+    ebr_record_pt record = ebr_register(ebr);
+    printf("\nSe ha creado el dominio correctamente en la dirección (%p), registro: (%p)\n", (void *)ebr, (void *)record);
+
+    // Retiradas desde un solo hilo: nada se libera hasta que la época avanza dos veces:
+    for (uint64_t i = 0; i < 10; i++){
+        struct config * temp_config = (struct config *)malloc(sizeof(struct config));
+        ebr_enter(ebr, record);
+        ebr_retire(ebr, record, temp_config, config_free);
+        ebr_exit(ebr, record);
+    }
+    printf("Retiradas pendientes: %ld, liberadas: %ld (época %lu)\n", ebr_pending(record), (size_t)atomic_load(&freed), ebr_epoch(ebr));
+    ebr_synchronize(ebr, record);
+    printf("Tras ebr_synchronize -> pendientes: %ld, liberadas: %ld (época %lu)\n", ebr_pending(record), (size_t)atomic_load(&freed), ebr_epoch(ebr));
+
+    // Retirada dentro de una sección crítica que anunció una época ya superada: un lector que entró en la época
+    // siguiente (X) puede seguir viendo la referencia, que no debe liberarse mientras X no salga:
+    ebr_record_pt late = ebr_register(ebr);
+    ebr_record_pt reader = ebr_register(ebr);
+    struct config * shared = (struct config *)malloc(sizeof(struct config));
+    *shared = (struct config){7, 7};
+    atomic_store(&freed, 0);
+    ebr_enter(ebr, late);
+    ebr_reclaim(ebr, record);
+    ebr_enter(ebr, reader);
+    ebr_retire(ebr, late, shared, config_free);
+    ebr_exit(ebr, late);
+    ebr_reclaim(ebr, record);
+    ebr_enter(ebr, late);
+    printf("\nRetirada con época anunciada antigua -> liberada con un lector dentro: %d (época %lu)\n",
+           atomic_load(&freed) != 0, ebr_epoch(ebr));
+    ebr_exit(ebr, late);
+    ebr_exit(ebr, reader);
+    ebr_synchronize(ebr, late);
+    printf("Tras salir el lector y sincronizar -> liberada: %d\n", atomic_load(&freed) != 0);
+    ebr_unregister(ebr, &late);
+    ebr_unregister(ebr, &reader);
+
+    // Un escritor sustituye la configuración mientras varios lectores la leen:
+    struct config * initial = (struct config *)malloc(sizeof(struct config));
+    *initial = (struct config){0, 0};
+    _Atomic(struct config *) current = initial;
+    atomic_bool done = false;
+    atomic_store(&freed, 0);
+
+    pthread_t readers[TEST_READERS];
+    struct test_args args[TEST_READERS];
+    for (size_t i = 0; i < TEST_READERS; i++){
+        args[i] = (struct test_args){.ebr = ebr, .current = &current, .done = &done, .reads = 0, .errors = 0};
+        pthread_create(&readers[i], NULL, reader_thread, &args[i]);
+    }
+
+    for (uint64_t i = 1; i <= TEST_UPDATES; i++){
+        struct config * temp_config = (struct config *)malloc(sizeof(struct config));
+        *temp_config = (struct config){i, i};
+        ebr_enter(ebr, record);
+        struct config * old_config = atomic_exchange(&current, temp_config);
+        ebr_retire(ebr, record, old_config, config_free);
+        ebr_exit(ebr, record);
+    }
+    atomic_store(&done, true);
+
+    size_t errors = 0;
+    for (size_t i = 0; i < TEST_READERS; i++){
+        pthread_join(readers[i], NULL);
+        errors += args[i].errors;
+    }
+    ebr_synchronize(ebr, record);
+    printf("\n%d actualizaciones con %d lectores: liberadas %ld, pendientes %ld, lecturas incoherentes: %ld\n",
+           TEST_UPDATES, TEST_READERS, (size_t)atomic_load(&freed), ebr_pending(record), errors);
+
+    // Baja del hilo y destrucción del dominio:
+    free(atomic_load(&current));
+    ebr_unregister(ebr, &record);
+    ebr_deinit(&ebr);
+    printf("\nDominio destruido, referencia: %p\n", (void *)ebr);
+
+    return 0;
+}
+
+/*
+    @brief Función de liberación de una configuración que la invalida y cuenta las liberaciones.
+
+    @param void * ptr: Referencia a la configuración.
+
+    @retval None.
+*/
+void config_free(void * ptr){
+    ((struct config *)ptr)->check = UINT64_MAX;
+    free(ptr);
+    atomic_fetch_add(&freed, 1);
+}
+
+/*
+    @brief Función del hilo lector: lee la configuración publicada dentro de secciones críticas.
+
+    @param void * arg: Referencia a los argumentos (struct test_args).
+
+    @retval void *: NULL.
+*/
+void * reader_thread(void * arg){
+    struct test_args * args = (struct test_args *)arg;
+    ebr_record_pt record = ebr_register(args->ebr);
+    while (!atomic_load(args->done)){
+        ebr_enter(args->ebr, record);
+        struct config * temp_config = atomic_load(args->current);
+        if (temp_config->version != temp_config->check){
+            args->errors++;
+        }
+        args->reads++;
+        ebr_exit(args->ebr, record);
+    }
+    ebr_unregister(args->ebr, &record);
+
+    return NULL;
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "hashmap.h"
+#include "../llist/dllist.h"
+#include <stdio.h>
+#include <time.h>
+
+struct bench_entry{
+    uint32_t key;
+    uint32_t value;
+};
+
+// Prototipos de funciones:
+double elapsed_ms(struct timespec start, struct timespec end);
+bool is_equal_key(const void * target, const void * data);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Número de elementos y de búsquedas (por argumento o por defecto):
+    size_t n = (argc > 1) ? strtoul(argv[1], NULL, 10) : 4096;
+    size_t lookups = (argc > 2) ? strtoul(argv[2], NULL, 10) : 100000;
+    if (n == 0){
+        n = 1;
+    }
+
+    hashmap_pt map = hashmap_init(sizeof(uint32_t), sizeof(uint32_t), 0, NULL);
+    dll_linkedlist_pt list = dllist_init(sizeof(struct bench_entry));
+
+    // Construcción de ambos contenedores con las mismas claves:
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < n; i++){
+        uint32_t value = i ^ 0x5A5A;
+        hashmap_insert(map, &i, &value);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double map_build = elapsed_ms(start, end);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < n; i++){
+        struct bench_entry entry = {.key = i, .value = i ^ 0x5A5A};
+        dllist_push_back(list, &entry);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double list_build = elapsed_ms(start, end);
+
+    // Búsquedas (claves pseudoaleatorias, mitad presentes y mitad ausentes):
+    uint64_t check_map = 0;
+    uint32_t seed = 12345;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < lookups; i++){
+        seed = seed * 1103515245 + 12345;
+        uint32_t key = seed % (2 * n);
+        uint32_t * value = (uint32_t *)hashmap_find(map, &key);
+        check_map += (value != NULL) ? *value : 0;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double map_find = elapsed_ms(start, end);
+
+    uint64_t check_list = 0;
+    seed = 12345;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < lookups; i++){
+        seed = seed * 1103515245 + 12345;
+        struct bench_entry target = {.key = seed % (2 * n)};
+        struct bench_entry * entry = (struct bench_entry *)dllist_find(list, &target, is_equal_key);
+        check_list += (entry != NULL) ? entry->value : 0;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double list_find = elapsed_ms(start, end);
+
+    // Resultados:
+    printf("\nElementos: %ld, búsquedas: %ld (comprobación %s)\n", n, lookups, (check_map == check_list) ? "correcta" : "INCORRECTA");
+    printf("%-10s %14s %14s %14s\n", "", "inserción(ms)", "búsqueda(ms)", "ns/búsqueda");
+    printf("%-10s %14.3f %14.3f %14.1f\n", "hashmap", map_build, map_find, map_find * 1e6 / lookups);
+    printf("%-10s %14.3f %14.3f %14.1f\n", "dllist", list_build, list_find, list_find * 1e6 / lookups);
+
+    hashmap_deinit(&map);
+    dllist_deinit(&list);
+
+    return 0;
+}
+
+/*
+    @brief Función que calcula el tiempo transcurrido entre dos marcas de tiempo.
+
+    @param struct timespec start: Marca de inicio.
+    @param struct timespec end: Marca de fin.
+
+    @retval double: Tiempo transcurrido en milisegundos.
+*/
+double elapsed_ms(struct timespec start, struct timespec end){
+    return (double)(end.tv_sec - start.tv_sec) * 1e3 + (double)(end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+/*
+    @brief Función de comparación por clave entre dos entradas del benchmark.
+
+    @param const void * target: Referencia a la entrada buscada.
+    @param const void * data: Referencia a la entrada de la lista.
+
+    @retval bool: true si las claves coinciden, false en otro caso.
+*/
+bool is_equal_key(const void * target, const void * data){
+    return ((const struct bench_entry *)target)->key == ((const struct bench_entry *)data)->key;
+}
\ No newline at end of file
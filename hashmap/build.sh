@@ -0,0 +1,82 @@
+#!/bin/bash
+
+
+# Variables de entorno             #
+# -------------------------------- #
+CC=gcc
+CFLAGS_TEST="-g -Wall -O2"
+CFLAGS_LIB="-Wall -O2 -fPIC -shared"
+CFLAGS_BENCH="-Wall -O2 -march=native"
+
+SRC_HASHMAP="hashmap.c ../array/array.c"
+SRC_TEST=test_hashmap.c
+SRC_BENCH="bench_hashmap.c ../llist/dllist.c"
+
+TEST_PROG=test_hashmap.elf
+BENCH_PROG=bench_hashmap.elf
+LIB_PROG=hashmap.so
+# -------------------------------- #
+
+
+# Lógica de uso                    #
+# -------------------------------- #
+if [ "$1" == "test" ]; then
+    echo
+    echo "[BUILD-HASHMAP-TEST]: Compilando programa de prueba de hashmap..."
+    if $CC $CFLAGS_TEST $SRC_TEST $SRC_HASHMAP -o $TEST_PROG; then
+        echo "[BUILD-HASHMAP-TEST]: Compilación completada."
+        echo "[BUILD-HASHMAP-TEST]: Ejecutando programa de prueba..."
+        echo
+        ./$TEST_PROG
+        echo
+        echo "[BUILD-HASHMAP-TEST]: Ejecución de programa de prueba finalizado."
+    else
+        echo "[BUILD-HASHMAP-TEST][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$1" == "bench" ]; then
+    echo
+    echo "[BUILD-HASHMAP-BENCH]: Compilando benchmark de hashmap..."
+    if $CC $CFLAGS_BENCH $SRC_BENCH $SRC_HASHMAP -o $BENCH_PROG; then
+        echo "[BUILD-HASHMAP-BENCH]: Compilación completada."
+        echo "[BUILD-HASHMAP-BENCH]: Ejecutando benchmark..."
+        echo
+        ./$BENCH_PROG "${@:2}"
+        echo
+        echo "[BUILD-HASHMAP-BENCH]: Ejecución de benchmark finalizada."
+    else
+        echo "[BUILD-HASHMAP-BENCH][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$1" == "lib" ]; then
+    echo
+    echo "[BUILD-HASHMAP-LIB]: Compilando la librería de hashmap..."
+    if $CC $CFLAGS_LIB $SRC_HASHMAP -o $LIB_PROG; then
+        mv $LIB_PROG ./lib
+        echo "[BUILD-HASHMAP-LIB]: Librearía compilada."
+    else
+        echo "[BUILD-HASHMAP-LIB][ERR]: Error de compilación, librería no generada."
+    fi
+    echo
+
+elif [ "$1" == "clean" ]; then
+    echo
+    echo "[BUILD-HASHMAP-CLEAN]: Limpiando espacio de trabajo..."
+    rm -f ./$TEST_PROG ./$BENCH_PROG ./lib/$LIB_PROG
+    echo "[BUILD-HASHMAP-CLEAN]: Espacio de trabajo limpio."
+    echo
+
+else
+    echo
+    echo "[BUILD-HASHMAP][ERR]: Uso incorrecto u opciones inválidas."
+    echo -e "\n\t[Uso]:"
+    echo -e "\t\t-> ./build.sh test: \tCompila y ejecuta el programa de test (.elf)"
+    echo -e "\t\t-> ./build.sh bench [n] [búsquedas]: \tCompila y ejecuta el benchmark frente a dllist_find (.elf)"
+    echo -e "\t\t-> ./build.sh lib: \tCompila y genera la librería compartida (.so) bajo la carpeta lib/"
+    echo -e "\t\t-> ./build.sh clean: \tLimpia el espacio de trabajo eliminando archivos generados"
+    echo
+    exit 1
+fi
+# -------------------------------- #
\ No newline at end of file
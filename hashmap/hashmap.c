@@ -0,0 +1,645 @@
+#include "hashmap.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static inline uint64_t _hashmap_mix64(uint64_t x);
+static size_t _hashmap_natural_align(size_t size);
+static size_t _hashmap_align_up(size_t size, size_t align);
+static inline uint32_t _hashmap_group_match(const uint8_t * group, uint8_t h2);
+static inline uint32_t _hashmap_group_match_empty(const uint8_t * group);
+static inline uint32_t _hashmap_group_match_free(const uint8_t * group);
+static inline void _hashmap_set_ctrl(hashmap_pt map, size_t index, uint8_t value);
+static size_t _hashmap_max_items(size_t capacity, uint8_t max_load);
+static size_t _hashmap_find_index(const hashmap_pt map, const void * key, uint64_t hash);
+static size_t _hashmap_find_free_index(const uint8_t * ctrl, size_t capacity, uint64_t hash);
+static uint8_t _hashmap_rehash(hashmap_pt map, size_t new_capacity);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar un mapa hash de direccionamiento abierto (estilo Swiss table).
+    @note: Claves y valores son de tamaño fijo y se copian en ranuras planas, con los mismos límites de tamaño que los elementos de array_t.
+
+    @param size_t key_size: Tamaño (en bytes) de la clave.
+    @param size_t value_size: Tamaño (en bytes) del valor.
+    @param uint8_t max_load: Porcentaje de ocupación máxima [HASHMAP_MIN_LOAD, HASHMAP_MAX_LOAD] (0 = HASHMAP_DEFAULT_MAX_LOAD).
+    @param uint64_t (*hash_fn)(const void *, size_t): Referencia a la función hash (nulo = hashmap_hash_default).
+
+    @retval hashmap_pt: Referencia al mapa creado.
+*/
+hashmap_pt hashmap_init(size_t key_size, size_t value_size, uint8_t max_load, uint64_t (*hash_fn)(const void *, size_t)){
+    // Comprobación de los límites de tamaño de clave, valor y ocupación:
+    if ((key_size < MIN_ELEMENT_SIZE) || (key_size > MAX_ELEMENT_SIZE) || (value_size < MIN_ELEMENT_SIZE) || (value_size > MAX_ELEMENT_SIZE)){
+        return NULL;
+    }
+
+    if (max_load == 0){
+        max_load = HASHMAP_DEFAULT_MAX_LOAD;
+    }
+
+    if ((max_load < HASHMAP_MIN_LOAD) || (max_load > HASHMAP_MAX_LOAD)){
+        return NULL;
+    }
+
+    // Reserva de memoria para la estructura básica del mapa:
+    hashmap_pt map = (hashmap_pt)malloc(sizeof(hashmap_t));
+    if (map == NULL){
+        return NULL;
+    }
+
+    // Inicio de los miembros de la estructura y reserva de la capacidad inicial:
+    map->ctrl = NULL;
+    map->slots = NULL;
+    map->key_size = key_size;
+    map->value_size = value_size;
+    map->value_offset = _hashmap_align_up(key_size, _hashmap_natural_align(value_size));
+    map->slot_size = _hashmap_align_up(map->value_offset + value_size, _hashmap_natural_align(key_size) > _hashmap_natural_align(value_size) ?
+                                       _hashmap_natural_align(key_size) : _hashmap_natural_align(value_size));
+    map->capacity = 0;
+    map->size = 0;
+    map->growth_left = 0;
+    map->max_load = max_load;
+    map->hash_fn = (hash_fn != NULL) ? hash_fn : hashmap_hash_default;
+
+    if (_hashmap_rehash(map, HASHMAP_MIN_CAPACITY) != 0){
+        free(map);
+        return NULL;
+    }
+
+    return map;
+}
+
+/*
+    @brief Función para destruir y liberar un mapa hash.
+
+    @param hashmap_pt * map: Referencia a la referencia del mapa.
+
+    @retval None.
+*/
+void hashmap_deinit(hashmap_pt * map){
+    // Comprobación de que el mapa no sea nulo:
+    if ((map == NULL) || (*map == NULL)){
+        return;
+    }
+
+    // Liberación de control, ranuras y estructura:
+    free((*map)->ctrl);
+    free((*map)->slots);
+    free(*map);
+    *map = NULL;
+}
+
+/*
+    @brief Función para eliminar todos los elementos conservando la capacidad reservada.
+
+    @param hashmap_pt map: Referencia al mapa.
+
+    @retval None.
+*/
+void hashmap_clear(hashmap_pt map){
+    // Comprobación de mapa válido:
+    if (map == NULL){
+        return;
+    }
+
+    // Marcado de todas las ranuras como vacías:
+    memset(map->ctrl, HASHMAP_CTRL_EMPTY, map->capacity + HASHMAP_GROUP_WIDTH);
+    map->size = 0;
+    map->growth_left = _hashmap_max_items(map->capacity, map->max_load);
+}
+
+/*
+    @brief Función para reservar capacidad suficiente para count elementos sin redimensionar.
+
+    @param hashmap_pt map: Referencia al mapa.
+    @param size_t count: Número de elementos que se quiere poder almacenar.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: El mapa no es válido.
+                -> 2: Error al ajustar el tamaño del mapa (o capacidad solicitada no representable).
+*/
+uint8_t hashmap_reserve(hashmap_pt map, size_t count){
+    // Comprobación de mapa válido:
+    if (map == NULL){
+        return 1;
+    }
+
+    // Cálculo de la capacidad necesaria (potencia de 2):
+    size_t new_capacity = map->capacity;
+    while (_hashmap_max_items(new_capacity, map->max_load) < count){
+        // Comprobación de desbordamiento de la capacidad y del tamaño en bytes de ranuras y control:
+        if ((new_capacity > (SIZE_MAX / 2)) || ((new_capacity * 2) > ((SIZE_MAX - HASHMAP_GROUP_WIDTH) / map->slot_size))){
+            return 2;
+        }
+        new_capacity *= 2;
+    }
+
+    if (new_capacity == map->capacity){
+        return 0;
+    }
+
+    return (_hashmap_rehash(map, new_capacity) == 0) ? 0 : 2;
+}
+
+/*
+    @brief Función para insertar un par clave-valor, o actualizar el valor si la clave ya existe.
+
+    @param hashmap_pt map: Referencia al mapa.
+    @param const void * key: Referencia a la clave.
+    @param const void * value: Referencia al valor.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Mapa, clave o valor no válidos.
+                -> 2: Error al ajustar el tamaño del mapa.
+*/
+uint8_t hashmap_insert(hashmap_pt map, const void * key, const void * value){
+    // Comprobación de mapa, clave y valor válidos:
+    if ((map == NULL) || (key == NULL) || (value == NULL)){
+        return 1;
+    }
+
+    // Caso de clave existente (actualización del valor):
+    uint64_t hash = map->hash_fn(key, map->key_size);
+    size_t index = _hashmap_find_index(map, key, hash);
+    uint8_t * slot;
+    if (index != map->capacity){
+        slot = (uint8_t *)map->slots + (index * map->slot_size);
+        memcpy(slot + map->value_offset, value, map->value_size);
+        return 0;
+    }
+
+    // Redimensionado si no quedan ranuras vacías disponibles (misma capacidad si abundan las borradas):
+    if (map->growth_left == 0){
+        size_t new_capacity = map->capacity;
+        if ((map->size * 2) >= _hashmap_max_items(map->capacity, map->max_load)){
+            new_capacity *= 2;
+        }
+        if (_hashmap_rehash(map, new_capacity) != 0){
+            return 2;
+        }
+    }
+
+    // Ocupación de la primera ranura libre de la secuencia de sondeo:
+    index = _hashmap_find_free_index(map->ctrl, map->capacity, hash);
+    if (map->ctrl[index] == HASHMAP_CTRL_EMPTY){
+        map->growth_left--;
+    }
+    _hashmap_set_ctrl(map, index, (uint8_t)(hash & 0x7F));
+
+    slot = (uint8_t *)map->slots + (index * map->slot_size);
+    memcpy(slot, key, map->key_size);
+    memcpy(slot + map->value_offset, value, map->value_size);
+    map->size++;
+
+    return 0;
+}
+
+/*
+    @brief Función que busca una clave y retorna la referencia a su valor dentro del mapa.
+    @note: La referencia deja de ser válida tras cualquier inserción (puede redimensionar).
+
+    @param const hashmap_pt map: Referencia al mapa.
+    @param const void * key: Referencia a la clave.
+
+    @retval void *: Referencia al valor (nulo si la clave no está en el mapa).
+*/
+void * hashmap_find(const hashmap_pt map, const void * key){
+    // Comprobación de mapa y clave válidos:
+    if ((map == NULL) || (key == NULL)){
+        return NULL;
+    }
+
+    // Búsqueda de la ranura de la clave:
+    size_t index = _hashmap_find_index(map, key, map->hash_fn(key, map->key_size));
+    if (index == map->capacity){
+        return NULL;
+    }
+
+    return (uint8_t *)map->slots + (index * map->slot_size) + map->value_offset;
+}
+
+/*
+    @brief Función para eliminar una clave (y su valor) del mapa.
+    @note: Si ningún grupo que contiene la ranura ha llegado a estar lleno, la ranura vuelve a quedar vacía; si no, se marca como borrada.
+
+    @param hashmap_pt map: Referencia al mapa.
+    @param const void * key: Referencia a la clave.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Mapa o clave no válidos.
+                -> 2: La clave no está en el mapa.
+*/
+uint8_t hashmap_erase(hashmap_pt map, const void * key){
+    // Comprobación de mapa y clave válidos:
+    if ((map == NULL) || (key == NULL)){
+        return 1;
+    }
+
+    // Búsqueda de la ranura de la clave:
+    size_t index = _hashmap_find_index(map, key, map->hash_fn(key, map->key_size));
+    if (index == map->capacity){
+        return 2;
+    }
+
+    // Comprobación de si alguna secuencia de sondeo ha podido pasar por la ranura (grupo lleno a su alrededor):
+    size_t mask = map->capacity - 1;
+    uint32_t empty_before = _hashmap_group_match_empty(map->ctrl + ((index - HASHMAP_GROUP_WIDTH) & mask));
+    uint32_t empty_after = _hashmap_group_match_empty(map->ctrl + index);
+    bool was_never_full = (empty_before != 0) && (empty_after != 0) &&
+                          ((size_t)(__builtin_clz(empty_before) - (32 - HASHMAP_GROUP_WIDTH) + __builtin_ctz(empty_after)) < HASHMAP_GROUP_WIDTH);
+
+    if (was_never_full){
+        _hashmap_set_ctrl(map, index, HASHMAP_CTRL_EMPTY);
+        map->growth_left++;
+    } else {
+        _hashmap_set_ctrl(map, index, HASHMAP_CTRL_DELETED);
+    }
+
+    map->size--;
+
+    return 0;
+}
+
+/*
+    @brief Función para iterar sobre los elementos del mapa (en orden de ranura).
+    @note: El iterador se inicia a 0. Se puede eliminar el elemento actual durante la iteración, pero no insertar.
+
+    @param const hashmap_pt map: Referencia al mapa.
+    @param size_t * iter: Referencia al iterador (posición de la siguiente ranura a examinar).
+    @param void ** out_key: Referencia donde se guarda la referencia a la clave (puede ser nulo).
+    @param void ** out_value: Referencia donde se guarda la referencia al valor (puede ser nulo).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores (elemento obtenido).
+                -> 1: Mapa o iterador no válidos.
+                -> 2: No quedan elementos.
+*/
+uint8_t hashmap_next(const hashmap_pt map, size_t * iter, void ** out_key, void ** out_value){
+    // Comprobación de mapa e iterador válidos:
+    if ((map == NULL) || (iter == NULL)){
+        return 1;
+    }
+
+    // Avance hasta la siguiente ranura ocupada (bit alto del byte de control a 0):
+    while (*iter < map->capacity){
+        size_t index = (*iter)++;
+        if ((map->ctrl[index] & 0x80) == 0){
+            uint8_t * slot = (uint8_t *)map->slots + (index * map->slot_size);
+            if (out_key != NULL){
+                *out_key = slot;
+            }
+            if (out_value != NULL){
+                *out_value = slot + map->value_offset;
+            }
+            return 0;
+        }
+    }
+
+    return 2;
+}
+
+/*
+    @brief Función hash por defecto: mezcla directa para claves de 4 y 8 bytes, y mezcla por bloques de 8 bytes para el resto.
+
+    @param const void * key: Referencia a la clave.
+    @param size_t key_size: Tamaño (en bytes) de la clave.
+
+    @retval uint64_t: Hash de la clave.
+*/
+uint64_t hashmap_hash_default(const void * key, size_t key_size){
+    // Casos rápidos para claves de tamaño fijo habitual:
+    if (key_size == sizeof(uint64_t)){
+        uint64_t value;
+        memcpy(&value, key, sizeof(uint64_t));
+        return _hashmap_mix64(value);
+    }
+
+    if (key_size == sizeof(uint32_t)){
+        uint32_t value;
+        memcpy(&value, key, sizeof(uint32_t));
+        return _hashmap_mix64(value);
+    }
+
+    // Mezcla por bloques de 8 bytes y resto final:
+    const uint8_t * bytes = (const uint8_t *)key;
+    uint64_t hash = 0x9E3779B97F4A7C15ULL ^ key_size;
+    uint64_t block;
+    while (key_size >= sizeof(uint64_t)){
+        memcpy(&block, bytes, sizeof(uint64_t));
+        hash = (hash ^ _hashmap_mix64(block)) * 0x9E3779B97F4A7C15ULL;
+        bytes += sizeof(uint64_t);
+        key_size -= sizeof(uint64_t);
+    }
+
+    if (key_size > 0){
+        block = 0;
+        memcpy(&block, bytes, key_size);
+        hash = (hash ^ _hashmap_mix64(block)) * 0x9E3779B97F4A7C15ULL;
+    }
+
+    return _hashmap_mix64(hash);
+}
+
+/*
+    @brief Función que retorna el número de elementos del mapa.
+
+    @param const hashmap_pt map: Referencia al mapa.
+
+    @retval size_t: Número de elementos.
+*/
+size_t hashmap_size(const hashmap_pt map){
+    // Comprobación de mapa válido:
+    if (map == NULL){
+        return 0;
+    }
+
+    return map->size;
+}
+
+/*
+    @brief Función que retorna la capacidad (número de ranuras) del mapa.
+
+    @param const hashmap_pt map: Referencia al mapa.
+
+    @retval size_t: Capacidad del mapa.
+*/
+size_t hashmap_capacity(const hashmap_pt map){
+    // Comprobación de mapa válido:
+    if (map == NULL){
+        return 0;
+    }
+
+    return map->capacity;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna de mezcla final de 64 bits (fmix64 de MurmurHash3).
+
+    @param uint64_t x: Valor a mezclar.
+
+    @retval uint64_t: Valor mezclado.
+*/
+static inline uint64_t _hashmap_mix64(uint64_t x){
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+/*
+    @brief Función interna que calcula la alineación natural supuesta para un dato de un tamaño dado (potencia de 2, máximo 8).
+
+    @param size_t size: Tamaño (en bytes) del dato.
+
+    @retval size_t: Alineación (en bytes).
+*/
+static size_t _hashmap_natural_align(size_t size){
+    size_t align = 1;
+    while ((align < size) && (align < sizeof(uint64_t))){
+        align *= 2;
+    }
+    return align;
+}
+
+/*
+    @brief Función interna que redondea un tamaño al múltiplo superior de una alineación (potencia de 2).
+
+    @param size_t size: Tamaño (en bytes).
+    @param size_t align: Alineación (en bytes, potencia de 2).
+
+    @retval size_t: Tamaño redondeado.
+*/
+static size_t _hashmap_align_up(size_t size, size_t align){
+    return (size + align - 1) & ~(align - 1);
+}
+
+/*
+    @brief Función interna que compara un grupo de bytes de control con el hash reducido (h2) de una clave.
+
+    @param const uint8_t * group: Referencia al primer byte de control del grupo.
+    @param uint8_t h2: Hash reducido (7 bits) de la clave.
+
+    @retval uint32_t: Máscara de bits de las posiciones del grupo que coinciden.
+*/
+static inline uint32_t _hashmap_group_match(const uint8_t * group, uint8_t h2){
+#ifdef __SSE2__
+    __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)h2)));
+#else
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < HASHMAP_GROUP_WIDTH; i++){
+        mask |= (uint32_t)(group[i] == h2) << i;
+    }
+    return mask;
+#endif
+}
+
+/*
+    @brief Función interna que busca las ranuras vacías de un grupo de bytes de control.
+
+    @param const uint8_t * group: Referencia al primer byte de control del grupo.
+
+    @retval uint32_t: Máscara de bits de las posiciones vacías del grupo.
+*/
+static inline uint32_t _hashmap_group_match_empty(const uint8_t * group){
+    return _hashmap_group_match(group, HASHMAP_CTRL_EMPTY);
+}
+
+/*
+    @brief Función interna que busca las ranuras libres (vacías o borradas) de un grupo de bytes de control.
+
+    @param const uint8_t * group: Referencia al primer byte de control del grupo.
+
+    @retval uint32_t: Máscara de bits de las posiciones libres del grupo (bit alto del byte de control a 1).
+*/
+static inline uint32_t _hashmap_group_match_free(const uint8_t * group){
+#ifdef __SSE2__
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+#else
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < HASHMAP_GROUP_WIDTH; i++){
+        mask |= (uint32_t)(group[i] >> 7) << i;
+    }
+    return mask;
+#endif
+}
+
+/*
+    @brief Función interna que escribe un byte de control, replicándolo al final si pertenece al primer grupo.
+    @note: La réplica permite leer cualquier grupo de HASHMAP_GROUP_WIDTH bytes sin comprobar el final del array de control.
+
+    @param hashmap_pt map: Referencia al mapa.
+    @param size_t index: Posición de la ranura.
+    @param uint8_t value: Valor del byte de control.
+
+    @retval None.
+*/
+static inline void _hashmap_set_ctrl(hashmap_pt map, size_t index, uint8_t value){
+    map->ctrl[index] = value;
+    if (index < HASHMAP_GROUP_WIDTH){
+        map->ctrl[map->capacity + index] = value;
+    }
+}
+
+/*
+    @brief Función interna que calcula el número máximo de ranuras ocupables (llenas o borradas) para una capacidad dada.
+
+    @param size_t capacity: Capacidad (número de ranuras).
+    @param uint8_t max_load: Porcentaje de ocupación máxima.
+
+    @retval size_t: Número máximo de ranuras ocupables (siempre deja al menos una vacía).
+*/
+static size_t _hashmap_max_items(size_t capacity, uint8_t max_load){
+    size_t max_items = (capacity / 100) * max_load + ((capacity % 100) * max_load) / 100;
+    return (max_items < capacity) ? max_items : capacity - 1;
+}
+
+/*
+    @brief Función interna que busca la ranura de una clave mediante sondeo por grupos (triangular).
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param const hashmap_pt map: Referencia al mapa.
+    @param const void * key: Referencia a la clave.
+    @param uint64_t hash: Hash de la clave.
+
+    @retval size_t: Posición de la ranura (capacity si la clave no está en el mapa).
+*/
+static size_t _hashmap_find_index(const hashmap_pt map, const void * key, uint64_t hash){
+    size_t mask = map->capacity - 1;
+    size_t pos = (size_t)(hash >> 7) & mask;
+    size_t stride = 0;
+    uint8_t h2 = (uint8_t)(hash & 0x7F);
+    uint32_t match;
+    size_t index;
+
+    while (true){
+        // Comparación de las claves candidatas del grupo (mismo h2):
+        const uint8_t * group = map->ctrl + pos;
+        match = _hashmap_group_match(group, h2);
+        while (match != 0){
+            index = (pos + (size_t)__builtin_ctz(match)) & mask;
+            if (memcmp((uint8_t *)map->slots + (index * map->slot_size), key, map->key_size) == 0){
+                return index;
+            }
+            match &= match - 1;
+        }
+
+        // Una ranura vacía en el grupo termina la secuencia de sondeo:
+        if (_hashmap_group_match_empty(group) != 0){
+            return map->capacity;
+        }
+
+        stride += HASHMAP_GROUP_WIDTH;
+        pos = (pos + stride) & mask;
+    }
+}
+
+/*
+    @brief Función interna que busca la primera ranura libre (vacía o borrada) de la secuencia de sondeo de un hash.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+    @note: Se supone que existe al menos una ranura libre.
+
+    @param const uint8_t * ctrl: Referencia a los bytes de control.
+    @param size_t capacity: Capacidad (potencia de 2) del mapa.
+    @param uint64_t hash: Hash de la clave.
+
+    @retval size_t: Posición de la ranura libre.
+*/
+static size_t _hashmap_find_free_index(const uint8_t * ctrl, size_t capacity, uint64_t hash){
+    size_t mask = capacity - 1;
+    size_t pos = (size_t)(hash >> 7) & mask;
+    size_t stride = 0;
+    uint32_t match;
+
+    while (true){
+        match = _hashmap_group_match_free(ctrl + pos);
+        if (match != 0){
+            return (pos + (size_t)__builtin_ctz(match)) & mask;
+        }
+
+        stride += HASHMAP_GROUP_WIDTH;
+        pos = (pos + stride) & mask;
+    }
+}
+
+/*
+    @brief Función interna que reubica todos los elementos en un nuevo almacenamiento de la capacidad dada (eliminando las ranuras borradas).
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param hashmap_pt map: Referencia al mapa.
+    @param size_t new_capacity: Nueva capacidad (potencia de 2, mayor o igual que HASHMAP_MIN_CAPACITY).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Error de reserva de memoria (el almacenamiento anterior se conserva).
+*/
+static uint8_t _hashmap_rehash(hashmap_pt map, size_t new_capacity){
+    // Reserva del nuevo control (vacío) y de las nuevas ranuras:
+    uint8_t * new_ctrl = (uint8_t *)malloc(new_capacity + HASHMAP_GROUP_WIDTH);
+    if (new_ctrl == NULL){
+        return 1;
+    }
+
+    void * new_slots = malloc(new_capacity * map->slot_size);
+    if (new_slots == NULL){
+        free(new_ctrl);
+        return 1;
+    }
+
+    memset(new_ctrl, HASHMAP_CTRL_EMPTY, new_capacity + HASHMAP_GROUP_WIDTH);
+
+    // Reubicación de los elementos (sin comprobar duplicados, las claves ya son únicas):
+    uint8_t * old_slot;
+    uint8_t * new_slot;
+    uint64_t hash;
+    size_t index;
+    for (size_t i = 0; i < map->capacity; i++){
+        if ((map->ctrl[i] & 0x80) == 0){
+            old_slot = (uint8_t *)map->slots + (i * map->slot_size);
+            hash = map->hash_fn(old_slot, map->key_size);
+            index = _hashmap_find_free_index(new_ctrl, new_capacity, hash);
+
+            new_ctrl[index] = (uint8_t)(hash & 0x7F);
+            if (index < HASHMAP_GROUP_WIDTH){
+                new_ctrl[new_capacity + index] = new_ctrl[index];
+            }
+
+            new_slot = (uint8_t *)new_slots + (index * map->slot_size);
+            memcpy(new_slot, old_slot, map->slot_size);
+        }
+    }
+
+    // Sustitución del almacenamiento:
+    free(map->ctrl);
+    free(map->slots);
+    map->ctrl = new_ctrl;
+    map->slots = new_slots;
+    map->capacity = new_capacity;
+    map->growth_left = _hashmap_max_items(new_capacity, map->max_load) - map->size;
+
+    return 0;
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
@@ -0,0 +1,76 @@
+#ifndef HASHMAP_HEADER
+#define HASHMAP_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "../array/array.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define HASHMAP_GROUP_WIDTH 16          // Nº de bytes de control comparados a la vez (SSE2).
+#define HASHMAP_MIN_CAPACITY 16         // En número de ranuras (potencia de 2, mínimo un grupo).
+#define HASHMAP_DEFAULT_MAX_LOAD 87     // Porcentaje de ocupación máxima por defecto.
+#define HASHMAP_MIN_LOAD 25             // Porcentaje mínimo admitido como ocupación máxima.
+#define HASHMAP_MAX_LOAD 93             // Porcentaje máximo admitido como ocupación máxima.
+
+#define HASHMAP_CTRL_EMPTY 0x80         // Byte de control de ranura vacía.
+#define HASHMAP_CTRL_DELETED 0xFE       // Byte de control de ranura borrada (tombstone).
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos---------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct hashmap{
+    uint8_t * ctrl;         // Bytes de control (capacity + HASHMAP_GROUP_WIDTH, el primer grupo se replica al final).
+    void * slots;           // Ranuras planas (clave | valor) de slot_size bytes.
+    size_t key_size;        // Tamaño (bytes) de la clave.
+    size_t value_size;      // Tamaño (bytes) del valor.
+    size_t value_offset;    // Desplazamiento (bytes) del valor dentro de la ranura (alineado al tamaño del valor).
+    size_t slot_size;       // Tamaño (bytes) de una ranura (clave + relleno + valor + relleno).
+    size_t capacity;        // Capacidad total (número de ranuras, potencia de 2).
+    size_t size;            // Número de elementos almacenados.
+    size_t growth_left;     // Inserciones en ranuras vacías restantes antes de redimensionar.
+    uint8_t max_load;       // Porcentaje de ocupación máxima (incluidas las ranuras borradas).
+    uint64_t (*hash_fn)(const void *, size_t);  // Función hash (clave, tamaño de la clave).
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct hashmap hashmap_t;
+typedef hashmap_t * hashmap_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción del mapa:
+hashmap_pt hashmap_init(size_t key_size, size_t value_size, uint8_t max_load, uint64_t (*hash_fn)(const void *, size_t));
+void hashmap_deinit(hashmap_pt * map);
+void hashmap_clear(hashmap_pt map);
+uint8_t hashmap_reserve(hashmap_pt map, size_t count);
+
+// Inserción, búsqueda y eliminación:
+uint8_t hashmap_insert(hashmap_pt map, const void * key, const void * value);
+void * hashmap_find(const hashmap_pt map, const void * key);
+uint8_t hashmap_erase(hashmap_pt map, const void * key);
+
+// Iteración:
+uint8_t hashmap_next(const hashmap_pt map, size_t * iter, void ** out_key, void ** out_value);
+
+// Utilidades generales:
+uint64_t hashmap_hash_default(const void * key, size_t key_size);
+size_t hashmap_size(const hashmap_pt map);
+size_t hashmap_capacity(const hashmap_pt map);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
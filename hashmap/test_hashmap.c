@@ -0,0 +1,77 @@
+#include "hashmap.h"
+#include <stdio.h>
+
+struct test_key{
+    uint16_t group;
+    uint8_t code[6];
+};
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de un mapa de uint32_t a uint64_t con carga y hash por defecto:
+    hashmap_pt map = hashmap_init(sizeof(uint32_t), sizeof(uint64_t), 0, NULL);
+    printf("\nSe ha creado el mapa correctamente en la dirección (%p)\n", (void *)map);
+
+    // Inserción de pares (la capacidad crece al superar la carga máxima):
+    for (uint32_t key = 0; key < 100; key++){
+        uint64_t value = (uint64_t)key * key;
+        hashmap_insert(map, &key, &value);
+    }
+    printf("Elementos: %ld, capacidad: %ld\n", hashmap_size(map), hashmap_capacity(map));
+
+    // Actualización de un valor existente y búsquedas:
+    uint32_t key = 7;
+    uint64_t value = 7777;
+    hashmap_insert(map, &key, &value);
+
+    for (key = 6; key <= 8; key++){
+        uint64_t * found = (uint64_t *)hashmap_find(map, &key);
+        printf("Clave %u -> %lu\n", key, (found != NULL) ? *found : 0);
+    }
+    key = 1000;
+    printf("Clave %u encontrada: %d\n", key, hashmap_find(map, &key) != NULL);
+
+    // Eliminación de las claves pares:
+    for (key = 0; key < 100; key += 2){
+        hashmap_erase(map, &key);
+    }
+    printf("\nElementos tras eliminar las claves pares: %ld (eliminar de nuevo la 0: %u)\n", hashmap_size(map), hashmap_erase(map, &(uint32_t){0}));
+
+    // Iteración sobre los elementos (orden de ranura) sumando los valores:
+    size_t iter = 0;
+    void * out_key;
+    void * out_value;
+    uint64_t sum = 0;
+    size_t count = 0;
+    while (hashmap_next(map, &iter, &out_key, &out_value) == 0){
+        sum += *(uint64_t *)out_value;
+        count++;
+    }
+    printf("Iterados %ld elementos, suma de valores: %lu\n", count, sum);
+
+    // Reserva de capacidad y limpieza:
+    hashmap_reserve(map, 10000);
+    printf("\nCapacidad tras reservar 10000 elementos: %ld\n", hashmap_capacity(map));
+    printf("Reserva de SIZE_MAX elementos (retorna %d), capacidad: %ld\n", hashmap_reserve(map, SIZE_MAX), hashmap_capacity(map));
+    hashmap_clear(map);
+    printf("Elementos tras limpiar: %ld, capacidad: %ld\n", hashmap_size(map), hashmap_capacity(map));
+
+    // Destrucción del mapa:
+    hashmap_deinit(&map);
+
+    // Mapa con claves compuestas (hash por bloques) y carga máxima del 50%:
+    map = hashmap_init(sizeof(struct test_key), sizeof(uint16_t), 50, NULL);
+    struct test_key composite = {.group = 3, .code = {'A', 'B', 'C', 'D', 'E', 'F'}};
+    uint16_t weight = 42;
+    hashmap_insert(map, &composite, &weight);
+    composite.code[5] = 'G';
+    printf("\nClave compuesta ABCDEG encontrada: %d\n", hashmap_find(map, &composite) != NULL);
+    composite.code[5] = 'F';
+    printf("Clave compuesta ABCDEF -> %u\n", *(uint16_t *)hashmap_find(map, &composite));
+    hashmap_deinit(&map);
+
+    printf("\nDirección del mapa tras la eliminación: (%p)\n", (void *)map);
+
+    return 0;
+}
\ No newline at end of file
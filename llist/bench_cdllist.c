@@ -0,0 +1,160 @@
+#include "cdllist.h"
+#include "dllist.h"
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_PREFILL 256           // Nodos iniciales de la lista.
+#define BENCH_INDEX_RANGE 16        // Posiciones (desde la cabecera) de insert_at/remove_at.
+
+struct bench_args{
+    cdll_linkedlist_pt clist;       // Lista con cerrojos por nodo (NULL para la lista con mutex).
+    dll_linkedlist_pt list;         // Lista de referencia.
+    pthread_mutex_t * lock;         // Mutex de la lista de referencia.
+    size_t ops;                     // Operaciones del hilo.
+    bool ends_only;                 // true: solo operaciones por los extremos; false: carga mixta.
+    uint32_t seed;                  // Semilla del generador del hilo.
+};
+
+// Prototipos de funciones:
+double elapsed_ms(struct timespec start, struct timespec end);
+bool equal_int(const void * target, const void * data);
+void * bench_thread(void * arg);
+double run_workload(size_t threads, size_t ops, bool ends_only, bool fine_grained);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Operaciones totales y número máximo de hilos (por argumento o por defecto):
+    size_t ops = (argc > 1) ? strtoul(argv[1], NULL, 10) : 400000;
+    size_t max_threads = (argc > 2) ? strtoul(argv[2], NULL, 10) : 32;
+    if (max_threads == 0){
+        max_threads = 1;
+    }
+
+    for (int ends_only = 1; ends_only >= 0; ends_only--){
+        printf("\nCarga %s (%ld operaciones en total, %d nodos iniciales):\n",
+               ends_only ? "por los extremos (push/pop front/back)" : "mixta (extremos, insert_at/remove_at y find)", ops, BENCH_PREFILL);
+        printf("\t  N   dllist + mutex (Mops/s)   cdllist (Mops/s)\n");
+        for (size_t n = 1; n <= max_threads; n *= 2){
+            double ms_list = run_workload(n, ops, ends_only, false);
+            double ms_clist = run_workload(n, ops, ends_only, true);
+            printf("\t%3ld   %23.2f   %16.2f\n", n, ops / ms_list / 1e3, ops / ms_clist / 1e3);
+        }
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función que calcula el tiempo transcurrido entre dos marcas de tiempo.
+
+    @param struct timespec start: Marca de inicio.
+    @param struct timespec end: Marca de fin.
+
+    @retval double: Tiempo transcurrido en milisegundos.
+*/
+double elapsed_ms(struct timespec start, struct timespec end){
+    return (double)(end.tv_sec - start.tv_sec) * 1e3 + (double)(end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+/*
+    @brief Comparador de igualdad de enteros.
+
+    @param const void * target: Referencia al entero buscado.
+    @param const void * data: Referencia al entero del nodo.
+
+    @retval bool: true si coinciden, false en caso contrario.
+*/
+bool equal_int(const void * target, const void * data){
+    return *(const int *)target == *(const int *)data;
+}
+
+/*
+    @brief Función del hilo de carga: ejecuta operaciones al azar sobre una de las dos listas.
+    @note: Las inserciones y eliminaciones se alternan por parejas para mantener el tamaño estable.
+
+    @param void * arg: Referencia a los argumentos (struct bench_args).
+
+    @retval void *: NULL.
+*/
+void * bench_thread(void * arg){
+    struct bench_args * args = (struct bench_args *)arg;
+
+    for (size_t i = 0; i < args->ops; i++){
+        args->seed = args->seed * 1103515245u + 12345u;
+        uint32_t op = args->ends_only ? ((args->seed >> 16) % 2) : ((args->seed >> 16) % 5);
+        bool insert = (i % 2) == 0;
+        int value = (int)((args->seed >> 8) % 1024);
+        size_t index = (args->seed >> 4) % BENCH_INDEX_RANGE;
+
+        if (args->clist != NULL){
+            if (op == 0){
+                insert ? cdllist_push_front(args->clist, &value) : cdllist_pop_front(args->clist);
+            } else if (op == 1){
+                insert ? cdllist_push_back(args->clist, &value) : cdllist_pop_back(args->clist);
+            } else if (op == 2){
+                insert ? cdllist_insert_at(args->clist, &value, index) : cdllist_remove_at(args->clist, index);
+            } else {
+                cdllist_find(args->clist, &value, equal_int);
+            }
+            continue;
+        }
+
+        pthread_mutex_lock(args->lock);
+        if (op == 0){
+            insert ? dllist_push_front(args->list, &value) : dllist_pop_front(args->list);
+        } else if (op == 1){
+            insert ? dllist_push_back(args->list, &value) : dllist_pop_back(args->list);
+        } else if (op == 2){
+            insert ? dllist_insert_at(args->list, &value, index) : dllist_remove_at(args->list, index);
+        } else {
+            dllist_find(args->list, &value, equal_int);
+        }
+        pthread_mutex_unlock(args->lock);
+    }
+
+    return NULL;
+}
+
+/*
+    @brief Función que mide una carga repartida entre N hilos sobre una lista precargada.
+
+    @param size_t threads: Número de hilos.
+    @param size_t ops: Operaciones totales (se reparten entre los hilos).
+    @param bool ends_only: true para la carga por los extremos, false para la mixta.
+    @param bool fine_grained: true para cdllist, false para dllist con un mutex global.
+
+    @retval double: Tiempo en milisegundos.
+*/
+double run_workload(size_t threads, size_t ops, bool ends_only, bool fine_grained){
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    cdll_linkedlist_pt clist = fine_grained ? cdllist_init(sizeof(int)) : NULL;
+    dll_linkedlist_pt list = fine_grained ? NULL : dllist_init(sizeof(int));
+    for (int i = 0; i < BENCH_PREFILL; i++){
+        fine_grained ? cdllist_push_back(clist, &i) : dllist_push_back(list, &i);
+    }
+
+    pthread_t * tids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    struct bench_args * args = (struct bench_args *)malloc(threads * sizeof(struct bench_args));
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < threads; i++){
+        args[i] = (struct bench_args){
+            .clist = clist, .list = list, .lock = &lock, .ops = ops / threads, .ends_only = ends_only,
+            .seed = (uint32_t)(i + 1) * 2654435761u
+        };
+        pthread_create(&tids[i], NULL, bench_thread, &args[i]);
+    }
+    for (size_t i = 0; i < threads; i++){
+        pthread_join(tids[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    free(args);
+    free(tids);
+    cdllist_deinit(&clist);
+    dllist_deinit(&list);
+
+    return elapsed_ms(start, end);
+}
\ No newline at end of file
@@ -4,13 +4,22 @@
 # Variables de entorno             #
 # -------------------------------- #
 CC=gcc
-CFLAGS_TEST="-g -Wall -O2"
-CFLAGS_LIB="-Wall -O2 -fPIC -shared"
+CFLAGS_TEST="-g -Wall -O2 -pthread"
+CFLAGS_LIB="-Wall -O2 -fPIC -shared -pthread"
+CFLAGS_BENCH="-Wall -O2 -march=native -pthread"
 
-SRC_LIST=$1.c
+SRC_LIST="$1.c ../array/array.c"
+if [ "$1" == "rcudllist" ]; then
+    SRC_LIST="$SRC_LIST ../ebr/ebr.c"
+fi
 SRC_TEST=test_$1.c
+SRC_BENCH=bench_$1.c
+if [ "$1" == "cdllist" ]; then
+    SRC_BENCH="$SRC_BENCH dllist.c"
+fi
 
 TEST_PROG=test_$1.elf
+BENCH_PROG=bench_$1.elf
 LIB_PROG=$1.so
 # -------------------------------- #
 
@@ -32,6 +41,21 @@ if [ "$2" == "test" ]; then
     fi
     echo
 
+elif [ "$2" == "bench" ]; then
+    echo
+    echo "[BUILD-LIST-BENCH]: Compilando benchmark de $1..."
+    if $CC $CFLAGS_BENCH $SRC_BENCH $SRC_LIST -o $BENCH_PROG; then
+        echo "[BUILD-LIST-BENCH]: Compilación completada."
+        echo "[BUILD-LIST-BENCH]: Ejecutando benchmark..."
+        echo
+        ./$BENCH_PROG "${@:3}"
+        echo
+        echo "[BUILD-LIST-BENCH]: Ejecución de benchmark finalizada."
+    else
+        echo "[BUILD-LIST-BENCH][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
 elif [ "$2" == "lib" ]; then
     echo
     echo "[BUILD-LIST-LIB]: Compilando la librería de $1..."
@@ -46,7 +70,7 @@ elif [ "$2" == "lib" ]; then
 elif [ "$2" == "clean" ]; then
     echo
     echo "[BUILD-LIST-CLEAN]: Limpiando espacio de trabajo..."
-    rm -f ./$TEST_PROG ./lib/$LIB_PROG
+    rm -f ./$TEST_PROG ./$BENCH_PROG ./lib/$LIB_PROG
     echo "[BUILD-LIST-CLEAN]: Espacio de trabajo limpio."
     echo
 
@@ -55,10 +79,13 @@ else
     echo "[BUILD-LIST][ERR]: Uso incorrecto u opciones inválidas."
     echo -e "\n\t[Uso]:"
     echo -e "\t\t-> ./build.sh <tipo> test: \tCompila y ejecuta el programa de test (.elf)"
+    echo -e "\t\t-> ./build.sh <tipo> bench [args]: \tCompila y ejecuta el benchmark (.elf, solo cdllist)"
     echo -e "\t\t-> ./build.sh <tipo> lib: \tCompila y genera la librería compartida (.so) bajo la carpeta lib/"
     echo -e "\t\t-> ./build.sh <tipo> clean: \tLimpia el espacio de trabajo eliminando archivos generados"
     echo -e "\n\n\t<tipo>:"
     echo -e "\t\tsllist: \tEjecuta el script para el tipo de lista 'single linked lists'"
+    echo -e "\t\trcudllist: \tEjecuta el script para el tipo de lista 'double linked lists' con lectores RCU"
+    echo -e "\t\tcdllist: \tEjecuta el script para el tipo de lista 'double linked lists' con cerrojos por nodo"
     echo
     exit 1
 fi
@@ -0,0 +1,671 @@
+#include "cdllist.h"
+
+#include <sched.h>
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static cdll_node_pt _cdllist_node_init(cdll_linkedlist_pt list, const void * data);
+static void _cdllist_node_deinit(cdll_node_pt node);
+static cdll_node_pt _cdllist_lock_prev(cdll_linkedlist_pt list, size_t index);
+static void _cdllist_lock_back(cdll_linkedlist_pt list, cdll_node_pt * out_last, cdll_node_pt * out_prev);
+/* ---------------------------------------------------------------- */
+
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar una double linked list concurrente con un cerrojo por nodo.
+    @note: Los recorridos bloquean los nodos de dos en dos en orden cabecera -> cola (lock-coupling). Las operaciones por la
+           cola, que necesitan el orden inverso, usan trylock y reintentan, por lo que nunca hay interbloqueos.
+    @note: Los centinelas de cabecera y cola tienen cerrojos distintos: push_front y push_back no compiten salvo con la
+           lista casi vacía.
+
+    @param size_t data_size: Tamaño del tipo de dato básico de la lista.
+
+    @retval cdll_linkedlist_pt: Puntero a la lista creada.
+*/
+cdll_linkedlist_pt cdllist_init(size_t data_size){
+    // Comprobación de los límites del tamaño del elemento básico de la lista:
+    if ((data_size < MIN_DATA_SIZE) || (data_size > MAX_DATA_SIZE)){
+        return NULL;
+    }
+
+    // Reserva de memoria para la estructura básica de la lista (alineada a línea de caché):
+    cdll_linkedlist_pt list = (cdll_linkedlist_pt)aligned_alloc(CDLLIST_CACHE_LINE, sizeof(cdll_linkedlist_t));
+    if (list == NULL){
+        return NULL;
+    }
+
+    // Inicio de los centinelas y de los miembros de la estructura:
+    list->head.data = NULL;
+    list->head.prev = NULL;
+    list->head.next = &list->tail;
+    pthread_mutex_init(&list->head.lock, NULL);
+
+    list->tail.data = NULL;
+    list->tail.prev = &list->head;
+    list->tail.next = NULL;
+    pthread_mutex_init(&list->tail.lock, NULL);
+
+    atomic_init(&list->size, 0);
+    list->data_size = data_size;
+
+    return list;
+}
+
+/*
+    @brief Función para destruir y liberar una lista.
+    @note: Ningún hilo debe estar usando la lista.
+
+    @param cdll_linkedlist_pt * list: Referencia a la referencia de la lista.
+
+    @retval None.
+*/
+void cdllist_deinit(cdll_linkedlist_pt * list){
+    // Comprobación de que la lista no sea nula:
+    if ((list == NULL) || (*list == NULL)){
+        return;
+    }
+
+    // Liberación completa de memoria de los nodos:
+    cdll_node_pt temp_node = (*list)->head.next;
+    while (temp_node != &(*list)->tail){
+        cdll_node_pt next_node = temp_node->next;
+        _cdllist_node_deinit(temp_node);
+        temp_node = next_node;
+    }
+
+    // Se libera la estructura de la lista y se establece como lista inválida:
+    pthread_mutex_destroy(&(*list)->head.lock);
+    pthread_mutex_destroy(&(*list)->tail.lock);
+    free(*list);
+    *list = NULL;
+}
+
+/*
+    @brief Función para liberar la memoria de los nodos sin liberar la estructura principal.
+    @note: Con inserciones concurrentes, la lista queda vacía de los nodos que existían al llamar.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+
+    @retval None.
+*/
+void cdllist_clear(cdll_linkedlist_pt list){
+    // Comprobación de lista válida:
+    if (list == NULL){
+        return;
+    }
+
+    // Eliminación de nodos desde la cabecera:
+    while (cdllist_pop_front(list) == 0);
+}
+
+/*
+    @brief Función para insertar nodos nuevos a la lista en la cabecera.
+    @note: Bloquea el centinela de cabecera y el primer nodo.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+    @param const void * data: Referencia a los datos del nuevo nodo.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Lista o datos no válidos.
+                -> 2: Error en la creación del nuevo nodo.
+*/
+uint8_t cdllist_push_front(cdll_linkedlist_pt list, const void * data){
+    return cdllist_insert_at(list, data, 0);
+}
+
+/*
+    @brief Función para insertar nodos nuevos a la lista en la cola.
+    @note: Bloquea el centinela de cola y el último nodo (este con trylock, por ir en orden inverso).
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+    @param const void * data: Referencia a los datos del nuevo nodo.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Lista o datos no válidos.
+                -> 2: Error en la creación del nuevo nodo.
+*/
+uint8_t cdllist_push_back(cdll_linkedlist_pt list, const void * data){
+    // Comprobación de lista y datos válidos:
+    if ((list == NULL) || (data == NULL)){
+        return 1;
+    }
+
+    // Creación del nuevo nodo (fuera de los cerrojos):
+    cdll_node_pt temp_new_node = _cdllist_node_init(list, data);
+    if (temp_new_node == NULL){
+        return 2;
+    }
+
+    // Bloqueo del centinela de cola y del último nodo:
+    cdll_node_pt temp_last_node;
+    _cdllist_lock_back(list, &temp_last_node, NULL);
+
+    // Enlace del nuevo nodo entre el último nodo y el centinela de cola:
+    temp_new_node->prev = temp_last_node;
+    temp_new_node->next = &list->tail;
+    temp_last_node->next = temp_new_node;
+    list->tail.prev = temp_new_node;
+    atomic_fetch_add_explicit(&list->size, 1, memory_order_relaxed);
+
+    pthread_mutex_unlock(&temp_last_node->lock);
+    pthread_mutex_unlock(&list->tail.lock);
+
+    return 0;
+}
+
+/*
+    @brief Función para insertar un nodo nuevo en una posición dada.
+    @note: Recorre la lista con lock-coupling hasta el nodo anterior a la posición y bloquea también el siguiente.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+    @param const void * data: Referencia a los datos del nuevo nodo.
+    @param size_t index: Posición del nuevo nodo.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Lista o datos no válidos.
+                -> 2: Error en la creación del nuevo nodo.
+                -> 3: El índice excede el tamaño de la lista.
+*/
+uint8_t cdllist_insert_at(cdll_linkedlist_pt list, const void * data, size_t index){
+    // Comprobación de lista y datos válidos:
+    if ((list == NULL) || (data == NULL)){
+        return 1;
+    }
+
+    // Creación del nuevo nodo (fuera de los cerrojos):
+    cdll_node_pt temp_new_node = _cdllist_node_init(list, data);
+    if (temp_new_node == NULL){
+        return 2;
+    }
+
+    // Bloqueo del nodo anterior a la posición y de su siguiente:
+    cdll_node_pt temp_prev_node = _cdllist_lock_prev(list, index);
+    if (temp_prev_node == NULL){
+        _cdllist_node_deinit(temp_new_node);
+        return 3;
+    }
+    cdll_node_pt temp_next_node = temp_prev_node->next;
+    pthread_mutex_lock(&temp_next_node->lock);
+
+    // Asignación de referencias cruzadas para inserción del nodo:
+    temp_new_node->prev = temp_prev_node;
+    temp_new_node->next = temp_next_node;
+    temp_prev_node->next = temp_new_node;
+    temp_next_node->prev = temp_new_node;
+    atomic_fetch_add_explicit(&list->size, 1, memory_order_relaxed);
+
+    pthread_mutex_unlock(&temp_next_node->lock);
+    pthread_mutex_unlock(&temp_prev_node->lock);
+
+    return 0;
+}
+
+/*
+    @brief Función para eliminar el elemento en la cabecera de la lista.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: La lista no es válida.
+                -> 2: La lista está vacía.
+*/
+uint8_t cdllist_pop_front(cdll_linkedlist_pt list){
+    return cdllist_remove_at(list, 0);
+}
+
+/*
+    @brief Función para eliminar el elemento en la cola de la lista.
+    @note: Bloquea el centinela de cola, el último nodo y su anterior (estos dos con trylock, por ir en orden inverso).
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: La lista no es válida.
+                -> 2: La lista está vacía.
+*/
+uint8_t cdllist_pop_back(cdll_linkedlist_pt list){
+    // Comprobación de lista válida:
+    if (list == NULL){
+        return 1;
+    }
+
+    // Bloqueo del centinela de cola, del último nodo y de su anterior:
+    cdll_node_pt temp_last_node;
+    cdll_node_pt temp_prev_node;
+    _cdllist_lock_back(list, &temp_last_node, &temp_prev_node);
+    if (temp_last_node == &list->head){
+        pthread_mutex_unlock(&list->head.lock);
+        pthread_mutex_unlock(&list->tail.lock);
+        return 2;
+    }
+
+    // Desenlace del último nodo:
+    temp_prev_node->next = &list->tail;
+    list->tail.prev = temp_prev_node;
+    atomic_fetch_sub_explicit(&list->size, 1, memory_order_relaxed);
+
+    pthread_mutex_unlock(&temp_prev_node->lock);
+    pthread_mutex_unlock(&temp_last_node->lock);
+    pthread_mutex_unlock(&list->tail.lock);
+
+    // Destrucción del nodo (ya inalcanzable para el resto de hilos):
+    _cdllist_node_deinit(temp_last_node);
+
+    return 0;
+}
+
+/*
+    @brief Función para eliminar un nodo en una posición dada.
+    @note: Recorre la lista con lock-coupling y bloquea el anterior, el nodo y el siguiente antes de desenlazarlo.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+    @param size_t index: Posición del nodo a eliminar.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: La lista no es válida.
+                -> 2: El índice es superior al tamaño de la lista.
+*/
+uint8_t cdllist_remove_at(cdll_linkedlist_pt list, size_t index){
+    // Comprobación de lista válida:
+    if (list == NULL){
+        return 1;
+    }
+
+    // Bloqueo del nodo anterior a la posición:
+    cdll_node_pt temp_prev_node = _cdllist_lock_prev(list, index);
+    if (temp_prev_node == NULL){
+        return 2;
+    }
+
+    // Comprobación de que el nodo exista y bloqueo del nodo y de su siguiente:
+    cdll_node_pt temp_current_node = temp_prev_node->next;
+    if (temp_current_node == &list->tail){
+        pthread_mutex_unlock(&temp_prev_node->lock);
+        return 2;
+    }
+    pthread_mutex_lock(&temp_current_node->lock);
+    cdll_node_pt temp_next_node = temp_current_node->next;
+    pthread_mutex_lock(&temp_next_node->lock);
+
+    // Desenlace del nodo:
+    temp_prev_node->next = temp_next_node;
+    temp_next_node->prev = temp_prev_node;
+    atomic_fetch_sub_explicit(&list->size, 1, memory_order_relaxed);
+
+    pthread_mutex_unlock(&temp_next_node->lock);
+    pthread_mutex_unlock(&temp_current_node->lock);
+    pthread_mutex_unlock(&temp_prev_node->lock);
+
+    // Destrucción del nodo (ya inalcanzable para el resto de hilos):
+    _cdllist_node_deinit(temp_current_node);
+
+    return 0;
+}
+
+/*
+    @brief Función para eliminar, en una sola pasada, todos los nodos cuyos datos cumplen un predicado.
+    @note: Recorre la lista con lock-coupling; el predicado se evalúa con el nodo bloqueado.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+    @param bool (*pred_fn)(const void *, void *): Referencia al predicado (datos, contexto); retorna true para eliminar.
+    @param void * ctx: Referencia al contexto de usuario que se pasa al predicado (puede ser nulo).
+
+    @retval size_t: Número de nodos eliminados (0 si la lista o el predicado no son válidos).
+*/
+size_t cdllist_remove_if(cdll_linkedlist_pt list, bool (*pred_fn)(const void *, void *), void * ctx){
+    // Comprobación de lista y predicado válidos:
+    if ((list == NULL) || (pred_fn == NULL)){
+        return 0;
+    }
+
+    // Recorrido con el anterior y el actual bloqueados:
+    size_t removed = 0;
+    cdll_node_pt temp_prev_node = &list->head;
+    pthread_mutex_lock(&temp_prev_node->lock);
+    cdll_node_pt temp_current_node = temp_prev_node->next;
+    pthread_mutex_lock(&temp_current_node->lock);
+
+    while (temp_current_node != &list->tail){
+        if (pred_fn(temp_current_node->data, ctx)){
+            // Desenlace del actual (con su siguiente bloqueado), que pasa a ser el nuevo actual:
+            cdll_node_pt temp_next_node = temp_current_node->next;
+            pthread_mutex_lock(&temp_next_node->lock);
+            temp_prev_node->next = temp_next_node;
+            temp_next_node->prev = temp_prev_node;
+            atomic_fetch_sub_explicit(&list->size, 1, memory_order_relaxed);
+
+            pthread_mutex_unlock(&temp_current_node->lock);
+            _cdllist_node_deinit(temp_current_node);
+            temp_current_node = temp_next_node;
+            removed++;
+        } else {
+            // Avance de la pareja de cerrojos:
+            pthread_mutex_unlock(&temp_prev_node->lock);
+            temp_prev_node = temp_current_node;
+            temp_current_node = temp_current_node->next;
+            pthread_mutex_lock(&temp_current_node->lock);
+        }
+    }
+
+    pthread_mutex_unlock(&temp_current_node->lock);
+    pthread_mutex_unlock(&temp_prev_node->lock);
+
+    return removed;
+}
+
+/*
+    @brief Función que busca y retorna el nodo objetivo dado, con un criterio dado.
+    @note: Recorre la lista con lock-coupling. La referencia retornada es válida mientras ningún hilo elimine el nodo.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+    @param const void * target: Referencia al dato objetivo que se busca.
+    @param bool (*cmp_fn)(const void *, const void *): Referencia a la función que realiza la comparación entre objetivo y buscado.
+
+    @retval void *: Referencia a los datos del nodo encontrado.
+*/
+void * cdllist_find(cdll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void * )){
+    // Comprobación de lista, objetivo y función comparadora válidos:
+    if ((list == NULL) || (target == NULL) || (cmp_fn == NULL)){
+        return NULL;
+    }
+
+    // Recorrido de la lista hasta encontrar el nodo:
+    void * found = NULL;
+    cdll_node_pt temp_current_node = &list->head;
+    pthread_mutex_lock(&temp_current_node->lock);
+    while ((temp_current_node->next != &list->tail) && (found == NULL)){
+        cdll_node_pt temp_next_node = temp_current_node->next;
+        pthread_mutex_lock(&temp_next_node->lock);
+        pthread_mutex_unlock(&temp_current_node->lock);
+        temp_current_node = temp_next_node;
+
+        if (cmp_fn(target, temp_current_node->data)){
+            found = temp_current_node->data;
+        }
+    }
+    pthread_mutex_unlock(&temp_current_node->lock);
+
+    return found;
+}
+
+/*
+    @brief Función que aplica otra función dada a los datos de cada nodo de la lista.
+    @note: La función se aplica con el nodo bloqueado, por lo que puede modificar sus datos.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+    @param void (*fn)(void *): Referencia a la función a aplicar.
+
+    @return uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: La lista o la función no son válidas.
+*/
+uint8_t cdllist_foreach(cdll_linkedlist_pt list, void (*fn)(void *)){
+    // Comprobación de la lista y función válidos:
+    if ((list == NULL) || (fn == NULL)){
+        return 1;
+    }
+
+    // Recorrido de la lista y aplicación de la función a cada nodo:
+    cdll_node_pt temp_current_node = &list->head;
+    pthread_mutex_lock(&temp_current_node->lock);
+    while (temp_current_node->next != &list->tail){
+        cdll_node_pt temp_next_node = temp_current_node->next;
+        pthread_mutex_lock(&temp_next_node->lock);
+        pthread_mutex_unlock(&temp_current_node->lock);
+        temp_current_node = temp_next_node;
+
+        fn(temp_current_node->data);
+    }
+    pthread_mutex_unlock(&temp_current_node->lock);
+
+    return 0;
+}
+
+/*
+    @brief Función que busca y retorna el nodo objetivo dado, con un criterio dado que recibe un contexto de usuario.
+    @note: Recorre la lista con lock-coupling. La referencia retornada es válida mientras ningún hilo elimine el nodo.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+    @param const void * target: Referencia al dato objetivo que se busca.
+    @param bool (*cmp_fn)(const void *, const void *, void *): Referencia a la función comparadora (objetivo, datos, contexto).
+    @param void * ctx: Referencia al contexto de usuario que se pasa a la función comparadora (puede ser nulo).
+
+    @retval void *: Referencia a los datos del nodo encontrado (nulo si no se encuentra).
+*/
+void * cdllist_find_ctx(cdll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *, void *), void * ctx){
+    // Comprobación de lista, objetivo y función comparadora válidos:
+    if ((list == NULL) || (target == NULL) || (cmp_fn == NULL)){
+        return NULL;
+    }
+
+    // Recorrido de la lista hasta encontrar:
+    void * found = NULL;
+    cdll_node_pt temp_current_node = &list->head;
+    pthread_mutex_lock(&temp_current_node->lock);
+    while ((temp_current_node->next != &list->tail) && (found == NULL)){
+        cdll_node_pt temp_next_node = temp_current_node->next;
+        pthread_mutex_lock(&temp_next_node->lock);
+        pthread_mutex_unlock(&temp_current_node->lock);
+        temp_current_node = temp_next_node;
+
+        if (cmp_fn(target, temp_current_node->data, ctx)){
+            found = temp_current_node->data;
+        }
+    }
+    pthread_mutex_unlock(&temp_current_node->lock);
+
+    return found;
+}
+
+/*
+    @brief Función que aplica otra función dada, con un contexto de usuario, a los datos de cada nodo de la lista.
+    @note: El recorrido se detiene en cuanto la función aplicada retorna true. La función se aplica con el nodo bloqueado.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+    @param bool (*fn)(void *, void *): Referencia a la función a aplicar (datos, contexto); retorna true para detener el recorrido.
+    @param void * ctx: Referencia al contexto de usuario que se pasa a la función (puede ser nulo).
+
+    @return uint8_t:
+                -> 0: No han ocurrido errores (se ha recorrido la lista completa).
+                -> 1: La lista o la función no son válidas.
+                -> 2: El recorrido se ha detenido antes del final.
+*/
+uint8_t cdllist_foreach_ctx(cdll_linkedlist_pt list, bool (*fn)(void *, void *), void * ctx){
+    // Comprobación de lista y función válidos:
+    if ((list == NULL) || (fn == NULL)){
+        return 1;
+    }
+
+    // Recorrido de la lista y aplicación de la función a cada nodo (hasta que solicite detenerse):
+    uint8_t status = 0;
+    cdll_node_pt temp_current_node = &list->head;
+    pthread_mutex_lock(&temp_current_node->lock);
+    while ((temp_current_node->next != &list->tail) && (status == 0)){
+        cdll_node_pt temp_next_node = temp_current_node->next;
+        pthread_mutex_lock(&temp_next_node->lock);
+        pthread_mutex_unlock(&temp_current_node->lock);
+        temp_current_node = temp_next_node;
+
+        if (fn(temp_current_node->data, ctx)){
+            status = 2;
+        }
+    }
+    pthread_mutex_unlock(&temp_current_node->lock);
+
+    return status;
+}
+
+/*
+    @brief Función que retorna si la lista está o no vacía.
+    @note: Lectura sin cerrojos del contador de nodos.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+
+    @retval bool:
+                -> true: La lista está vacía (o no es válida).
+                -> false: La lista no está vacía.
+*/
+bool cdllist_is_empty(cdll_linkedlist_pt list){
+    // Comprobación de lista válida:
+    if (list == NULL){
+        return true;
+    }
+
+    return atomic_load_explicit(&list->size, memory_order_relaxed) == 0;
+}
+
+/*
+    @brief Función que retorna el tamaño de la lista.
+    @note: Lectura sin cerrojos; con escritores concurrentes el valor es una instantánea.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+
+    @retval size_t: Tamaño de la lista.
+*/
+size_t cdllist_get_size(cdll_linkedlist_pt list){
+    // Comprobación de lista válida:
+    if (list == NULL){
+        return 0;
+    }
+
+    return atomic_load_explicit(&list->size, memory_order_relaxed);
+}
+
+/*
+    @brief Función que retorna el tamaño en bytes de los datos en un nodo.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+
+    @retval size_t: Tamaño en bytes de los datos de un nodo de la lista.
+*/
+size_t cdllist_get_data_size(cdll_linkedlist_pt list){
+    // Comprobación de lista válida:
+    if (list == NULL){
+        return 0;
+    }
+
+    return list->data_size;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna para crear un nodo con sus datos en la misma reserva.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+    @param const void * data: Referencia a los datos del nodo.
+
+    @retval cdll_node_pt: Referencia al nodo creado (nulo si no hay memoria).
+*/
+static cdll_node_pt _cdllist_node_init(cdll_linkedlist_pt list, const void * data){
+    // Reserva de memoria para el nodo y sus datos:
+    cdll_node_pt node = (cdll_node_pt)malloc(sizeof(cdll_node_t) + list->data_size);
+    if (node == NULL){
+        return NULL;
+    }
+
+    // Copia de los datos al nodo e inicio de miembros de nodo:
+    node->data = node + 1;
+    memcpy(node->data, data, list->data_size);
+    node->next = NULL;
+    node->prev = NULL;
+    pthread_mutex_init(&node->lock, NULL);
+
+    return node;
+}
+
+/*
+    @brief Función interna para eliminar un nodo.
+    @note: El nodo debe estar desenlazado y desbloqueado; ningún otro hilo puede alcanzarlo.
+
+    @param cdll_node_pt node: Referencia al nodo a eliminar.
+
+    @retval None.
+*/
+static void _cdllist_node_deinit(cdll_node_pt node){
+    pthread_mutex_destroy(&node->lock);
+    free(node);
+}
+
+/*
+    @brief Función interna que recorre la lista con lock-coupling y retorna bloqueado el nodo anterior a una posición.
+    @note: Para la posición 0 retorna el centinela de cabecera. Mientras se tiene bloqueado un nodo, su siguiente no puede
+           eliminarse (eliminarlo exige bloquear su anterior), así que el avance es seguro.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+    @param size_t index: Posición.
+
+    @retval cdll_node_pt: Nodo anterior bloqueado (nulo, sin cerrojos tomados, si la posición excede el tamaño de la lista).
+*/
+static cdll_node_pt _cdllist_lock_prev(cdll_linkedlist_pt list, size_t index){
+    cdll_node_pt temp_current_node = &list->head;
+    pthread_mutex_lock(&temp_current_node->lock);
+
+    for (size_t i = 0; i < index; i++){
+        cdll_node_pt temp_next_node = temp_current_node->next;
+        if (temp_next_node == &list->tail){
+            pthread_mutex_unlock(&temp_current_node->lock);
+            return NULL;
+        }
+        pthread_mutex_lock(&temp_next_node->lock);
+        pthread_mutex_unlock(&temp_current_node->lock);
+        temp_current_node = temp_next_node;
+    }
+
+    return temp_current_node;
+}
+
+/*
+    @brief Función interna que bloquea el centinela de cola, el último nodo y, opcionalmente, el anterior a este.
+    @note: Al ir en orden inverso al de los recorridos, los cerrojos de los nodos se toman con trylock; si alguno está ocupado
+           se sueltan todos y se reintenta tras ceder la CPU. El último nodo no puede eliminarse mientras se tiene el
+           centinela de cola, ni su anterior mientras se tiene el último.
+    @note: Si la lista está vacía, el último nodo es el centinela de cabecera (queda bloqueado) y no se bloquea su anterior.
+
+    @param cdll_linkedlist_pt list: Referencia a la lista.
+    @param cdll_node_pt * out_last: Referencia donde se guarda el último nodo (bloqueado).
+    @param cdll_node_pt * out_prev: Referencia donde se guarda el anterior al último (bloqueado), o nula si no se necesita.
+
+    @retval None.
+*/
+static void _cdllist_lock_back(cdll_linkedlist_pt list, cdll_node_pt * out_last, cdll_node_pt * out_prev){
+    for (;;){
+        pthread_mutex_lock(&list->tail.lock);
+        cdll_node_pt temp_last_node = list->tail.prev;
+
+        if (pthread_mutex_trylock(&temp_last_node->lock) == 0){
+            if ((out_prev == NULL) || (temp_last_node == &list->head)){
+                *out_last = temp_last_node;
+                return;
+            }
+
+            cdll_node_pt temp_prev_node = temp_last_node->prev;
+            if (pthread_mutex_trylock(&temp_prev_node->lock) == 0){
+                *out_last = temp_last_node;
+                *out_prev = temp_prev_node;
+                return;
+            }
+            pthread_mutex_unlock(&temp_last_node->lock);
+        }
+
+        pthread_mutex_unlock(&list->tail.lock);
+        sched_yield();
+    }
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef CDLLIST_HEADER
+#define CDLLIST_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define MIN_DATA_SIZE 1      // En bytes.
+#define MAX_DATA_SIZE 128    // En bytes.
+#define CDLLIST_CACHE_LINE 64   // Tamaño (bytes) de la línea de caché (separa los centinelas de cabecera y cola).
+/* ---------------------------------------------------------------- */
+
+/* --- Estructuras de datos---------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct cdll_node{
+    void * data;                    // Datos del nodo (en la misma reserva; nulo en los centinelas).
+    struct cdll_node * next;
+    struct cdll_node * prev;
+    pthread_mutex_t lock;           // Cerrojo del nodo (protege next, prev y datos).
+};
+
+struct cdll_linkedlist{
+    _Alignas(CDLLIST_CACHE_LINE) struct cdll_node head;    // Centinela de cabecera (su cerrojo es el de push_front).
+    _Alignas(CDLLIST_CACHE_LINE) struct cdll_node tail;    // Centinela de cola (su cerrojo es el de push_back).
+    _Alignas(CDLLIST_CACHE_LINE) atomic_size_t size;       // Número de nodos (lectura sin cerrojos).
+    size_t data_size;
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct cdll_node cdll_node_t;
+typedef cdll_node_t * cdll_node_pt;
+
+typedef struct cdll_linkedlist cdll_linkedlist_t;
+typedef cdll_linkedlist_t * cdll_linkedlist_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción de la lista:
+cdll_linkedlist_pt cdllist_init(size_t data_size);
+void cdllist_deinit(cdll_linkedlist_pt * list);
+void cdllist_clear(cdll_linkedlist_pt list);
+
+// Inserción de elementos:
+uint8_t cdllist_push_front(cdll_linkedlist_pt list, const void * data);
+uint8_t cdllist_push_back(cdll_linkedlist_pt list, const void * data);
+uint8_t cdllist_insert_at(cdll_linkedlist_pt list, const void * data, size_t index);
+
+// Eliminación de elementos:
+uint8_t cdllist_pop_front(cdll_linkedlist_pt list);
+uint8_t cdllist_pop_back(cdll_linkedlist_pt list);
+uint8_t cdllist_remove_at(cdll_linkedlist_pt list, size_t index);
+size_t cdllist_remove_if(cdll_linkedlist_pt list, bool (*pred_fn)(const void *, void *), void * ctx);
+
+// Búsqueda e iteración:
+void * cdllist_find(cdll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void * ));
+uint8_t cdllist_foreach(cdll_linkedlist_pt list, void (*fn)(void *));
+void * cdllist_find_ctx(cdll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *, void *), void * ctx);
+uint8_t cdllist_foreach_ctx(cdll_linkedlist_pt list, bool (*fn)(void *, void *), void * ctx);
+
+// Utilidades generales:
+bool cdllist_is_empty(cdll_linkedlist_pt list);
+size_t cdllist_get_size(cdll_linkedlist_pt list);
+size_t cdllist_get_data_size(cdll_linkedlist_pt list);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
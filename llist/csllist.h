@@ -7,6 +7,8 @@
 #include <stdint.h>
 #include <string.h>
 #include <stdbool.h>
+
+#include "../array/array.h"
 /* ---------------------------------------------------------------- */
 
 
@@ -14,6 +16,7 @@
 /* ---------------------------------------------------------------- */
 #define MIN_DATA_SIZE 1      // En bytes.
 #define MAX_DATA_SIZE 128    // En bytes.
+#define FIND_MANY_LINEAR_MAX 8  // Nº de objetivos hasta el que find_many compara linealmente (por encima, ordena los objetivos).
 /* ---------------------------------------------------------------- */
 
 
@@ -29,6 +32,8 @@ struct csll_linkedlist{
     struct csll_node * tail;     // Referencia al último nodo.
     size_t data_size;           // Tamaño (en bytes) de los datos de cada nodo.
     size_t size;                // Tamaño (en nº de nodos) de la lista.
+    struct csll_node * cursor;   // Nodo del siguiente turno de round-robin (nulo: la cabecera).
+    size_t credit;              // Turnos que le quedan al nodo del cursor en round-robin ponderado.
 };
 /* ---------------------------------------------------------------- */
 
@@ -58,10 +63,30 @@ uint8_t csllist_insert_at(csll_linkedlist_pt list, const void * data, size_t ind
 // Eliminación de elementos:
 uint8_t csllist_pop_front(csll_linkedlist_pt list);
 uint8_t csllist_remove_at(csll_linkedlist_pt list, size_t index);
+size_t csllist_remove_if(csll_linkedlist_pt list, bool (*pred_fn)(const void *, void *), void * ctx);
 
 // Búsqueda e iteración:
 void * csllist_find(csll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *));
 uint8_t csllist_foreach(csll_linkedlist_pt list, void (*fn)(void *));
+void * csllist_find_ctx(csll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *, void *), void * ctx);
+size_t csllist_find_all(csll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *, void *), void * ctx, array_pt out);
+uint8_t csllist_find_index(csll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *, void *), void * ctx, size_t * out_index);
+uint8_t csllist_foreach_ctx(csll_linkedlist_pt list, bool (*fn)(void *, void *), void * ctx);
+size_t csllist_find_many(csll_linkedlist_pt list, const void * targets, size_t k, int (*cmp_fn)(const void *, const void *), void ** out);
+
+// Ordenación y mezcla:
+uint8_t csllist_sort(csll_linkedlist_pt list, int (*cmp_fn)(const void *, const void *));
+uint8_t csllist_merge_sorted(csll_linkedlist_pt dst, csll_linkedlist_pt src, int (*cmp_fn)(const void *, const void *));
+
+// Rotación y round-robin:
+uint8_t csllist_rotate(csll_linkedlist_pt list, size_t k);
+void * csllist_rr_next(csll_linkedlist_pt list);
+void * csllist_rr_next_weighted(csll_linkedlist_pt list, size_t (*weight_fn)(const void *, void *), void * ctx);
+void csllist_rr_reset(csll_linkedlist_pt list);
+
+// Traspaso de nodos entre listas:
+uint8_t csllist_concat(csll_linkedlist_pt dst, csll_linkedlist_pt src);
+csll_linkedlist_pt csllist_split_at(csll_linkedlist_pt list, size_t index);
 
 // Utilidades generales:
 bool csllist_is_empty(csll_linkedlist_pt list);
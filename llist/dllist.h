@@ -8,6 +8,8 @@
 #include <stdint.h>
 #include <string.h>
 #include <stdbool.h>
+
+#include "../array/array.h"
 /* ---------------------------------------------------------------- */
 
 
@@ -15,6 +17,7 @@
 /* ---------------------------------------------------------------- */
 #define MIN_DATA_SIZE 1      // En bytes.
 #define MAX_DATA_SIZE 128    // En bytes.
+#define FIND_MANY_LINEAR_MAX 8  // Nº de objetivos hasta el que find_many compara linealmente (por encima, ordena los objetivos).
 /* ---------------------------------------------------------------- */
 
 /* --- Estructuras de datos---------------------------------------- */
@@ -60,10 +63,26 @@ uint8_t dllist_insert_at(dll_linkedlist_pt list, const void * data, size_t index
 uint8_t dllist_pop_front(dll_linkedlist_pt list);
 uint8_t dllist_pop_back(dll_linkedlist_pt list);
 uint8_t dllist_remove_at(dll_linkedlist_pt list, size_t index);
+size_t dllist_remove_if(dll_linkedlist_pt list, bool (*pred_fn)(const void *, void *), void * ctx);
 
 // Búsqueda e iteración:
 void * dllist_find(dll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void * ));
 uint8_t dllist_foreach(dll_linkedlist_pt list, void (*fn)(void *));
+void * dllist_find_ctx(dll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *, void *), void * ctx);
+size_t dllist_find_all(dll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *, void *), void * ctx, array_pt out);
+uint8_t dllist_find_index(dll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *, void *), void * ctx, size_t * out_index);
+uint8_t dllist_foreach_ctx(dll_linkedlist_pt list, bool (*fn)(void *, void *), void * ctx);
+size_t dllist_find_many(dll_linkedlist_pt list, const void * targets, size_t k, int (*cmp_fn)(const void *, const void *), void ** out);
+dll_node_pt dllist_node_at(dll_linkedlist_pt list, size_t index);
+
+// Ordenación y mezcla:
+uint8_t dllist_sort(dll_linkedlist_pt list, int (*cmp_fn)(const void *, const void *));
+uint8_t dllist_merge_sorted(dll_linkedlist_pt dst, dll_linkedlist_pt src, int (*cmp_fn)(const void *, const void *));
+
+// Traspaso de nodos entre listas:
+uint8_t dllist_concat(dll_linkedlist_pt dst, dll_linkedlist_pt src);
+uint8_t dllist_splice(dll_linkedlist_pt dst, dll_node_pt pos, dll_linkedlist_pt src, dll_node_pt first, dll_node_pt last);
+dll_linkedlist_pt dllist_split_at(dll_linkedlist_pt list, size_t index);
 
 // Utilidades generales:
 bool dllist_is_empty(dll_linkedlist_pt list);
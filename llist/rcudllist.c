@@ -0,0 +1,646 @@
+#include "rcudllist.h"
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static rcu_dll_node_pt _rcudllist_node_init(rcu_dll_linkedlist_pt list, const void * data);
+static void _rcudllist_node_deinit(void * node);
+static void _rcudllist_unlink(rcu_dll_linkedlist_pt list, ebr_record_pt record, rcu_dll_node_pt node);
+static void _rcudllist_retire(rcu_dll_linkedlist_pt list, ebr_record_pt record, rcu_dll_node_pt node);
+static void _rcudllist_free_chain(rcu_dll_node_pt node);
+/* ---------------------------------------------------------------- */
+
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar una double linked list con lectores sin bloqueos (estilo RCU).
+    @note: Los lectores recorren la lista hacia delante sin cerrojos ni operaciones atómicas de lectura-modificación-escritura;
+           los escritores se serializan con un mutex, publican los enlaces next con stores release y retiran los nodos
+           eliminados en un dominio EBR propio, que los libera tras un periodo de gracia.
+
+    @param size_t data_size: Tamaño del tipo de dato básico de la lista.
+
+    @retval rcu_dll_linkedlist_pt: Puntero a la lista creada.
+*/
+rcu_dll_linkedlist_pt rcudllist_init(size_t data_size){
+    // Comprobación de los límites del tamaño del elemento básico de la lista:
+    if ((data_size < MIN_DATA_SIZE) || (data_size > MAX_DATA_SIZE)){
+        return NULL;
+    }
+
+    // Reserva de memoria para la estructura básica de la lista:
+    rcu_dll_linkedlist_pt list = (rcu_dll_linkedlist_pt)malloc(sizeof(rcu_dll_linkedlist_t));
+    if (list == NULL){
+        return NULL;
+    }
+
+    // Creación del dominio de reclamación de nodos:
+    list->ebr = ebr_init();
+    if (list->ebr == NULL){
+        free(list);
+        return NULL;
+    }
+
+    // Inicio de los miembros de la estructura:
+    atomic_init(&list->head, NULL);
+    list->tail = NULL;
+    list->orphans = NULL;
+    pthread_mutex_init(&list->write_lock, NULL);
+    list->data_size = data_size;
+    atomic_init(&list->size, 0);
+
+    return list;
+}
+
+/*
+    @brief Función para destruir y liberar una lista, sus nodos (también los retirados) y su dominio EBR.
+    @note: Ningún hilo debe estar usando la lista; los registros de hilos dejan de ser válidos.
+
+    @param rcu_dll_linkedlist_pt * list: Referencia a la referencia de la lista.
+
+    @retval None.
+*/
+void rcudllist_deinit(rcu_dll_linkedlist_pt * list){
+    // Comprobación de que la lista no sea nula:
+    if ((list == NULL) || (*list == NULL)){
+        return;
+    }
+
+    // Liberación de los nodos enlazados y de los retirados:
+    _rcudllist_free_chain(atomic_load_explicit(&(*list)->head, memory_order_relaxed));
+    ebr_deinit(&(*list)->ebr);
+    while ((*list)->orphans != NULL){
+        rcu_dll_node_pt temp_orphan_node = (*list)->orphans;
+        (*list)->orphans = temp_orphan_node->prev;
+        free(temp_orphan_node);
+    }
+
+    // Se libera la estructura de la lista y se establece como lista inválida:
+    pthread_mutex_destroy(&(*list)->write_lock);
+    free(*list);
+    *list = NULL;
+}
+
+/*
+    @brief Función para eliminar todos los nodos sin liberar la estructura principal.
+    @note: Los nodos se liberan tras el periodo de gracia; los lectores que estén recorriendo la lista terminan su recorrido.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+    @param ebr_record_pt record: Registro del hilo escritor.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Lista o registro no válidos.
+*/
+uint8_t rcudllist_clear(rcu_dll_linkedlist_pt list, ebr_record_pt record){
+    // Comprobación de lista y registro válidos:
+    if ((list == NULL) || (record == NULL)){
+        return 1;
+    }
+
+    ebr_enter(list->ebr, record);
+    pthread_mutex_lock(&list->write_lock);
+
+    // Desenlace de la cadena completa y retirada de sus nodos:
+    rcu_dll_node_pt temp_node = atomic_load_explicit(&list->head, memory_order_relaxed);
+    atomic_store_explicit(&list->head, NULL, memory_order_release);
+    list->tail = NULL;
+    atomic_store_explicit(&list->size, 0, memory_order_relaxed);
+
+    while (temp_node != NULL){
+        rcu_dll_node_pt temp_next_node = atomic_load_explicit(&temp_node->next, memory_order_relaxed);
+        _rcudllist_retire(list, record, temp_node);
+        temp_node = temp_next_node;
+    }
+
+    pthread_mutex_unlock(&list->write_lock);
+    ebr_exit(list->ebr, record);
+
+    return 0;
+}
+
+/*
+    @brief Función para registrar el hilo actual en la lista (necesario para leer y para escribir).
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+
+    @retval ebr_record_pt: Registro del hilo (NULL si la lista no es válida o no hay memoria).
+*/
+ebr_record_pt rcudllist_register(rcu_dll_linkedlist_pt list){
+    // Comprobación de lista válida:
+    if (list == NULL){
+        return NULL;
+    }
+
+    return ebr_register(list->ebr);
+}
+
+/*
+    @brief Función para dar de baja el registro de un hilo en la lista.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+    @param ebr_record_pt * record: Referencia al registro (se anula).
+
+    @retval None.
+*/
+void rcudllist_unregister(rcu_dll_linkedlist_pt list, ebr_record_pt * record){
+    // Comprobación de lista válida:
+    if (list == NULL){
+        return;
+    }
+
+    ebr_unregister(list->ebr, record);
+}
+
+/*
+    @brief Función para insertar nodos nuevos a la lista en la cabecera.
+    @note: El nodo se publica completo: los lectores lo ven entero o no lo ven.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+    @param ebr_record_pt record: Registro del hilo escritor.
+    @param const void * data: Referencia a los datos del nuevo nodo.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Lista, registro o datos no válidos.
+                -> 2: Error en la creación del nuevo nodo.
+*/
+uint8_t rcudllist_push_front(rcu_dll_linkedlist_pt list, ebr_record_pt record, const void * data){
+    // Comprobación de lista, registro y datos válidos:
+    if ((list == NULL) || (record == NULL) || (data == NULL)){
+        return 1;
+    }
+
+    // Creación del nuevo nodo (fuera de la sección de escritura):
+    rcu_dll_node_pt temp_new_node = _rcudllist_node_init(list, data);
+    if (temp_new_node == NULL){
+        return 2;
+    }
+
+    pthread_mutex_lock(&list->write_lock);
+
+    // Enlace del nodo antes de su publicación como cabecera:
+    rcu_dll_node_pt temp_old_head = atomic_load_explicit(&list->head, memory_order_relaxed);
+    atomic_store_explicit(&temp_new_node->next, temp_old_head, memory_order_relaxed);
+    if (temp_old_head == NULL){
+        list->tail = temp_new_node;
+    } else {
+        temp_old_head->prev = temp_new_node;
+    }
+    atomic_store_explicit(&list->head, temp_new_node, memory_order_release);
+    atomic_fetch_add_explicit(&list->size, 1, memory_order_relaxed);
+
+    pthread_mutex_unlock(&list->write_lock);
+
+    return 0;
+}
+
+/*
+    @brief Función para insertar nodos nuevos a la lista en la cola.
+    @note: El nodo se publica completo: los lectores lo ven entero o no lo ven.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+    @param ebr_record_pt record: Registro del hilo escritor.
+    @param const void * data: Referencia a los datos del nuevo nodo.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Lista, registro o datos no válidos.
+                -> 2: Error en la creación del nuevo nodo.
+*/
+uint8_t rcudllist_push_back(rcu_dll_linkedlist_pt list, ebr_record_pt record, const void * data){
+    // Comprobación de lista, registro y datos válidos:
+    if ((list == NULL) || (record == NULL) || (data == NULL)){
+        return 1;
+    }
+
+    // Creación del nuevo nodo (fuera de la sección de escritura):
+    rcu_dll_node_pt temp_new_node = _rcudllist_node_init(list, data);
+    if (temp_new_node == NULL){
+        return 2;
+    }
+
+    pthread_mutex_lock(&list->write_lock);
+
+    // Publicación del nodo a continuación de la cola actual:
+    rcu_dll_node_pt temp_old_tail = list->tail;
+    temp_new_node->prev = temp_old_tail;
+    if (temp_old_tail == NULL){
+        atomic_store_explicit(&list->head, temp_new_node, memory_order_release);
+    } else {
+        atomic_store_explicit(&temp_old_tail->next, temp_new_node, memory_order_release);
+    }
+    list->tail = temp_new_node;
+    atomic_fetch_add_explicit(&list->size, 1, memory_order_relaxed);
+
+    pthread_mutex_unlock(&list->write_lock);
+
+    return 0;
+}
+
+/*
+    @brief Función para eliminar el elemento en la cabecera de la lista.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+    @param ebr_record_pt record: Registro del hilo escritor.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Lista o registro no válidos.
+                -> 2: La lista está vacía.
+*/
+uint8_t rcudllist_pop_front(rcu_dll_linkedlist_pt list, ebr_record_pt record){
+    // Comprobación de lista y registro válidos:
+    if ((list == NULL) || (record == NULL)){
+        return 1;
+    }
+
+    ebr_enter(list->ebr, record);
+    pthread_mutex_lock(&list->write_lock);
+
+    rcu_dll_node_pt temp_old_head = atomic_load_explicit(&list->head, memory_order_relaxed);
+    if (temp_old_head != NULL){
+        _rcudllist_unlink(list, record, temp_old_head);
+    }
+
+    pthread_mutex_unlock(&list->write_lock);
+    ebr_exit(list->ebr, record);
+
+    return (temp_old_head == NULL) ? 2 : 0;
+}
+
+/*
+    @brief Función para eliminar el elemento en la cola de la lista.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+    @param ebr_record_pt record: Registro del hilo escritor.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Lista o registro no válidos.
+                -> 2: La lista está vacía.
+*/
+uint8_t rcudllist_pop_back(rcu_dll_linkedlist_pt list, ebr_record_pt record){
+    // Comprobación de lista y registro válidos:
+    if ((list == NULL) || (record == NULL)){
+        return 1;
+    }
+
+    ebr_enter(list->ebr, record);
+    pthread_mutex_lock(&list->write_lock);
+
+    rcu_dll_node_pt temp_old_tail = list->tail;
+    if (temp_old_tail != NULL){
+        _rcudllist_unlink(list, record, temp_old_tail);
+    }
+
+    pthread_mutex_unlock(&list->write_lock);
+    ebr_exit(list->ebr, record);
+
+    return (temp_old_tail == NULL) ? 2 : 0;
+}
+
+/*
+    @brief Función para eliminar, en una sola pasada, todos los nodos cuyos datos cumplen un predicado.
+    @note: Los nodos eliminados conservan su enlace next hasta liberarse, por lo que los lectores que estén sobre ellos continúan.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+    @param ebr_record_pt record: Registro del hilo escritor.
+    @param bool (*pred_fn)(const void *, void *): Referencia al predicado (datos, contexto); retorna true para eliminar.
+    @param void * ctx: Referencia al contexto de usuario que se pasa al predicado (puede ser nulo).
+
+    @retval size_t: Número de nodos eliminados (0 si la lista, el registro o el predicado no son válidos).
+*/
+size_t rcudllist_remove_if(rcu_dll_linkedlist_pt list, ebr_record_pt record, bool (*pred_fn)(const void *, void *), void * ctx){
+    // Comprobación de lista, registro y predicado válidos:
+    if ((list == NULL) || (record == NULL) || (pred_fn == NULL)){
+        return 0;
+    }
+
+    ebr_enter(list->ebr, record);
+    pthread_mutex_lock(&list->write_lock);
+
+    // Recorrido con desenlace de los nodos que cumplen el predicado:
+    size_t removed = 0;
+    rcu_dll_node_pt temp_current_node = atomic_load_explicit(&list->head, memory_order_relaxed);
+    while (temp_current_node != NULL){
+        rcu_dll_node_pt temp_next_node = atomic_load_explicit(&temp_current_node->next, memory_order_relaxed);
+        if (pred_fn(temp_current_node->data, ctx)){
+            _rcudllist_unlink(list, record, temp_current_node);
+            removed++;
+        }
+        temp_current_node = temp_next_node;
+    }
+
+    pthread_mutex_unlock(&list->write_lock);
+    ebr_exit(list->ebr, record);
+
+    return removed;
+}
+
+/*
+    @brief Función para sustituir los datos del primer nodo que iguala al objetivo (copia-actualización).
+    @note: Los datos publicados no se modifican nunca: se enlaza un nodo nuevo en lugar del antiguo, que se retira. Cada lector
+           ve los datos antiguos o los nuevos, nunca una mezcla.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+    @param ebr_record_pt record: Registro del hilo escritor.
+    @param const void * target: Referencia al dato objetivo que se busca.
+    @param bool (*cmp_fn)(const void *, const void *, void *): Referencia a la función comparadora (objetivo, datos, contexto).
+    @param void * ctx: Referencia al contexto de usuario que se pasa a la función comparadora (puede ser nulo).
+    @param const void * data: Referencia a los datos nuevos.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Lista, registro, objetivo, comparador o datos no válidos.
+                -> 2: Error en la creación del nuevo nodo.
+                -> 3: No hay ningún nodo que iguale al objetivo.
+*/
+uint8_t rcudllist_replace(rcu_dll_linkedlist_pt list, ebr_record_pt record, const void * target,
+                          bool (*cmp_fn)(const void *, const void *, void *), void * ctx, const void * data){
+    // Comprobación de lista, registro, objetivo, comparador y datos válidos:
+    if ((list == NULL) || (record == NULL) || (target == NULL) || (cmp_fn == NULL) || (data == NULL)){
+        return 1;
+    }
+
+    // Creación del nodo sustituto (fuera de la sección de escritura):
+    rcu_dll_node_pt temp_new_node = _rcudllist_node_init(list, data);
+    if (temp_new_node == NULL){
+        return 2;
+    }
+
+    ebr_enter(list->ebr, record);
+    pthread_mutex_lock(&list->write_lock);
+
+    // Búsqueda del nodo a sustituir:
+    rcu_dll_node_pt temp_old_node = atomic_load_explicit(&list->head, memory_order_relaxed);
+    while ((temp_old_node != NULL) && !cmp_fn(target, temp_old_node->data, ctx)){
+        temp_old_node = atomic_load_explicit(&temp_old_node->next, memory_order_relaxed);
+    }
+
+    // Enlace del sustituto y publicación en el lugar del nodo antiguo:
+    if (temp_old_node != NULL){
+        rcu_dll_node_pt temp_next_node = atomic_load_explicit(&temp_old_node->next, memory_order_relaxed);
+        atomic_store_explicit(&temp_new_node->next, temp_next_node, memory_order_relaxed);
+        temp_new_node->prev = temp_old_node->prev;
+
+        if (temp_old_node->prev == NULL){
+            atomic_store_explicit(&list->head, temp_new_node, memory_order_release);
+        } else {
+            atomic_store_explicit(&temp_old_node->prev->next, temp_new_node, memory_order_release);
+        }
+
+        if (temp_next_node == NULL){
+            list->tail = temp_new_node;
+        } else {
+            temp_next_node->prev = temp_new_node;
+        }
+
+        _rcudllist_retire(list, record, temp_old_node);
+    }
+
+    pthread_mutex_unlock(&list->write_lock);
+    ebr_exit(list->ebr, record);
+
+    // Sin coincidencias, el sustituto no llegó a publicarse:
+    if (temp_old_node == NULL){
+        _rcudllist_node_deinit(temp_new_node);
+        return 3;
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función que busca el primer nodo que iguala al objetivo y copia sus datos (lectores, sin bloqueos).
+    @note: Se copian los datos porque la referencia al nodo solo es válida dentro de la sección crítica.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+    @param ebr_record_pt record: Registro del hilo lector.
+    @param const void * target: Referencia al dato objetivo que se busca.
+    @param bool (*cmp_fn)(const void *, const void *, void *): Referencia a la función comparadora (objetivo, datos, contexto).
+    @param void * ctx: Referencia al contexto de usuario que se pasa a la función comparadora (puede ser nulo).
+    @param void * out_data: Referencia donde se copian los datos encontrados (puede ser nula si solo interesa la existencia).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores (nodo encontrado).
+                -> 1: Lista, registro, objetivo o comparador no válidos.
+                -> 2: No hay ningún nodo que iguale al objetivo.
+*/
+uint8_t rcudllist_find(rcu_dll_linkedlist_pt list, ebr_record_pt record, const void * target,
+                       bool (*cmp_fn)(const void *, const void *, void *), void * ctx, void * out_data){
+    // Comprobación de lista, registro, objetivo y comparador válidos:
+    if ((list == NULL) || (record == NULL) || (target == NULL) || (cmp_fn == NULL)){
+        return 1;
+    }
+
+    ebr_enter(list->ebr, record);
+
+    // Recorrido de la lista hasta encontrar:
+    rcu_dll_node_pt temp_current_node = atomic_load_explicit(&list->head, memory_order_acquire);
+    while ((temp_current_node != NULL) && !cmp_fn(target, temp_current_node->data, ctx)){
+        temp_current_node = atomic_load_explicit(&temp_current_node->next, memory_order_acquire);
+    }
+
+    if ((temp_current_node != NULL) && (out_data != NULL)){
+        memcpy(out_data, temp_current_node->data, list->data_size);
+    }
+
+    ebr_exit(list->ebr, record);
+
+    return (temp_current_node == NULL) ? 2 : 0;
+}
+
+/*
+    @brief Función que aplica otra función dada, con un contexto de usuario, a los datos de cada nodo (lectores, sin bloqueos).
+    @note: El recorrido se detiene en cuanto la función aplicada retorna true. Los datos no deben modificarse ni guardarse
+           referencias a ellos más allá de la llamada.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+    @param ebr_record_pt record: Registro del hilo lector.
+    @param bool (*fn)(const void *, void *): Referencia a la función a aplicar (datos, contexto); retorna true para detener el recorrido.
+    @param void * ctx: Referencia al contexto de usuario que se pasa a la función (puede ser nulo).
+
+    @return uint8_t:
+                -> 0: No han ocurrido errores (se ha recorrido la lista completa).
+                -> 1: La lista, el registro o la función no son válidos.
+                -> 2: El recorrido se ha detenido antes del final.
+*/
+uint8_t rcudllist_foreach(rcu_dll_linkedlist_pt list, ebr_record_pt record, bool (*fn)(const void *, void *), void * ctx){
+    // Comprobación de lista, registro y función válidos:
+    if ((list == NULL) || (record == NULL) || (fn == NULL)){
+        return 1;
+    }
+
+    ebr_enter(list->ebr, record);
+
+    // Recorrido de la lista y aplicación de la función a cada nodo (hasta que solicite detenerse):
+    uint8_t status = 0;
+    rcu_dll_node_pt temp_current_node = atomic_load_explicit(&list->head, memory_order_acquire);
+    while (temp_current_node != NULL){
+        if (fn(temp_current_node->data, ctx)){
+            status = 2;
+            break;
+        }
+        temp_current_node = atomic_load_explicit(&temp_current_node->next, memory_order_acquire);
+    }
+
+    ebr_exit(list->ebr, record);
+
+    return status;
+}
+
+/*
+    @brief Función que indica si la lista está vacía.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+
+    @retval bool: true si está vacía (o no es válida), false en otro caso.
+*/
+bool rcudllist_is_empty(rcu_dll_linkedlist_pt list){
+    return (list == NULL) || (atomic_load_explicit(&list->head, memory_order_acquire) == NULL);
+}
+
+/*
+    @brief Función que retorna el número de nodos de la lista.
+    @note: Con escritores concurrentes el valor es aproximado.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+
+    @retval size_t: Número de nodos (0 si la lista no es válida).
+*/
+size_t rcudllist_get_size(rcu_dll_linkedlist_pt list){
+    // Comprobación de lista válida:
+    if (list == NULL){
+        return 0;
+    }
+
+    return atomic_load_explicit(&list->size, memory_order_relaxed);
+}
+
+/*
+    @brief Función que retorna el tamaño del tipo de dato básico de la lista.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+
+    @retval size_t: Tamaño (bytes) de los datos de cada nodo (0 si la lista no es válida).
+*/
+size_t rcudllist_get_data_size(rcu_dll_linkedlist_pt list){
+    // Comprobación de lista válida:
+    if (list == NULL){
+        return 0;
+    }
+
+    return list->data_size;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna para crear un nodo con sus datos en la misma reserva.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+    @param const void * data: Referencia a los datos del nodo.
+
+    @retval rcu_dll_node_pt: Referencia al nodo creado (nulo si no hay memoria).
+*/
+static rcu_dll_node_pt _rcudllist_node_init(rcu_dll_linkedlist_pt list, const void * data){
+    // Reserva de memoria para el nodo y sus datos:
+    rcu_dll_node_pt node = (rcu_dll_node_pt)malloc(sizeof(rcu_dll_node_t) + list->data_size);
+    if (node == NULL){
+        return NULL;
+    }
+
+    // Copia de los datos al nodo e inicio de miembros de nodo:
+    node->data = node + 1;
+    memcpy(node->data, data, list->data_size);
+    atomic_init(&node->next, NULL);
+    node->prev = NULL;
+
+    return node;
+}
+
+/*
+    @brief Función interna para eliminar un nodo (con la firma que espera ebr_retire).
+
+    @param void * node: Referencia al nodo a eliminar.
+
+    @retval None.
+*/
+static void _rcudllist_node_deinit(void * node){
+    // Liberación completa de memoria del nodo (datos incluidos):
+    free(node);
+}
+
+/*
+    @brief Función interna que desenlaza un nodo de la lista y lo retira.
+    @note: Se llama con el mutex de escritura tomado. El enlace next del nodo no se toca para que los lectores sobre él continúen.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+    @param ebr_record_pt record: Registro del hilo escritor.
+    @param rcu_dll_node_pt node: Referencia al nodo.
+
+    @retval None.
+*/
+static void _rcudllist_unlink(rcu_dll_linkedlist_pt list, ebr_record_pt record, rcu_dll_node_pt node){
+    rcu_dll_node_pt temp_next_node = atomic_load_explicit(&node->next, memory_order_relaxed);
+
+    // Enlace del anterior (o de la cabecera) con el siguiente:
+    if (node->prev == NULL){
+        atomic_store_explicit(&list->head, temp_next_node, memory_order_release);
+    } else {
+        atomic_store_explicit(&node->prev->next, temp_next_node, memory_order_release);
+    }
+
+    // Enlace del siguiente (o de la cola) con el anterior:
+    if (temp_next_node == NULL){
+        list->tail = node->prev;
+    } else {
+        temp_next_node->prev = node->prev;
+    }
+
+    atomic_fetch_sub_explicit(&list->size, 1, memory_order_relaxed);
+    _rcudllist_retire(list, record, node);
+}
+
+/*
+    @brief Función interna que retira un nodo desenlazado para liberarlo tras el periodo de gracia.
+    @note: Se llama con el mutex de escritura tomado. Si no hay memoria para la lista de espera del dominio, el nodo pasa a la
+           cadena de huérfanos (enlazada por prev) y se libera al destruir la lista.
+
+    @param rcu_dll_linkedlist_pt list: Referencia a la lista.
+    @param ebr_record_pt record: Registro del hilo escritor.
+    @param rcu_dll_node_pt node: Referencia al nodo.
+
+    @retval None.
+*/
+static void _rcudllist_retire(rcu_dll_linkedlist_pt list, ebr_record_pt record, rcu_dll_node_pt node){
+    if (ebr_retire(list->ebr, record, node, _rcudllist_node_deinit) != 0){
+        node->prev = list->orphans;
+        list->orphans = node;
+    }
+}
+
+/*
+    @brief Función interna que libera una cadena de nodos enlazados por su siguiente.
+
+    @param rcu_dll_node_pt node: Referencia al primer nodo.
+
+    @retval None.
+*/
+static void _rcudllist_free_chain(rcu_dll_node_pt node){
+    while (node != NULL){
+        rcu_dll_node_pt temp_next_node = atomic_load_explicit(&node->next, memory_order_relaxed);
+        free(node);
+        node = temp_next_node;
+    }
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
@@ -0,0 +1,87 @@
+#ifndef RCUDLLIST_HEADER
+#define RCUDLLIST_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "../ebr/ebr.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define MIN_DATA_SIZE 1      // En bytes.
+#define MAX_DATA_SIZE 128    // En bytes.
+/* ---------------------------------------------------------------- */
+
+/* --- Estructuras de datos---------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct rcu_dll_node{
+    void * data;                            // Datos del nodo (en la misma reserva, inmutables tras publicarse).
+    _Atomic(struct rcu_dll_node *) next;    // Siguiente nodo (publicado con release, leído con acquire).
+    struct rcu_dll_node * prev;             // Nodo anterior (solo lo usan los escritores).
+};
+
+struct rcu_dll_linkedlist{
+    _Atomic(struct rcu_dll_node *) head;    // Primer nodo (publicado con release, leído con acquire).
+    struct rcu_dll_node * tail;             // Último nodo (solo lo usan los escritores).
+    struct rcu_dll_node * orphans;          // Nodos retirados sin memoria en el dominio (se liberan en deinit).
+    pthread_mutex_t write_lock;             // Exclusión mutua entre escritores.
+    ebr_pt ebr;                             // Dominio de reclamación de los nodos eliminados.
+    size_t data_size;
+    atomic_size_t size;
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct rcu_dll_node rcu_dll_node_t;
+typedef rcu_dll_node_t * rcu_dll_node_pt;
+
+typedef struct rcu_dll_linkedlist rcu_dll_linkedlist_t;
+typedef rcu_dll_linkedlist_t * rcu_dll_linkedlist_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción de la lista:
+rcu_dll_linkedlist_pt rcudllist_init(size_t data_size);
+void rcudllist_deinit(rcu_dll_linkedlist_pt * list);
+uint8_t rcudllist_clear(rcu_dll_linkedlist_pt list, ebr_record_pt record);
+
+// Registro de hilos (lectores y escritores):
+ebr_record_pt rcudllist_register(rcu_dll_linkedlist_pt list);
+void rcudllist_unregister(rcu_dll_linkedlist_pt list, ebr_record_pt * record);
+
+// Inserción de elementos (escritores):
+uint8_t rcudllist_push_front(rcu_dll_linkedlist_pt list, ebr_record_pt record, const void * data);
+uint8_t rcudllist_push_back(rcu_dll_linkedlist_pt list, ebr_record_pt record, const void * data);
+
+// Eliminación y sustitución de elementos (escritores):
+uint8_t rcudllist_pop_front(rcu_dll_linkedlist_pt list, ebr_record_pt record);
+uint8_t rcudllist_pop_back(rcu_dll_linkedlist_pt list, ebr_record_pt record);
+size_t rcudllist_remove_if(rcu_dll_linkedlist_pt list, ebr_record_pt record, bool (*pred_fn)(const void *, void *), void * ctx);
+uint8_t rcudllist_replace(rcu_dll_linkedlist_pt list, ebr_record_pt record, const void * target,
+                          bool (*cmp_fn)(const void *, const void *, void *), void * ctx, const void * data);
+
+// Búsqueda e iteración (lectores, sin bloqueos):
+uint8_t rcudllist_find(rcu_dll_linkedlist_pt list, ebr_record_pt record, const void * target,
+                       bool (*cmp_fn)(const void *, const void *, void *), void * ctx, void * out_data);
+uint8_t rcudllist_foreach(rcu_dll_linkedlist_pt list, ebr_record_pt record, bool (*fn)(const void *, void *), void * ctx);
+
+// Utilidades generales:
+bool rcudllist_is_empty(rcu_dll_linkedlist_pt list);
+size_t rcudllist_get_size(rcu_dll_linkedlist_pt list);
+size_t rcudllist_get_data_size(rcu_dll_linkedlist_pt list);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
@@ -5,6 +5,10 @@
 /* ---------------------------------------------------------------- */
 static sll_node_pt _sllist_node_init(sll_linkedlist_pt list, const void * data);
 static void _sllist_node_deinit(sll_node_pt node);
+static sll_node_pt _sllist_split(sll_node_pt node, size_t count);
+static sll_node_pt _sllist_merge(sll_node_pt left, sll_node_pt right, int (*cmp_fn)(const void *, const void *), sll_node_pt * out_tail);
+static void _sllist_sort_indices(size_t * order, size_t k, const uint8_t * targets, size_t data_size, int (*cmp_fn)(const void *, const void *));
+static size_t _sllist_resolve_targets(void * data, const uint8_t * targets, size_t k, size_t data_size, int (*cmp_fn)(const void *, const void *), const size_t * order, void ** out);
 /* ---------------------------------------------------------------- */
 
 
@@ -312,6 +316,50 @@ uint8_t sllist_remove_at(sll_linkedlist_pt list, size_t index){
     return 0;
 }
 
+/*
+    @brief Función para eliminar, en una sola pasada, todos los nodos cuyos datos cumplen un predicado.
+    @note: Se conserva el orden relativo del resto de nodos. Coste O(n) frente a O(n²) de eliminar por índice.
+
+    @param sll_linkedlist_pt list: Referencia a la lista.
+    @param bool (*pred_fn)(const void *, void *): Referencia al predicado (datos, contexto); true indica eliminar.
+    @param void * ctx: Referencia al contexto de usuario que se pasa al predicado (puede ser nulo).
+
+    @retval size_t: Número de nodos eliminados.
+*/
+size_t sllist_remove_if(sll_linkedlist_pt list, bool (*pred_fn)(const void *, void *), void * ctx){
+    // Comprobación de lista y predicado válidos:
+    if ((list == NULL) || (pred_fn == NULL)){
+        return 0;
+    }
+
+    // Recorrido de la lista desenlazando y destruyendo los nodos que cumplen el predicado:
+    size_t removed = 0;
+    sll_node_pt temp_prev_node = NULL;
+    sll_node_pt temp_current_node = list->head;
+    sll_node_pt temp_next_node;
+    while (temp_current_node != NULL){
+        temp_next_node = temp_current_node->next;
+        if (pred_fn(temp_current_node->data, ctx)){
+            if (temp_prev_node == NULL){
+                list->head = temp_next_node;
+            } else {
+                temp_prev_node->next = temp_next_node;
+            }
+            _sllist_node_deinit(temp_current_node);
+            removed++;
+        } else {
+            temp_prev_node = temp_current_node;
+        }
+        temp_current_node = temp_next_node;
+    }
+
+    // Actualización de la cola y del tamaño de la lista:
+    list->tail = temp_prev_node;
+    list->size -= removed;
+
+    return removed;
+}
+
 /*
     @brief Función que busca y retorna el nodo objetivo dado, con un criterio dado.
 
@@ -366,6 +414,374 @@ uint8_t sllist_foreach(sll_linkedlist_pt list, void (*fn)(void *)){
     return 0;
 }
 
+/*
+    @brief Función que busca y retorna el nodo objetivo dado, con un criterio dado que recibe un contexto de usuario.
+
+    @param sll_linkedlist_pt list: Referencia a la lista.
+    @param const void * target: Referencia al dato objetivo que se busca.
+    @param bool (*cmp_fn)(const void *, const void *, void *): Referencia a la función comparadora (objetivo, datos, contexto).
+    @param void * ctx: Referencia al contexto de usuario que se pasa a la función comparadora (puede ser nulo).
+
+    @retval void *: Referencia a los datos del nodo encontrado (nulo si no se encuentra).
+*/
+void * sllist_find_ctx(sll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *, void *), void * ctx){
+    // Comprobación de lista, objetivo y función comparadora válidos:
+    if ((list == NULL) || (target == NULL) || (cmp_fn == NULL)){
+        return NULL;
+    }
+
+    // Recorrido de la lista hasta encontrar:
+    sll_node_pt temp_current_node = list->head;
+    while (temp_current_node != NULL){
+        if (cmp_fn(target, temp_current_node->data, ctx)){
+            return temp_current_node->data;
+        }
+        temp_current_node = temp_current_node->next;
+    }
+
+    return NULL;
+}
+
+/*
+    @brief Función que busca todos los nodos que cumplen el criterio dado y añade al array de salida las referencias a sus datos.
+    @note: El array de salida debe tener tamaño de elemento sizeof(void *); las referencias se añaden a continuación de su contenido.
+
+    @param sll_linkedlist_pt list: Referencia a la lista.
+    @param const void * target: Referencia al dato objetivo que se busca.
+    @param bool (*cmp_fn)(const void *, const void *, void *): Referencia a la función comparadora (objetivo, datos, contexto).
+    @param void * ctx: Referencia al contexto de usuario que se pasa a la función comparadora (puede ser nulo).
+    @param array_pt out: Referencia al array donde se añaden las referencias (void *) a los datos encontrados.
+
+    @retval size_t: Número de referencias añadidas al array.
+*/
+size_t sllist_find_all(sll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *, void *), void * ctx, array_pt out){
+    // Comprobación de lista, objetivo, función comparadora y array de salida válidos:
+    if ((list == NULL) || (target == NULL) || (cmp_fn == NULL) || (out == NULL) || (out->element_size != sizeof(void *))){
+        return 0;
+    }
+
+    // Recorrido completo de la lista añadiendo cada coincidencia al array:
+    size_t found = 0;
+    sll_node_pt temp_current_node = list->head;
+    while (temp_current_node != NULL){
+        if (cmp_fn(target, temp_current_node->data, ctx)){
+            if (array_set(out, &temp_current_node->data, out->size) != 0){
+                return found;
+            }
+            found++;
+        }
+        temp_current_node = temp_current_node->next;
+    }
+
+    return found;
+}
+
+/*
+    @brief Función que busca el primer nodo que cumple el criterio dado y retorna su posición en la lista.
+
+    @param sll_linkedlist_pt list: Referencia a la lista.
+    @param const void * target: Referencia al dato objetivo que se busca.
+    @param bool (*cmp_fn)(const void *, const void *, void *): Referencia a la función comparadora (objetivo, datos, contexto).
+    @param void * ctx: Referencia al contexto de usuario que se pasa a la función comparadora (puede ser nulo).
+    @param size_t * out_index: Referencia a la variable externa donde se copiará la posición encontrada.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: La lista, el objetivo, la función o la variable externa no son válidos.
+                -> 2: No se ha encontrado ningún nodo.
+*/
+uint8_t sllist_find_index(sll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *, void *), void * ctx, size_t * out_index){
+    // Comprobación de lista, objetivo, función comparadora y variable externa válidos:
+    if ((list == NULL) || (target == NULL) || (cmp_fn == NULL) || (out_index == NULL)){
+        return 1;
+    }
+
+    // Recorrido de la lista hasta encontrar, contando las posiciones:
+    size_t index = 0;
+    sll_node_pt temp_current_node = list->head;
+    while (temp_current_node != NULL){
+        if (cmp_fn(target, temp_current_node->data, ctx)){
+            *out_index = index;
+            return 0;
+        }
+        index++;
+        temp_current_node = temp_current_node->next;
+    }
+
+    return 2;
+}
+
+/*
+    @brief Función que aplica otra función dada, con un contexto de usuario, a los datos de cada nodo de la lista.
+    @note: El recorrido se detiene en cuanto la función aplicada retorna true.
+
+    @param sll_linkedlist_pt list: Referencia a la lista.
+    @param bool (*fn)(void *, void *): Referencia a la función a aplicar (datos, contexto); retorna true para detener el recorrido.
+    @param void * ctx: Referencia al contexto de usuario que se pasa a la función (puede ser nulo).
+
+    @return uint8_t:
+                -> 0: No han ocurrido errores (se ha recorrido la lista completa).
+                -> 1: La lista o la función no son válidas.
+                -> 2: El recorrido se ha detenido antes del final.
+*/
+uint8_t sllist_foreach_ctx(sll_linkedlist_pt list, bool (*fn)(void *, void *), void * ctx){
+    // Comprobación de lista y función válidos:
+    if ((list == NULL) || (fn == NULL)){
+        return 1;
+    }
+
+    // Recorrido de la lista y aplicación de la función a cada nodo (hasta que solicite detenerse):
+    sll_node_pt temp_current_node = list->head;
+    while (temp_current_node != NULL){
+        if (fn(temp_current_node->data, ctx)){
+            return 2;
+        }
+        temp_current_node = temp_current_node->next;
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función que resuelve k objetivos con un único recorrido de la lista, deteniéndose al encontrarlos todos.
+    @note: Hasta FIND_MANY_LINEAR_MAX objetivos se comparan linealmente en cada nodo; por encima se ordenan (heapsort de índices) y se busca cada nodo por bisección.
+    @note: Cada objetivo se resuelve con el primer nodo de la lista que lo iguala. Si falla la reserva para ordenar, se usa la comparación lineal.
+
+    @param sll_linkedlist_pt list: Referencia a la lista.
+    @param const void * targets: Referencia a los k objetivos, contiguos y de tamaño data_size cada uno.
+    @param size_t k: Número de objetivos.
+    @param int (*cmp_fn)(const void *, const void *): Referencia a la función comparadora (<0, 0, >0 al estilo de qsort; 0 indica coincidencia).
+    @param void ** out: Referencia al array de k referencias de salida (datos del nodo encontrado, o nulo si no se encuentra).
+
+    @retval size_t: Número de objetivos encontrados.
+*/
+size_t sllist_find_many(sll_linkedlist_pt list, const void * targets, size_t k, int (*cmp_fn)(const void *, const void *), void ** out){
+    // Comprobación de lista, objetivos, función comparadora y salida válidos:
+    if ((list == NULL) || (targets == NULL) || (cmp_fn == NULL) || (out == NULL) || (k == 0)){
+        return 0;
+    }
+
+    // Inicio de las referencias de salida (nulo = objetivo no encontrado):
+    for (size_t i = 0; i < k; i++){
+        out[i] = NULL;
+    }
+
+    // Ordenación de los índices de los objetivos (solo para un número de objetivos elevado):
+    const uint8_t * target_bytes = (const uint8_t *)targets;
+    size_t * order = NULL;
+    if (k > FIND_MANY_LINEAR_MAX){
+        order = (size_t *)malloc(k * sizeof(size_t));
+        if (order != NULL){
+            for (size_t i = 0; i < k; i++){
+                order[i] = i;
+            }
+            _sllist_sort_indices(order, k, target_bytes, list->data_size, cmp_fn);
+        }
+    }
+
+    // Recorrido único de la lista hasta resolver todos los objetivos:
+    size_t found = 0;
+    sll_node_pt temp_current_node = list->head;
+    while ((temp_current_node != NULL) && (found < k)){
+        found += _sllist_resolve_targets(temp_current_node->data, target_bytes, k, list->data_size, cmp_fn, order, out);
+        temp_current_node = temp_current_node->next;
+    }
+
+    free(order);
+
+    return found;
+}
+
+/*
+    @brief Función que ordena la lista mediante merge sort iterativo (bottom-up) estable.
+    @note: Solo se reenlazan los nodos existentes, no se reserva ni libera memoria. Coste O(n log n) y memoria extra O(1).
+
+    @param sll_linkedlist_pt list: Referencia a la lista.
+    @param int (*cmp_fn)(const void *, const void *): Referencia a la función comparadora (<0, 0, >0 al estilo de qsort).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: La lista o la función no son válidas.
+*/
+uint8_t sllist_sort(sll_linkedlist_pt list, int (*cmp_fn)(const void *, const void *)){
+    // Comprobación de lista y función válidos:
+    if ((list == NULL) || (cmp_fn == NULL)){
+        return 1;
+    }
+
+    // Caso trivial (lista vacía o de un único nodo):
+    if (list->size < 2){
+        return 0;
+    }
+
+    // Mezcla de tramos de anchura creciente (1, 2, 4, ...) hasta cubrir la lista completa:
+    sll_node_t temp_dummy_node = {.data = NULL, .next = list->head};
+    sll_node_pt temp_tail_node = &temp_dummy_node;
+    sll_node_pt temp_left_node, temp_right_node, temp_rest_node, temp_merged_tail;
+    for (size_t width = 1; width < list->size; width *= 2){
+        temp_rest_node = temp_dummy_node.next;
+        temp_tail_node = &temp_dummy_node;
+        while (temp_rest_node != NULL){
+            temp_left_node = temp_rest_node;
+            temp_right_node = _sllist_split(temp_left_node, width);
+            temp_rest_node = _sllist_split(temp_right_node, width);
+            temp_tail_node->next = _sllist_merge(temp_left_node, temp_right_node, cmp_fn, &temp_merged_tail);
+            temp_tail_node = temp_merged_tail;
+        }
+    }
+
+    // Actualización de cabecera y cola:
+    list->head = temp_dummy_node.next;
+    list->tail = temp_tail_node;
+
+    return 0;
+}
+
+/*
+    @brief Función que mezcla una lista ordenada (src) dentro de otra lista ordenada (dst), reenlazando sus nodos.
+    @note: La lista src queda vacía (pero válida). A igualdad, los elementos de dst preceden a los de src.
+
+    @param sll_linkedlist_pt dst: Referencia a la lista destino (ordenada).
+    @param sll_linkedlist_pt src: Referencia a la lista origen (ordenada).
+    @param int (*cmp_fn)(const void *, const void *): Referencia a la función comparadora (<0, 0, >0 al estilo de qsort).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Las listas o la función no son válidas.
+                -> 2: El tamaño de datos de las listas no coincide.
+*/
+uint8_t sllist_merge_sorted(sll_linkedlist_pt dst, sll_linkedlist_pt src, int (*cmp_fn)(const void *, const void *)){
+    // Comprobación de listas y función válidos:
+    if ((dst == NULL) || (src == NULL) || (cmp_fn == NULL) || (dst == src)){
+        return 1;
+    }
+
+    if (dst->data_size != src->data_size){
+        return 2;
+    }
+
+    // Caso de lista origen vacía:
+    if (src->head == NULL){
+        return 0;
+    }
+
+    // Mezcla de los nodos (o traspaso directo si el destino está vacío):
+    if (dst->head == NULL){
+        dst->head = src->head;
+        dst->tail = src->tail;
+    } else {
+        dst->head = _sllist_merge(dst->head, src->head, cmp_fn, &dst->tail);
+    }
+
+    // Actualización de tamaños y vaciado de la lista origen:
+    dst->size += src->size;
+    src->size = 0;
+    src->head = NULL;
+    src->tail = NULL;
+
+    return 0;
+}
+
+/*
+    @brief Función que traslada todos los nodos de la lista src al final de la lista dst en O(1).
+    @note: No se reserva ni libera memoria. La lista src queda vacía (pero válida).
+
+    @param sll_linkedlist_pt dst: Referencia a la lista destino.
+    @param sll_linkedlist_pt src: Referencia a la lista origen.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Las listas no son válidas.
+                -> 2: El tamaño de datos de las listas no coincide.
+*/
+uint8_t sllist_concat(sll_linkedlist_pt dst, sll_linkedlist_pt src){
+    // Comprobación de listas válidas:
+    if ((dst == NULL) || (src == NULL) || (dst == src)){
+        return 1;
+    }
+
+    if (dst->data_size != src->data_size){
+        return 2;
+    }
+
+    // Caso de lista origen vacía:
+    if (src->head == NULL){
+        return 0;
+    }
+
+    // Enlace de la cadena origen tras la cola del destino:
+    if (dst->head == NULL){
+        dst->head = src->head;
+        dst->tail = src->tail;
+    } else {
+        dst->tail->next = src->head;
+        dst->tail = src->tail;
+    }
+
+    // Actualización de tamaños y vaciado de la lista origen:
+    dst->size += src->size;
+    src->size = 0;
+    src->head = NULL;
+    src->tail = NULL;
+
+    return 0;
+}
+
+/*
+    @brief Función que separa la lista en la posición dada, retornando los nodos desde index hasta el final como una lista nueva.
+    @note: Los nodos se trasladan sin copiarse; solo se reserva memoria para la estructura de la nueva lista.
+
+    @param sll_linkedlist_pt list: Referencia a la lista.
+    @param size_t index: Posición del primer nodo que pasa a la nueva lista (index == size genera una lista vacía).
+
+    @retval sll_linkedlist_pt: Referencia a la nueva lista (nulo si la lista o el índice no son válidos, o falla la reserva).
+*/
+sll_linkedlist_pt sllist_split_at(sll_linkedlist_pt list, size_t index){
+    // Comprobación de lista e índice válidos:
+    if ((list == NULL) || (index > list->size)){
+        return NULL;
+    }
+
+    // Creación de la lista que recibirá la parte final:
+    sll_linkedlist_pt new_list = sllist_init(list->data_size);
+    if (new_list == NULL){
+        return NULL;
+    }
+
+    // Caso de parte final vacía:
+    if (index == list->size){
+        return new_list;
+    }
+
+    // Caso de traspaso de la lista completa:
+    if (index == 0){
+        new_list->head = list->head;
+        new_list->tail = list->tail;
+        new_list->size = list->size;
+        list->head = NULL;
+        list->tail = NULL;
+        list->size = 0;
+        return new_list;
+    }
+
+    // Búsqueda del último nodo que permanece en la lista:
+    sll_node_pt temp_prev_node = list->head;
+    for (size_t i = 0; i < index-1; i++){
+        temp_prev_node = temp_prev_node->next;
+    }
+
+    // Corte de la cadena y actualización de ambas listas:
+    new_list->head = temp_prev_node->next;
+    new_list->tail = list->tail;
+    new_list->size = list->size - index;
+
+    temp_prev_node->next = NULL;
+    list->tail = temp_prev_node;
+    list->size = index;
+
+    return new_list;
+}
+
 /*
     @brief Función que retorna si la lista está o no vacía.
 
@@ -474,4 +890,163 @@ static void _sllist_node_deinit(sll_node_pt node){
     free(node->data);
     free(node);
 }
+
+/*
+    @brief Función interna que corta una cadena de nodos tras un número dado de nodos.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param sll_node_pt node: Referencia al primer nodo de la cadena (puede ser nulo).
+    @param size_t count: Número de nodos que conserva la primera cadena.
+
+    @retval sll_node_pt: Referencia al primer nodo de la cadena restante (nulo si no quedan nodos).
+*/
+static sll_node_pt _sllist_split(sll_node_pt node, size_t count){
+    // Avance hasta el último nodo del primer tramo:
+    for (size_t i = 1; (node != NULL) && (i < count); i++){
+        node = node->next;
+    }
+
+    if (node == NULL){
+        return NULL;
+    }
+
+    // Corte de la cadena:
+    sll_node_pt temp_rest_node = node->next;
+    node->next = NULL;
+
+    return temp_rest_node;
+}
+
+/*
+    @brief Función interna que mezcla de forma estable dos cadenas de nodos ordenadas y terminadas en nulo.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+    @note: Se supone que al menos una de las dos cadenas no está vacía.
+
+    @param sll_node_pt left: Referencia a la primera cadena (preferente a igualdad).
+    @param sll_node_pt right: Referencia a la segunda cadena.
+    @param int (*cmp_fn)(const void *, const void *): Referencia a la función comparadora.
+    @param sll_node_pt * out_tail: Referencia donde se guarda el último nodo de la cadena mezclada.
+
+    @retval sll_node_pt: Referencia al primer nodo de la cadena mezclada.
+*/
+static sll_node_pt _sllist_merge(sll_node_pt left, sll_node_pt right, int (*cmp_fn)(const void *, const void *), sll_node_pt * out_tail){
+    // Enlace del menor de los nodos en cabeza de cada cadena:
+    sll_node_t temp_dummy_node = {.data = NULL, .next = NULL};
+    sll_node_pt temp_tail_node = &temp_dummy_node;
+    while ((left != NULL) && (right != NULL)){
+        if (cmp_fn(left->data, right->data) <= 0){
+            temp_tail_node->next = left;
+            left = left->next;
+        } else {
+            temp_tail_node->next = right;
+            right = right->next;
+        }
+        temp_tail_node = temp_tail_node->next;
+    }
+
+    // Enlace del resto de la cadena no agotada y búsqueda de la cola:
+    temp_tail_node->next = (left != NULL) ? left : right;
+    while (temp_tail_node->next != NULL){
+        temp_tail_node = temp_tail_node->next;
+    }
+
+    *out_tail = temp_tail_node;
+    return temp_dummy_node.next;
+}
+
+/*
+    @brief Función interna que ordena (heapsort, sin memoria extra) los índices de los objetivos según sus valores.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param size_t * order: Referencia a los índices a ordenar.
+    @param size_t k: Número de índices.
+    @param const uint8_t * targets: Referencia a los objetivos contiguos.
+    @param size_t data_size: Tamaño (en bytes) de cada objetivo.
+    @param int (*cmp_fn)(const void *, const void *): Referencia a la función comparadora.
+
+    @retval None.
+*/
+static void _sllist_sort_indices(size_t * order, size_t k, const uint8_t * targets, size_t data_size, int (*cmp_fn)(const void *, const void *)){
+    size_t start = k / 2;
+    size_t end = k;
+    size_t root, child, temp;
+    while (end > 1){
+        // Fase de construcción del montículo o de extracción del máximo al final:
+        if (start > 0){
+            start--;
+        } else {
+            end--;
+            temp = order[0];
+            order[0] = order[end];
+            order[end] = temp;
+        }
+
+        // Hundimiento de la raíz actual hasta restaurar el montículo:
+        root = start;
+        while ((child = (2 * root) + 1) < end){
+            if ((child + 1 < end) && (cmp_fn(targets + (order[child] * data_size), targets + (order[child + 1] * data_size)) < 0)){
+                child++;
+            }
+            if (cmp_fn(targets + (order[root] * data_size), targets + (order[child] * data_size)) >= 0){
+                break;
+            }
+            temp = order[root];
+            order[root] = order[child];
+            order[child] = temp;
+            root = child;
+        }
+    }
+}
+
+/*
+    @brief Función interna que resuelve, con los datos de un nodo, los objetivos pendientes que los igualan.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param void * data: Referencia a los datos del nodo.
+    @param const uint8_t * targets: Referencia a los objetivos contiguos.
+    @param size_t k: Número de objetivos.
+    @param size_t data_size: Tamaño (en bytes) de cada objetivo.
+    @param int (*cmp_fn)(const void *, const void *): Referencia a la función comparadora.
+    @param const size_t * order: Referencia a los índices ordenados de los objetivos (nulo para comparación lineal).
+    @param void ** out: Referencia al array de referencias de salida.
+
+    @retval size_t: Número de objetivos resueltos con este nodo.
+*/
+static size_t _sllist_resolve_targets(void * data, const uint8_t * targets, size_t k, size_t data_size, int (*cmp_fn)(const void *, const void *), const size_t * order, void ** out){
+    size_t resolved = 0;
+
+    // Comparación lineal con los objetivos pendientes:
+    if (order == NULL){
+        for (size_t i = 0; i < k; i++){
+            if ((out[i] == NULL) && (cmp_fn(targets + (i * data_size), data) == 0)){
+                out[i] = data;
+                resolved++;
+            }
+        }
+        return resolved;
+    }
+
+    // Bisección del primer objetivo ordenado no menor que los datos:
+    size_t low = 0;
+    size_t high = k;
+    size_t mid;
+    while (low < high){
+        mid = low + ((high - low) / 2);
+        if (cmp_fn(targets + (order[mid] * data_size), data) < 0){
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    // Resolución de todos los objetivos iguales pendientes:
+    for (size_t i = low; (i < k) && (cmp_fn(targets + (order[i] * data_size), data) == 0); i++){
+        if (out[order[i]] == NULL){
+            out[order[i]] = data;
+            resolved++;
+        }
+    }
+
+    return resolved;
+}
 /* ---------------------------------------------------------------- */
\ No newline at end of file
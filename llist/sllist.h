@@ -8,6 +8,8 @@
 #include <stdint.h>
 #include <string.h>
 #include <stdbool.h>
+
+#include "../array/array.h"
 /* ---------------------------------------------------------------- */
 
 
@@ -15,6 +17,7 @@
 /* ---------------------------------------------------------------- */
 #define MIN_DATA_SIZE 1      // En bytes.
 #define MAX_DATA_SIZE 128    // En bytes.
+#define FIND_MANY_LINEAR_MAX 8  // Nº de objetivos hasta el que find_many compara linealmente (por encima, ordena los objetivos).
 /* ---------------------------------------------------------------- */
 
 
@@ -59,10 +62,24 @@ uint8_t sllist_insert_at(sll_linkedlist_pt list, const void * data, size_t index
 // Eliminación de elementos:
 uint8_t sllist_pop_front(sll_linkedlist_pt list);
 uint8_t sllist_remove_at(sll_linkedlist_pt list, size_t index);
+size_t sllist_remove_if(sll_linkedlist_pt list, bool (*pred_fn)(const void *, void *), void * ctx);
 
 // Búsqueda e iteración:
 void * sllist_find(sll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *));
 uint8_t sllist_foreach(sll_linkedlist_pt list, void (*fn)(void *));
+void * sllist_find_ctx(sll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *, void *), void * ctx);
+size_t sllist_find_all(sll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *, void *), void * ctx, array_pt out);
+uint8_t sllist_find_index(sll_linkedlist_pt list, const void * target, bool (*cmp_fn)(const void *, const void *, void *), void * ctx, size_t * out_index);
+uint8_t sllist_foreach_ctx(sll_linkedlist_pt list, bool (*fn)(void *, void *), void * ctx);
+size_t sllist_find_many(sll_linkedlist_pt list, const void * targets, size_t k, int (*cmp_fn)(const void *, const void *), void ** out);
+
+// Ordenación y mezcla:
+uint8_t sllist_sort(sll_linkedlist_pt list, int (*cmp_fn)(const void *, const void *));
+uint8_t sllist_merge_sorted(sll_linkedlist_pt dst, sll_linkedlist_pt src, int (*cmp_fn)(const void *, const void *));
+
+// Traspaso de nodos entre listas:
+uint8_t sllist_concat(sll_linkedlist_pt dst, sll_linkedlist_pt src);
+sll_linkedlist_pt sllist_split_at(sll_linkedlist_pt list, size_t index);
 
 // Utilidades generales:
 bool sllist_is_empty(sll_linkedlist_pt list);
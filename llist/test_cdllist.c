@@ -0,0 +1,149 @@
+#include "cdllist.h"
+#include <stdio.h>
+
+#define TEST_THREADS 4
+#define TEST_OPS 20000
+
+struct test_args{
+    cdll_linkedlist_pt list;        // Lista compartida.
+    uint32_t seed;                  // Semilla del generador del hilo.
+    int64_t balance;                // Inserciones - eliminaciones con éxito del hilo.
+};
+
+// Prototipos de funciones:
+void print_int(void * data);
+bool equal_int(const void * target, const void * data);
+bool is_even(const void * data, void * ctx);
+void * mixed_thread(void * arg);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de la lista de enteros:
+    cdll_linkedlist_pt list = cdllist_init(sizeof(int));
+    printf("\nSe ha creado la lista correctamente en la dirección (%p)\n", (void *)list);
+
+    // Inserciones por ambos extremos y en posiciones intermedias:
+    for (int i = 1; i <= 3; i++){
+        cdllist_push_back(list, &i);
+    }
+    int value = 0;
+    cdllist_push_front(list, &value);
+    value = 10;
+    cdllist_insert_at(list, &value, 2);
+    printf("Lista tras inserciones:");
+    cdllist_foreach(list, print_int);
+
+    value = 3;
+    int * found = (int *)cdllist_find(list, &value, equal_int);
+    printf("\nBúsqueda de %d: %s\n", value, (found != NULL) ? "encontrado" : "no encontrado");
+
+    // Eliminaciones:
+    cdllist_pop_front(list);
+    cdllist_pop_back(list);
+    cdllist_remove_at(list, 1);
+    printf("Lista tras eliminar cabecera, cola y posición 1:");
+    cdllist_foreach(list, print_int);
+    printf("\nTamaño: %ld, inserción fuera de rango (retorna %d)\n", cdllist_get_size(list), cdllist_insert_at(list, &value, 10));
+    cdllist_clear(list);
+
+    // Carga mixta concurrente (ambos extremos, posiciones intermedias y búsquedas):
+    pthread_t threads[TEST_THREADS];
+    struct test_args args[TEST_THREADS];
+    for (size_t i = 0; i < TEST_THREADS; i++){
+        args[i] = (struct test_args){.list = list, .seed = (uint32_t)(i + 1) * 2654435761u, .balance = 0};
+        pthread_create(&threads[i], NULL, mixed_thread, &args[i]);
+    }
+
+    int64_t balance = 0;
+    for (size_t i = 0; i < TEST_THREADS; i++){
+        pthread_join(threads[i], NULL);
+        balance += args[i].balance;
+    }
+
+    size_t size = cdllist_get_size(list);
+    size_t counted = 0;
+    while (cdllist_pop_back(list) == 0){
+        counted++;
+    }
+    printf("\n%d hilos x %d operaciones: tamaño esperado %ld, contador %ld, nodos eliminados al vaciar %ld\n",
+           TEST_THREADS, TEST_OPS, (long)balance, size, counted);
+
+    // Destrucción de la lista:
+    cdllist_deinit(&list);
+    printf("\nLista destruida, referencia: %p\n", (void *)list);
+
+    return 0;
+}
+
+/*
+    @brief Función que imprime un entero.
+
+    @param void * data: Referencia al entero.
+
+    @retval None.
+*/
+void print_int(void * data){
+    printf(" %d", *(int *)data);
+}
+
+/*
+    @brief Comparador de igualdad de enteros.
+
+    @param const void * target: Referencia al entero buscado.
+    @param const void * data: Referencia al entero del nodo.
+
+    @retval bool: true si coinciden, false en caso contrario.
+*/
+bool equal_int(const void * target, const void * data){
+    return *(const int *)target == *(const int *)data;
+}
+
+/*
+    @brief Predicado que indica si un entero es par.
+
+    @param const void * data: Referencia al entero.
+    @param void * ctx: Sin uso.
+
+    @retval bool: true si es par, false en caso contrario.
+*/
+bool is_even(const void * data, void * ctx){
+    return (*(const int *)data % 2) == 0;
+}
+
+/*
+    @brief Función del hilo de carga mixta: inserta, elimina y busca al azar llevando la cuenta de su balance.
+
+    @param void * arg: Referencia a los argumentos (struct test_args).
+
+    @retval void *: NULL.
+*/
+void * mixed_thread(void * arg){
+    struct test_args * args = (struct test_args *)arg;
+    for (int i = 0; i < TEST_OPS; i++){
+        args->seed = args->seed * 1103515245u + 12345u;
+        uint32_t op = (args->seed >> 16) % 8;
+        int value = (int)((args->seed >> 8) % 64);
+        size_t index = (args->seed >> 4) % 8;
+
+        if (op == 0){
+            args->balance += (cdllist_push_front(args->list, &value) == 0);
+        } else if (op == 1){
+            args->balance += (cdllist_push_back(args->list, &value) == 0);
+        } else if (op == 2){
+            args->balance += (cdllist_insert_at(args->list, &value, index) == 0);
+        } else if (op == 3){
+            args->balance -= (cdllist_pop_front(args->list) == 0);
+        } else if (op == 4){
+            args->balance -= (cdllist_pop_back(args->list) == 0);
+        } else if (op == 5){
+            args->balance -= (cdllist_remove_at(args->list, index) == 0);
+        } else if (op == 6){
+            cdllist_find(args->list, &value, equal_int);
+        } else if ((i % 64) == 7){
+            args->balance -= (int64_t)cdllist_remove_if(args->list, is_even, NULL);
+        }
+    }
+
+    return NULL;
+}
\ No newline at end of file
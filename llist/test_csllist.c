@@ -4,6 +4,11 @@
 // Prototipos de funciones:
 bool is_double(const void * target, const void * data);
 void print_u16_data(void * data);
+int cmp_u16(const void * a, const void * b);
+bool is_multiple_u16(const void * data, void * ctx);
+bool is_equal_counting(const void * target, const void * data, void * ctx);
+bool print_until_limit(void * data, void * ctx);
+size_t weight_u16(const void * data, void * ctx);
 
 // Función main:
 int main(int argc, char ** argv){
@@ -37,6 +42,107 @@ int main(int argc, char ** argv){
     printf("Tamaño de lista: %ld\n", csllist_get_size(list));
     printf("Tamaño de dato de cada nodo de la lista: %ld\n", csllist_get_data_size(list));
 
+    // Ordenación de la lista y mezcla con otra lista ordenada:
+    uint16_t sort_data[4] = {300, 7, 1024, 7};
+    csll_linkedlist_pt other = csllist_init(sizeof(uint16_t));
+    for (size_t i = 0; i < 4; i++){
+        csllist_push_back(list, &sort_data[i]);
+        csllist_push_front(other, &sort_data[i]);
+    }
+    csllist_sort(list, cmp_u16);
+    printf("\nLista tras ordenar: [ ");
+    csllist_foreach(list, print_u16_data);
+    printf("]\n");
+    csllist_sort(other, cmp_u16);
+    csllist_merge_sorted(list, other, cmp_u16);
+    printf("Lista tras mezclar con otra lista ordenada: [ ");
+    csllist_foreach(list, print_u16_data);
+    printf("] (tamaño %ld, tamaño de la otra lista %ld)\n", csllist_get_size(list), csllist_get_size(other));
+    csllist_deinit(&other);
+
+    // Separación de la lista en dos y concatenación de ambas partes:
+    other = csllist_split_at(list, 6);
+    printf("Lista tras separar en la posición 6: [ ");
+    csllist_foreach(list, print_u16_data);
+    printf("] + [ ");
+    csllist_foreach(other, print_u16_data);
+    printf("]\n");
+    csllist_concat(list, other);
+    printf("Lista tras concatenar de nuevo: [ ");
+    csllist_foreach(list, print_u16_data);
+    printf("] (tamaño %ld, tamaño de la otra lista %ld)\n", csllist_get_size(list), csllist_get_size(other));
+    csllist_deinit(&other);
+
+    // Eliminación de todos los múltiplos de un divisor dado (contexto del predicado):
+    uint16_t divisor = 4;
+    size_t removed = csllist_remove_if(list, is_multiple_u16, &divisor);
+    printf("Lista tras eliminar los %ld múltiplos de %d: [ ", removed, divisor);
+    csllist_foreach(list, print_u16_data);
+    printf("] (tamaño %ld)\n", csllist_get_size(list));
+
+    // Búsquedas con contexto (contador de comparaciones), búsqueda de todas las coincidencias y de la posición:
+    uint16_t target = 7;
+    size_t comparisons = 0;
+    size_t index = 0;
+    array_pt matches = array_init(sizeof(void *));
+    csllist_find_ctx(list, &target, is_equal_counting, &comparisons);
+    printf("\nBúsqueda de %d con contexto: %ld comparaciones.\n", target, comparisons);
+    printf("Coincidencias de %d encontradas: %ld\n", target, csllist_find_all(list, &target, is_equal_counting, &comparisons, matches));
+    target = 255;
+    if (csllist_find_index(list, &target, is_equal_counting, &comparisons, &index) == 0){
+        printf("Posición de %d en la lista: %ld\n", target, index);
+    }
+    array_deinit(matches);
+
+    // Recorrido con contexto y parada anticipada:
+    uint16_t limit = 100;
+    printf("Recorrido hasta superar %d: [ ", limit);
+    uint8_t stopped = csllist_foreach_ctx(list, print_until_limit, &limit);
+    printf("] (detenido: %d)\n", stopped == 2);
+
+    // Búsqueda de varios objetivos con un único recorrido de la lista:
+    uint16_t many_targets[3] = {255, 1, 7};
+    void * many_found[3];
+    size_t many_count = csllist_find_many(list, many_targets, 3, cmp_u16, many_found);
+    printf("Objetivos encontrados en un recorrido: %ld de 3 [ ", many_count);
+    for (size_t i = 0; i < 3; i++){
+        printf("%d:%s ", many_targets[i], (many_found[i] != NULL) ? "si" : "no");
+    }
+    printf("]\n");
+
+    // Rotación sin reservas (la cabecera avanza k posiciones):
+    csll_linkedlist_pt ring = csllist_init(sizeof(uint16_t));
+    for (uint16_t i = 1; i <= 5; i++){
+        csllist_push_back(ring, &i);
+    }
+    csllist_rotate(ring, 7);
+    printf("\nLista tras rotar 7 posiciones: [ ");
+    csllist_foreach(ring, print_u16_data);
+    printf("]\n");
+
+    // Round-robin con cursor persistente (se mantiene al insertar y al eliminar el nodo del turno):
+    printf("Turnos de round-robin: [ ");
+    for (size_t i = 0; i < 3; i++){
+        printf("%d ", *(uint16_t *)csllist_rr_next(ring));
+    }
+    uint16_t extra = 6;
+    csllist_push_back(ring, &extra);
+    csllist_remove_at(ring, 3);
+    printf("| tras insertar %d y eliminar el nodo del turno: ", extra);
+    for (size_t i = 0; i < 6; i++){
+        printf("%d ", *(uint16_t *)csllist_rr_next(ring));
+    }
+    printf("]\n");
+
+    // Round-robin ponderado (peso = valor % 4, los de peso 0 se saltan):
+    csllist_rr_reset(ring);
+    printf("Turnos de round-robin ponderado (peso = valor %% 4): [ ");
+    for (size_t i = 0; i < 12; i++){
+        printf("%d ", *(uint16_t *)csllist_rr_next_weighted(ring, weight_u16, NULL));
+    }
+    printf("]\n");
+    csllist_deinit(&ring);
+
     // Limpieza de la lista:
     csllist_clear(list);
 
@@ -78,4 +184,69 @@ bool is_double(const void * target, const void * data){
 */
 void print_u16_data(void * data){
     printf("%d ", *(uint16_t *)data);
+}
+
+/*
+    @brief Función comparadora de datos genéricos como uint16_t (al estilo de qsort).
+
+    @param const void * a: Primer dato.
+    @param const void * b: Segundo dato.
+
+    @retval int: <0 si a < b, 0 si a == b, >0 si a > b.
+*/
+int cmp_u16(const void * a, const void * b){
+    return (int)*(uint16_t *)a - (int)*(uint16_t *)b;
+}
+
+/*
+    @brief Predicado que indica si un dato genérico (uint16_t) es múltiplo del divisor dado como contexto.
+
+    @param const void * data: Referencia al dato.
+    @param void * ctx: Referencia al divisor (uint16_t).
+
+    @retval bool:
+                -> true: Si data es múltiplo de ctx.
+                -> false: En caso contrario.
+*/
+bool is_multiple_u16(const void * data, void * ctx){
+    return (*(uint16_t *)data % *(uint16_t *)ctx) == 0;
+}
+
+/*
+    @brief Comparador de igualdad entre datos genéricos (uint16_t) que cuenta las comparaciones realizadas en el contexto.
+
+    @param const void * target: Dato objetivo.
+    @param const void * data: Dato comparativo.
+    @param void * ctx: Referencia al contador de comparaciones (size_t).
+
+    @retval bool: true si target == data, false en caso contrario.
+*/
+bool is_equal_counting(const void * target, const void * data, void * ctx){
+    (*(size_t *)ctx)++;
+    return (*(uint16_t *)target == *(uint16_t *)data);
+}
+
+/*
+    @brief Función que imprime un dato genérico como uint16_t y solicita detener el recorrido si supera el límite dado como contexto.
+
+    @param void * data: Referencia a los datos.
+    @param void * ctx: Referencia al límite (uint16_t).
+
+    @retval bool: true para detener el recorrido, false para continuar.
+*/
+bool print_until_limit(void * data, void * ctx){
+    printf("%d ", *(uint16_t *)data);
+    return *(uint16_t *)data > *(uint16_t *)ctx;
+}
+
+/*
+    @brief Función de peso para round-robin ponderado: el resto de dividir el dato genérico (uint16_t) entre 4.
+
+    @param const void * data: Referencia al dato.
+    @param void * ctx: Contexto de usuario (no usado).
+
+    @retval size_t: Peso del dato.
+*/
+size_t weight_u16(const void * data, void * ctx){
+    return *(uint16_t *)data % 4;
 }
\ No newline at end of file
@@ -4,6 +4,10 @@
 // Prototipos de funciones:
 bool is_double(const void * target, const void * data);
 void print_u16_data(void * data);
+int cmp_u16(const void * a, const void * b);
+bool is_multiple_u16(const void * data, void * ctx);
+bool is_equal_counting(const void * target, const void * data, void * ctx);
+bool print_until_limit(void * data, void * ctx);
 
 // Función main:
 int main(int argc, char ** argv){
@@ -37,6 +41,78 @@ int main(int argc, char ** argv){
     printf("Tamaño de lista: %ld\n", dllist_get_size(list));
     printf("Tamaño de dato de cada nodo de la lista: %ld\n", dllist_get_data_size(list));
 
+    // Ordenación de la lista y mezcla con otra lista ordenada:
+    uint16_t sort_data[4] = {300, 7, 1024, 7};
+    dll_linkedlist_pt other = dllist_init(sizeof(uint16_t));
+    for (size_t i = 0; i < 4; i++){
+        dllist_push_back(list, &sort_data[i]);
+        dllist_push_front(other, &sort_data[i]);
+    }
+    dllist_sort(list, cmp_u16);
+    printf("\nLista tras ordenar: [ ");
+    dllist_foreach(list, print_u16_data);
+    printf("]\n");
+    dllist_sort(other, cmp_u16);
+    dllist_merge_sorted(list, other, cmp_u16);
+    printf("Lista tras mezclar con otra lista ordenada: [ ");
+    dllist_foreach(list, print_u16_data);
+    printf("] (tamaño %ld, tamaño de la otra lista %ld)\n", dllist_get_size(list), dllist_get_size(other));
+    dllist_deinit(&other);
+
+    // Separación de la lista en dos y concatenación de ambas partes:
+    other = dllist_split_at(list, 6);
+    printf("Lista tras separar en la posición 6: [ ");
+    dllist_foreach(list, print_u16_data);
+    printf("] + [ ");
+    dllist_foreach(other, print_u16_data);
+    printf("]\n");
+    dllist_splice(list, list->head, other, dllist_node_at(other, 1), other->tail);
+    printf("Lista tras trasladar (splice) desde la posición 1 de la otra lista a la cabecera: [ ");
+    dllist_foreach(list, print_u16_data);
+    printf("] (tamaño %ld, tamaño de la otra lista %ld)\n", dllist_get_size(list), dllist_get_size(other));
+    dllist_concat(list, other);
+    printf("Lista tras concatenar de nuevo: [ ");
+    dllist_foreach(list, print_u16_data);
+    printf("] (tamaño %ld, tamaño de la otra lista %ld)\n", dllist_get_size(list), dllist_get_size(other));
+    dllist_deinit(&other);
+
+    // Eliminación de todos los múltiplos de un divisor dado (contexto del predicado):
+    uint16_t divisor = 4;
+    size_t removed = dllist_remove_if(list, is_multiple_u16, &divisor);
+    printf("Lista tras eliminar los %ld múltiplos de %d: [ ", removed, divisor);
+    dllist_foreach(list, print_u16_data);
+    printf("] (tamaño %ld)\n", dllist_get_size(list));
+
+    // Búsquedas con contexto (contador de comparaciones), búsqueda de todas las coincidencias y de la posición:
+    uint16_t target = 7;
+    size_t comparisons = 0;
+    size_t index = 0;
+    array_pt matches = array_init(sizeof(void *));
+    dllist_find_ctx(list, &target, is_equal_counting, &comparisons);
+    printf("\nBúsqueda de %d con contexto: %ld comparaciones.\n", target, comparisons);
+    printf("Coincidencias de %d encontradas: %ld\n", target, dllist_find_all(list, &target, is_equal_counting, &comparisons, matches));
+    target = 255;
+    if (dllist_find_index(list, &target, is_equal_counting, &comparisons, &index) == 0){
+        printf("Posición de %d en la lista: %ld\n", target, index);
+    }
+    array_deinit(matches);
+
+    // Recorrido con contexto y parada anticipada:
+    uint16_t limit = 100;
+    printf("Recorrido hasta superar %d: [ ", limit);
+    uint8_t stopped = dllist_foreach_ctx(list, print_until_limit, &limit);
+    printf("] (detenido: %d)\n", stopped == 2);
+
+    // Búsqueda de varios objetivos con un único recorrido de la lista:
+    uint16_t many_targets[3] = {255, 1, 7};
+    void * many_found[3];
+    size_t many_count = dllist_find_many(list, many_targets, 3, cmp_u16, many_found);
+    printf("Objetivos encontrados en un recorrido: %ld de 3 [ ", many_count);
+    for (size_t i = 0; i < 3; i++){
+        printf("%d:%s ", many_targets[i], (many_found[i] != NULL) ? "si" : "no");
+    }
+    printf("]\n");
+
     // Limpieza de la lista:
     dllist_clear(list);
 
@@ -78,4 +154,57 @@ bool is_double(const void * target, const void * data){
 */
 void print_u16_data(void * data){
     printf("%d ", *(uint16_t *)data);
+}
+
+/*
+    @brief Función comparadora de datos genéricos como uint16_t (al estilo de qsort).
+
+    @param const void * a: Primer dato.
+    @param const void * b: Segundo dato.
+
+    @retval int: <0 si a < b, 0 si a == b, >0 si a > b.
+*/
+int cmp_u16(const void * a, const void * b){
+    return (int)*(uint16_t *)a - (int)*(uint16_t *)b;
+}
+
+/*
+    @brief Predicado que indica si un dato genérico (uint16_t) es múltiplo del divisor dado como contexto.
+
+    @param const void * data: Referencia al dato.
+    @param void * ctx: Referencia al divisor (uint16_t).
+
+    @retval bool:
+                -> true: Si data es múltiplo de ctx.
+                -> false: En caso contrario.
+*/
+bool is_multiple_u16(const void * data, void * ctx){
+    return (*(uint16_t *)data % *(uint16_t *)ctx) == 0;
+}
+
+/*
+    @brief Comparador de igualdad entre datos genéricos (uint16_t) que cuenta las comparaciones realizadas en el contexto.
+
+    @param const void * target: Dato objetivo.
+    @param const void * data: Dato comparativo.
+    @param void * ctx: Referencia al contador de comparaciones (size_t).
+
+    @retval bool: true si target == data, false en caso contrario.
+*/
+bool is_equal_counting(const void * target, const void * data, void * ctx){
+    (*(size_t *)ctx)++;
+    return (*(uint16_t *)target == *(uint16_t *)data);
+}
+
+/*
+    @brief Función que imprime un dato genérico como uint16_t y solicita detener el recorrido si supera el límite dado como contexto.
+
+    @param void * data: Referencia a los datos.
+    @param void * ctx: Referencia al límite (uint16_t).
+
+    @retval bool: true para detener el recorrido, false para continuar.
+*/
+bool print_until_limit(void * data, void * ctx){
+    printf("%d ", *(uint16_t *)data);
+    return *(uint16_t *)data > *(uint16_t *)ctx;
 }
\ No newline at end of file
@@ -0,0 +1,268 @@
+#include "rcudllist.h"
+#include <stdio.h>
+
+#define TEST_READERS 3
+#define TEST_ENTRIES 16
+#define TEST_UPDATES 20000
+#define TEST_WRITERS 2
+#define TEST_STRESS_OPS 200000
+
+struct entry{
+    uint32_t key;                   // Clave de la entrada.
+    uint32_t value;                 // Valor de la entrada.
+    uint32_t check;                 // key ^ value (detecta lecturas incoherentes).
+};
+
+struct test_args{
+    rcu_dll_linkedlist_pt list;     // Lista compartida.
+    atomic_bool * done;             // Indica a los lectores que terminen.
+    size_t passes;                  // Recorridos completos realizados por el hilo.
+    size_t errors;                  // Entradas incoherentes leídas.
+};
+
+struct writer_args{
+    rcu_dll_linkedlist_pt list;     // Lista compartida.
+    uint32_t seed;                  // Semilla del generador de operaciones.
+    size_t removed;                 // Entradas eliminadas por el hilo.
+};
+
+// Prototipos de funciones:
+bool print_entry(const void * data, void * ctx);
+bool check_entry(const void * data, void * ctx);
+bool same_key(const void * target, const void * data, void * ctx);
+bool odd_key(const void * data, void * ctx);
+bool key_in_bucket(const void * data, void * ctx);
+void * reader_thread(void * arg);
+void * writer_thread(void * arg);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de la lista y registro del hilo principal:
+    rcu_dll_linkedlist_pt list = rcudllist_init(sizeof(struct entry));
+    ebr_record_pt record = rcudllist_register(list);
+    printf("\nSe ha creado la lista correctamente en la dirección (%p), registro: (%p)\n", (void *)list, (void *)record);
+
+    // Inserción, sustitución, búsqueda y eliminación desde un solo hilo:
+    for (uint32_t i = 0; i < 6; i++){
+        struct entry temp_entry = {i, i * 10, i ^ (i * 10)};
+        rcudllist_push_back(list, record, &temp_entry);
+    }
+    uint32_t key = 3;
+    struct entry updated = {3, 333, 3 ^ 333};
+    rcudllist_replace(list, record, &key, same_key, NULL, &updated);
+    printf("Lista tras sustituir la clave 3:");
+    rcudllist_foreach(list, record, print_entry, NULL);
+
+    struct entry found;
+    if (rcudllist_find(list, record, &key, same_key, NULL, &found) == 0){
+        printf("\nClave %u encontrada con valor %u\n", found.key, found.value);
+    }
+
+    size_t removed = rcudllist_remove_if(list, record, odd_key, NULL);
+    rcudllist_pop_front(list, record);
+    printf("Eliminadas %ld claves impares y la cabecera:", removed);
+    rcudllist_foreach(list, record, print_entry, NULL);
+    printf("\nTamaño: %ld\n", rcudllist_get_size(list));
+    rcudllist_clear(list, record);
+
+    // Lectores concurrentes mientras un escritor sustituye, inserta y elimina entradas:
+    for (uint32_t i = 0; i < TEST_ENTRIES; i++){
+        struct entry temp_entry = {i, 0, i};
+        rcudllist_push_back(list, record, &temp_entry);
+    }
+
+    atomic_bool done = false;
+    pthread_t readers[TEST_READERS];
+    struct test_args args[TEST_READERS];
+    for (size_t i = 0; i < TEST_READERS; i++){
+        args[i] = (struct test_args){.list = list, .done = &done, .passes = 0, .errors = 0};
+        pthread_create(&readers[i], NULL, reader_thread, &args[i]);
+    }
+
+    for (uint32_t i = 1; i <= TEST_UPDATES; i++){
+        key = i % TEST_ENTRIES;
+        struct entry temp_entry = {key, i, key ^ i};
+        rcudllist_replace(list, record, &key, same_key, NULL, &temp_entry);
+        if ((i % 8) == 0){
+            struct entry temp_extra = {TEST_ENTRIES, i, TEST_ENTRIES ^ i};
+            rcudllist_push_back(list, record, &temp_extra);
+            rcudllist_pop_back(list, record);
+        }
+    }
+    atomic_store(&done, true);
+
+    size_t passes = 0;
+    size_t errors = 0;
+    for (size_t i = 0; i < TEST_READERS; i++){
+        pthread_join(readers[i], NULL);
+        passes += args[i].passes;
+        errors += args[i].errors;
+    }
+    printf("\n%d sustituciones con %d lectores: %ld recorridos, entradas incoherentes: %ld, tamaño final: %ld\n",
+           TEST_UPDATES, TEST_READERS, passes, errors, rcudllist_get_size(list));
+
+    // Prueba de estrés: varios escritores eliminan nodos por todas las vías (pop, remove_if, replace y clear) mientras los
+    // lectores recorren la lista; un nodo liberado antes de tiempo se lee como entrada incoherente (o falla con ASan):
+    atomic_store(&done, false);
+    for (size_t i = 0; i < TEST_READERS; i++){
+        args[i] = (struct test_args){.list = list, .done = &done, .passes = 0, .errors = 0};
+        pthread_create(&readers[i], NULL, reader_thread, &args[i]);
+    }
+
+    pthread_t writers[TEST_WRITERS];
+    struct writer_args writer_args[TEST_WRITERS];
+    for (size_t i = 0; i < TEST_WRITERS; i++){
+        writer_args[i] = (struct writer_args){.list = list, .seed = 12345 + (uint32_t)i, .removed = 0};
+        pthread_create(&writers[i], NULL, writer_thread, &writer_args[i]);
+    }
+
+    removed = 0;
+    for (size_t i = 0; i < TEST_WRITERS; i++){
+        pthread_join(writers[i], NULL);
+        removed += writer_args[i].removed;
+    }
+    atomic_store(&done, true);
+
+    passes = 0;
+    errors = 0;
+    for (size_t i = 0; i < TEST_READERS; i++){
+        pthread_join(readers[i], NULL);
+        passes += args[i].passes;
+        errors += args[i].errors;
+    }
+    printf("Estrés con %d escritores y %d lectores: %ld eliminaciones, %ld recorridos, entradas incoherentes: %ld\n",
+           TEST_WRITERS, TEST_READERS, removed, passes, errors);
+
+    // Baja del hilo y destrucción de la lista:
+    rcudllist_unregister(list, &record);
+    rcudllist_deinit(&list);
+    printf("\nLista destruida, referencia: %p\n", (void *)list);
+
+    return 0;
+}
+
+/*
+    @brief Función de recorrido que imprime una entrada.
+
+    @param const void * data: Referencia a la entrada (struct entry).
+    @param void * ctx: Sin uso.
+
+    @retval bool: false (no detiene el recorrido).
+*/
+bool print_entry(const void * data, void * ctx){
+    const struct entry * temp_entry = (const struct entry *)data;
+    printf(" (%u: %u)", temp_entry->key, temp_entry->value);
+    return false;
+}
+
+/*
+    @brief Función de recorrido que cuenta las entradas incoherentes.
+
+    @param const void * data: Referencia a la entrada (struct entry).
+    @param void * ctx: Referencia al contador de errores (size_t).
+
+    @retval bool: false (no detiene el recorrido).
+*/
+bool check_entry(const void * data, void * ctx){
+    const struct entry * temp_entry = (const struct entry *)data;
+    if ((temp_entry->key ^ temp_entry->value) != temp_entry->check){
+        (*(size_t *)ctx)++;
+    }
+    return false;
+}
+
+/*
+    @brief Comparador que iguala una clave con la de una entrada.
+
+    @param const void * target: Referencia a la clave (uint32_t).
+    @param const void * data: Referencia a la entrada (struct entry).
+    @param void * ctx: Sin uso.
+
+    @retval bool: true si coinciden, false en caso contrario.
+*/
+bool same_key(const void * target, const void * data, void * ctx){
+    return *(const uint32_t *)target == ((const struct entry *)data)->key;
+}
+
+/*
+    @brief Predicado que indica si la clave de una entrada es impar.
+
+    @param const void * data: Referencia a la entrada (struct entry).
+    @param void * ctx: Sin uso.
+
+    @retval bool: true si la clave es impar, false en caso contrario.
+*/
+bool odd_key(const void * data, void * ctx){
+    return (((const struct entry *)data)->key % 2) == 1;
+}
+
+/*
+    @brief Predicado que indica si la clave de una entrada pertenece a un grupo (clave % 8).
+
+    @param const void * data: Referencia a la entrada (struct entry).
+    @param void * ctx: Referencia al grupo (uint32_t).
+
+    @retval bool: true si la clave es del grupo, false en caso contrario.
+*/
+bool key_in_bucket(const void * data, void * ctx){
+    return (((const struct entry *)data)->key % 8) == *(uint32_t *)ctx;
+}
+
+/*
+    @brief Función del hilo lector: recorre la lista sin bloqueos comprobando cada entrada.
+
+    @param void * arg: Referencia a los argumentos (struct test_args).
+
+    @retval void *: NULL.
+*/
+void * reader_thread(void * arg){
+    struct test_args * args = (struct test_args *)arg;
+    ebr_record_pt record = rcudllist_register(args->list);
+    while (!atomic_load(args->done)){
+        rcudllist_foreach(args->list, record, check_entry, &args->errors);
+        args->passes++;
+    }
+    rcudllist_unregister(args->list, &record);
+
+    return NULL;
+}
+
+/*
+    @brief Función del hilo escritor de la prueba de estrés: inserta, sustituye y elimina entradas al azar.
+
+    @param void * arg: Referencia a los argumentos (struct writer_args).
+
+    @retval void *: NULL.
+*/
+void * writer_thread(void * arg){
+    struct writer_args * args = (struct writer_args *)arg;
+    ebr_record_pt record = rcudllist_register(args->list);
+    uint32_t seed = args->seed;
+    for (uint32_t i = 0; i < TEST_STRESS_OPS; i++){
+        seed = seed * 1103515245 + 12345;
+        uint32_t key = (seed >> 8) % 64;
+        uint32_t op = (seed >> 20) % 100;
+        struct entry temp_entry = {key, i, key ^ i};
+        if (op < 45){
+            rcudllist_push_back(args->list, record, &temp_entry);
+        } else if (op < 60){
+            rcudllist_push_front(args->list, record, &temp_entry);
+        } else if (op < 75){
+            rcudllist_replace(args->list, record, &key, same_key, NULL, &temp_entry);
+        } else if (op < 85){
+            args->removed += (rcudllist_pop_front(args->list, record) == 0);
+        } else if (op < 95){
+            args->removed += (rcudllist_pop_back(args->list, record) == 0);
+        } else if (op < 99){
+            uint32_t bucket = key % 8;
+            args->removed += rcudllist_remove_if(args->list, record, key_in_bucket, &bucket);
+        } else {
+            args->removed += rcudllist_get_size(args->list);
+            rcudllist_clear(args->list, record);
+        }
+    }
+    rcudllist_unregister(args->list, &record);
+
+    return NULL;
+}
\ No newline at end of file
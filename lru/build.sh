@@ -0,0 +1,63 @@
+#!/bin/bash
+
+
+# Variables de entorno             #
+# -------------------------------- #
+CC=gcc
+CFLAGS_TEST="-g -Wall -O2"
+CFLAGS_LIB="-Wall -O2 -fPIC -shared"
+
+SRC_LRU="lru.c ../llist/dllist.c ../array/array.c"
+SRC_TEST=test_lru.c
+
+TEST_PROG=test_lru.elf
+LIB_PROG=lru.so
+# -------------------------------- #
+
+
+# Lógica de uso                    #
+# -------------------------------- #
+if [ "$1" == "test" ]; then
+    echo
+    echo "[BUILD-LRU-TEST]: Compilando programa de prueba de lru..."
+    if $CC $CFLAGS_TEST $SRC_TEST $SRC_LRU -o $TEST_PROG; then
+        echo "[BUILD-LRU-TEST]: Compilación completada."
+        echo "[BUILD-LRU-TEST]: Ejecutando programa de prueba..."
+        echo
+        ./$TEST_PROG
+        echo
+        echo "[BUILD-LRU-TEST]: Ejecución de programa de prueba finalizado."
+    else
+        echo "[BUILD-LRU-TEST][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$1" == "lib" ]; then
+    echo
+    echo "[BUILD-LRU-LIB]: Compilando la librería de lru..."
+    if $CC $CFLAGS_LIB $SRC_LRU -o $LIB_PROG; then
+        mv $LIB_PROG ./lib
+        echo "[BUILD-LRU-LIB]: Librearía compilada."
+    else
+        echo "[BUILD-LRU-LIB][ERR]: Error de compilación, librería no generada."
+    fi
+    echo
+
+elif [ "$1" == "clean" ]; then
+    echo
+    echo "[BUILD-LRU-CLEAN]: Limpiando espacio de trabajo..."
+    rm -f ./$TEST_PROG ./lib/$LIB_PROG
+    echo "[BUILD-LRU-CLEAN]: Espacio de trabajo limpio."
+    echo
+
+else
+    echo
+    echo "[BUILD-LRU][ERR]: Uso incorrecto u opciones inválidas."
+    echo -e "\n\t[Uso]:"
+    echo -e "\t\t-> ./build.sh test: \tCompila y ejecuta el programa de test (.elf)"
+    echo -e "\t\t-> ./build.sh lib: \tCompila y genera la librería compartida (.so) bajo la carpeta lib/"
+    echo -e "\t\t-> ./build.sh clean: \tLimpia el espacio de trabajo eliminando archivos generados"
+    echo
+    exit 1
+fi
+# -------------------------------- #
\ No newline at end of file
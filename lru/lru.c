@@ -0,0 +1,733 @@
+#include "lru.h"
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static uint64_t _lru_hash(const void * key, size_t key_size);
+static size_t _lru_index_find(lru_cache_pt cache, const void * key, uint64_t hash);
+static void _lru_index_insert(lru_slot_pt index, size_t index_capacity, uint64_t hash, dll_node_pt node, size_t bytes);
+static void _lru_index_erase(lru_cache_pt cache, size_t pos);
+static uint8_t _lru_index_grow(lru_cache_pt cache);
+static dll_node_pt _lru_node_init(lru_cache_pt cache);
+static void _lru_node_deinit(dll_node_pt node);
+static void _lru_list_unlink(lru_cache_pt cache, dll_node_pt node);
+static void _lru_list_push_front(lru_cache_pt cache, dll_node_pt node);
+static dll_node_pt _lru_detach_tail(lru_cache_pt cache);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar (a 0's) una caché LRU.
+    @note: Al menos uno de los límites (entradas o bytes) debe ser distinto de 0.
+
+    @param size_t key_size: Tamaño (en bytes) de la clave.
+    @param size_t value_size: Tamaño (en bytes) del valor.
+    @param size_t max_entries: Número máximo de entradas (0 = sin límite).
+    @param size_t max_bytes: Número máximo de bytes ocupados por las entradas (0 = sin límite).
+
+    @retval lru_cache_pt: Referencia a la caché creada.
+*/
+lru_cache_pt lru_init(size_t key_size, size_t value_size, size_t max_entries, size_t max_bytes){
+    // Comprobación de los tamaños de clave y valor, y de los límites:
+    if ((key_size < LRU_MIN_KEY_SIZE) || (key_size > LRU_MAX_KEY_SIZE) || (value_size < MIN_DATA_SIZE) || (key_size + value_size > MAX_DATA_SIZE)){
+        return NULL;
+    }
+
+    if ((max_entries == 0) && (max_bytes == 0)){
+        return NULL;
+    }
+
+    // Reserva de memoria para la estructura básica de la caché:
+    lru_cache_pt cache = (lru_cache_pt)malloc(sizeof(lru_cache_t));
+    if (cache == NULL){
+        return NULL;
+    }
+
+    // Dimensionado del índice (si se conoce el límite de entradas, se reserva de una vez):
+    size_t index_capacity = LRU_INDEX_MIN_CAPACITY;
+    while ((max_entries != 0) && ((max_entries * 100) > (index_capacity * LRU_INDEX_MAX_LOAD))){
+        index_capacity *= 2;
+    }
+
+    cache->index = (lru_slot_pt)calloc(index_capacity, sizeof(lru_slot_t));
+    if (cache->index == NULL){
+        free(cache);
+        return NULL;
+    }
+
+    // Inicio de los miembros de la estructura:
+    cache->list.head = NULL;
+    cache->list.tail = NULL;
+    cache->list.data_size = key_size + value_size;
+    cache->list.size = 0;
+    cache->index_capacity = index_capacity;
+    cache->key_size = key_size;
+    cache->value_size = value_size;
+    cache->max_entries = max_entries;
+    cache->max_bytes = max_bytes;
+    cache->bytes = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->evict_fn = NULL;
+    cache->evict_ctx = NULL;
+
+    return cache;
+}
+
+/*
+    @brief Función para destruir y liberar una caché LRU.
+    @note: No se llama a la función de desalojo para las entradas liberadas.
+
+    @param lru_cache_pt * cache: Referencia a la referencia de la caché.
+
+    @retval None.
+*/
+void lru_deinit(lru_cache_pt * cache){
+    // Comprobación de que la caché no sea nula:
+    if ((cache == NULL) || (*cache == NULL)){
+        return;
+    }
+
+    // Liberación de los nodos, del índice y de la estructura:
+    dllist_clear(&(*cache)->list);
+    free((*cache)->index);
+    free(*cache);
+    *cache = NULL;
+}
+
+/*
+    @brief Función para liberar todas las entradas sin liberar la estructura principal.
+    @note: No se llama a la función de desalojo ni se reinician los contadores de aciertos y fallos.
+
+    @param lru_cache_pt cache: Referencia a la caché.
+
+    @retval None.
+*/
+void lru_clear(lru_cache_pt cache){
+    // Comprobación de caché válida:
+    if (cache == NULL){
+        return;
+    }
+
+    // Liberación de los nodos y vaciado del índice:
+    dllist_clear(&cache->list);
+    memset(cache->index, 0, cache->index_capacity * sizeof(lru_slot_t));
+    cache->bytes = 0;
+}
+
+/*
+    @brief Función para establecer la función llamada al desalojar una entrada por falta de capacidad (o con lru_evict).
+
+    @param lru_cache_pt cache: Referencia a la caché.
+    @param void (*evict_fn)(const void *, void *, void *): Referencia a la función (clave, valor, contexto); nulo para desactivarla.
+    @param void * ctx: Referencia al contexto de usuario que se pasa a la función (puede ser nulo).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: La caché no es válida.
+*/
+uint8_t lru_set_evict_fn(lru_cache_pt cache, void (*evict_fn)(const void *, void *, void *), void * ctx){
+    // Comprobación de caché válida:
+    if (cache == NULL){
+        return 1;
+    }
+
+    cache->evict_fn = evict_fn;
+    cache->evict_ctx = ctx;
+
+    return 0;
+}
+
+/*
+    @brief Función para insertar (o actualizar) una entrada como la más reciente, con coste clave + valor bytes.
+
+    @param lru_cache_pt cache: Referencia a la caché.
+    @param const void * key: Referencia a la clave.
+    @param const void * value: Referencia al valor.
+
+    @retval uint8_t: Mismos códigos que lru_put_weighted.
+*/
+uint8_t lru_put(lru_cache_pt cache, const void * key, const void * value){
+    // Comprobación de caché válida:
+    if (cache == NULL){
+        return 1;
+    }
+
+    return lru_put_weighted(cache, key, value, cache->key_size + cache->value_size);
+}
+
+/*
+    @brief Función para insertar (o actualizar) una entrada como la más reciente, con un coste en bytes dado.
+    @note: Se desalojan las entradas menos recientes necesarias para respetar los límites; el nodo del primer desalojo se reutiliza para la nueva entrada.
+
+    @param lru_cache_pt cache: Referencia a la caché.
+    @param const void * key: Referencia a la clave.
+    @param const void * value: Referencia al valor.
+    @param size_t bytes: Coste (en bytes) de la entrada frente al límite de bytes.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Caché, clave o valor no válidos.
+                -> 2: Error de reserva de memoria.
+                -> 3: El coste de la entrada supera el límite de bytes de la caché.
+*/
+uint8_t lru_put_weighted(lru_cache_pt cache, const void * key, const void * value, size_t bytes){
+    // Comprobación de caché, clave y valor válidos:
+    if ((cache == NULL) || (key == NULL) || (value == NULL)){
+        return 1;
+    }
+
+    if ((cache->max_bytes != 0) && (bytes > cache->max_bytes)){
+        return 3;
+    }
+
+    // Caso de clave existente (actualización del valor y del coste):
+    uint64_t hash = _lru_hash(key, cache->key_size);
+    size_t pos = _lru_index_find(cache, key, hash);
+    if (pos != cache->index_capacity){
+        dll_node_pt temp_node = cache->index[pos].node;
+        memcpy((uint8_t *)temp_node->data + cache->key_size, value, cache->value_size);
+        cache->bytes = cache->bytes - cache->index[pos].bytes + bytes;
+        cache->index[pos].bytes = bytes;
+        _lru_list_unlink(cache, temp_node);
+        _lru_list_push_front(cache, temp_node);
+
+        // Desalojo de las entradas menos recientes hasta respetar el límite de bytes:
+        while ((cache->max_bytes != 0) && (cache->bytes > cache->max_bytes)){
+            _lru_node_deinit(_lru_detach_tail(cache));
+        }
+        return 0;
+    }
+
+    // Desalojo de las entradas menos recientes necesarias (conservando el primer nodo para reutilizarlo):
+    dll_node_pt temp_new_node = NULL;
+    dll_node_pt temp_evicted_node;
+    while (((cache->max_entries != 0) && (cache->list.size >= cache->max_entries)) ||
+           ((cache->max_bytes != 0) && (cache->bytes + bytes > cache->max_bytes))){
+        temp_evicted_node = _lru_detach_tail(cache);
+        if (temp_new_node == NULL){
+            temp_new_node = temp_evicted_node;
+        } else {
+            _lru_node_deinit(temp_evicted_node);
+        }
+    }
+
+    // Crecimiento del índice si se supera la ocupación máxima:
+    if (((cache->list.size + 1) * 100) > (cache->index_capacity * LRU_INDEX_MAX_LOAD)){
+        if (_lru_index_grow(cache) != 0){
+            if (temp_new_node != NULL){
+                _lru_node_deinit(temp_new_node);
+            }
+            return 2;
+        }
+    }
+
+    // Creación del nodo (si no se reutiliza uno desalojado):
+    if (temp_new_node == NULL){
+        temp_new_node = _lru_node_init(cache);
+        if (temp_new_node == NULL){
+            return 2;
+        }
+    }
+
+    // Copia de clave y valor, e inserción en el índice y en la cabecera de la lista:
+    memcpy(temp_new_node->data, key, cache->key_size);
+    memcpy((uint8_t *)temp_new_node->data + cache->key_size, value, cache->value_size);
+    _lru_index_insert(cache->index, cache->index_capacity, hash, temp_new_node, bytes);
+    _lru_list_push_front(cache, temp_new_node);
+    cache->bytes += bytes;
+
+    return 0;
+}
+
+/*
+    @brief Función para obtener el valor de una entrada, marcándola como la más reciente.
+    @note: Actualiza los contadores de aciertos y fallos.
+
+    @param lru_cache_pt cache: Referencia a la caché.
+    @param const void * key: Referencia a la clave.
+    @param void * out_value: Referencia a la variable externa donde se copiará el valor.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores (acierto).
+                -> 1: Caché, clave o variable externa no válidos.
+                -> 2: La clave no está en la caché (fallo).
+*/
+uint8_t lru_get(lru_cache_pt cache, const void * key, void * out_value){
+    // Comprobación de caché, clave y variable externa válidos:
+    if ((cache == NULL) || (key == NULL) || (out_value == NULL)){
+        return 1;
+    }
+
+    // Búsqueda de la clave en el índice:
+    size_t pos = _lru_index_find(cache, key, _lru_hash(key, cache->key_size));
+    if (pos == cache->index_capacity){
+        cache->misses++;
+        return 2;
+    }
+
+    // Traslado del nodo a la cabecera y copia del valor:
+    dll_node_pt temp_node = cache->index[pos].node;
+    _lru_list_unlink(cache, temp_node);
+    _lru_list_push_front(cache, temp_node);
+    memcpy(out_value, (uint8_t *)temp_node->data + cache->key_size, cache->value_size);
+    cache->hits++;
+
+    return 0;
+}
+
+/*
+    @brief Función para marcar una entrada como la más reciente sin copiar su valor.
+    @note: No actualiza los contadores de aciertos y fallos.
+
+    @param lru_cache_pt cache: Referencia a la caché.
+    @param const void * key: Referencia a la clave.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Caché o clave no válidos.
+                -> 2: La clave no está en la caché.
+*/
+uint8_t lru_touch(lru_cache_pt cache, const void * key){
+    // Comprobación de caché y clave válidos:
+    if ((cache == NULL) || (key == NULL)){
+        return 1;
+    }
+
+    // Búsqueda de la clave y traslado del nodo a la cabecera:
+    size_t pos = _lru_index_find(cache, key, _lru_hash(key, cache->key_size));
+    if (pos == cache->index_capacity){
+        return 2;
+    }
+
+    _lru_list_unlink(cache, cache->index[pos].node);
+    _lru_list_push_front(cache, cache->index[pos].node);
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna si una clave está en la caché, sin alterar el orden de uso ni los contadores.
+
+    @param lru_cache_pt cache: Referencia a la caché.
+    @param const void * key: Referencia a la clave.
+
+    @retval bool:
+                -> true: La clave está en la caché.
+                -> false: La clave no está en la caché (o la caché/clave no es válida).
+*/
+bool lru_contains(lru_cache_pt cache, const void * key){
+    // Comprobación de caché y clave válidos:
+    if ((cache == NULL) || (key == NULL)){
+        return false;
+    }
+
+    return _lru_index_find(cache, key, _lru_hash(key, cache->key_size)) != cache->index_capacity;
+}
+
+/*
+    @brief Función para desalojar la entrada menos reciente, llamando a la función de desalojo.
+
+    @param lru_cache_pt cache: Referencia a la caché.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: La caché no es válida.
+                -> 2: La caché está vacía.
+*/
+uint8_t lru_evict(lru_cache_pt cache){
+    // Comprobación de caché válida y no vacía:
+    if (cache == NULL){
+        return 1;
+    }
+
+    if (cache->list.tail == NULL){
+        return 2;
+    }
+
+    _lru_node_deinit(_lru_detach_tail(cache));
+
+    return 0;
+}
+
+/*
+    @brief Función para eliminar la entrada de una clave dada, sin llamar a la función de desalojo.
+
+    @param lru_cache_pt cache: Referencia a la caché.
+    @param const void * key: Referencia a la clave.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Caché o clave no válidos.
+                -> 2: La clave no está en la caché.
+*/
+uint8_t lru_remove(lru_cache_pt cache, const void * key){
+    // Comprobación de caché y clave válidos:
+    if ((cache == NULL) || (key == NULL)){
+        return 1;
+    }
+
+    // Búsqueda de la clave en el índice:
+    size_t pos = _lru_index_find(cache, key, _lru_hash(key, cache->key_size));
+    if (pos == cache->index_capacity){
+        return 2;
+    }
+
+    // Eliminación del índice, de la lista y liberación del nodo:
+    dll_node_pt temp_node = cache->index[pos].node;
+    cache->bytes -= cache->index[pos].bytes;
+    _lru_index_erase(cache, pos);
+    _lru_list_unlink(cache, temp_node);
+    _lru_node_deinit(temp_node);
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna el número de entradas de la caché.
+
+    @param lru_cache_pt cache: Referencia a la caché.
+
+    @retval size_t: Número de entradas.
+*/
+size_t lru_get_size(lru_cache_pt cache){
+    // Comprobación de caché válida:
+    if (cache == NULL){
+        return 0;
+    }
+
+    return cache->list.size;
+}
+
+/*
+    @brief Función que retorna los bytes ocupados por las entradas de la caché.
+
+    @param lru_cache_pt cache: Referencia a la caché.
+
+    @retval size_t: Bytes ocupados.
+*/
+size_t lru_get_bytes(lru_cache_pt cache){
+    // Comprobación de caché válida:
+    if (cache == NULL){
+        return 0;
+    }
+
+    return cache->bytes;
+}
+
+/*
+    @brief Función que retorna el número de aciertos de lru_get.
+
+    @param lru_cache_pt cache: Referencia a la caché.
+
+    @retval size_t: Número de aciertos.
+*/
+size_t lru_get_hits(lru_cache_pt cache){
+    // Comprobación de caché válida:
+    if (cache == NULL){
+        return 0;
+    }
+
+    return cache->hits;
+}
+
+/*
+    @brief Función que retorna el número de fallos de lru_get.
+
+    @param lru_cache_pt cache: Referencia a la caché.
+
+    @retval size_t: Número de fallos.
+*/
+size_t lru_get_misses(lru_cache_pt cache){
+    // Comprobación de caché válida:
+    if (cache == NULL){
+        return 0;
+    }
+
+    return cache->misses;
+}
+
+/*
+    @brief Función que reinicia los contadores de aciertos y fallos.
+
+    @param lru_cache_pt cache: Referencia a la caché.
+
+    @retval None.
+*/
+void lru_reset_stats(lru_cache_pt cache){
+    // Comprobación de caché válida:
+    if (cache == NULL){
+        return;
+    }
+
+    cache->hits = 0;
+    cache->misses = 0;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna que calcula el hash (FNV-1a con mezcla final) de una clave.
+
+    @param const void * key: Referencia a la clave.
+    @param size_t key_size: Tamaño (en bytes) de la clave.
+
+    @retval uint64_t: Hash de la clave.
+*/
+static uint64_t _lru_hash(const void * key, size_t key_size){
+    // FNV-1a sobre los bytes de la clave:
+    const uint8_t * bytes = (const uint8_t *)key;
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < key_size; i++){
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+
+    // Mezcla final para repartir los bits bajos (usados como posición en el índice):
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+/*
+    @brief Función interna que busca la ranura del índice que contiene una clave.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param lru_cache_pt cache: Referencia a la caché.
+    @param const void * key: Referencia a la clave.
+    @param uint64_t hash: Hash de la clave.
+
+    @retval size_t: Posición de la ranura (index_capacity si la clave no está en el índice).
+*/
+static size_t _lru_index_find(lru_cache_pt cache, const void * key, uint64_t hash){
+    // Sondeo lineal desde la posición ideal hasta encontrar la clave o una ranura libre:
+    size_t mask = cache->index_capacity - 1;
+    size_t pos = hash & mask;
+    while (cache->index[pos].node != NULL){
+        if ((cache->index[pos].hash == hash) && (memcmp(cache->index[pos].node->data, key, cache->key_size) == 0)){
+            return pos;
+        }
+        pos = (pos + 1) & mask;
+    }
+
+    return cache->index_capacity;
+}
+
+/*
+    @brief Función interna que inserta una referencia a nodo en la primera ranura libre de su secuencia de sondeo.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+    @note: Se supone que la clave no está en el índice y que hay ranuras libres.
+
+    @param lru_slot_pt index: Referencia al índice.
+    @param size_t index_capacity: Capacidad (potencia de 2) del índice.
+    @param uint64_t hash: Hash de la clave.
+    @param dll_node_pt node: Referencia al nodo.
+    @param size_t bytes: Coste (en bytes) de la entrada.
+
+    @retval None.
+*/
+static void _lru_index_insert(lru_slot_pt index, size_t index_capacity, uint64_t hash, dll_node_pt node, size_t bytes){
+    size_t mask = index_capacity - 1;
+    size_t pos = hash & mask;
+    while (index[pos].node != NULL){
+        pos = (pos + 1) & mask;
+    }
+
+    index[pos].hash = hash;
+    index[pos].node = node;
+    index[pos].bytes = bytes;
+}
+
+/*
+    @brief Función interna que vacía una ranura del índice desplazando hacia atrás las entradas siguientes (sin marcas de borrado).
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param lru_cache_pt cache: Referencia a la caché.
+    @param size_t pos: Posición de la ranura a vaciar.
+
+    @retval None.
+*/
+static void _lru_index_erase(lru_cache_pt cache, size_t pos){
+    size_t mask = cache->index_capacity - 1;
+    size_t hole = pos;
+    size_t next = pos;
+    size_t home;
+    while (true){
+        next = (next + 1) & mask;
+        if (cache->index[next].node == NULL){
+            break;
+        }
+
+        // Una entrada puede ocupar el hueco si su posición ideal no está entre el hueco y ella:
+        home = cache->index[next].hash & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask)){
+            cache->index[hole] = cache->index[next];
+            hole = next;
+        }
+    }
+
+    cache->index[hole].node = NULL;
+}
+
+/*
+    @brief Función interna que duplica la capacidad del índice y reubica todas sus entradas.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param lru_cache_pt cache: Referencia a la caché.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Error de reserva de memoria (el índice anterior se conserva).
+*/
+static uint8_t _lru_index_grow(lru_cache_pt cache){
+    // Reserva del nuevo índice:
+    size_t new_capacity = cache->index_capacity * 2;
+    lru_slot_pt new_index = (lru_slot_pt)calloc(new_capacity, sizeof(lru_slot_t));
+    if (new_index == NULL){
+        return 1;
+    }
+
+    // Reubicación de las entradas ocupadas:
+    for (size_t i = 0; i < cache->index_capacity; i++){
+        if (cache->index[i].node != NULL){
+            _lru_index_insert(new_index, new_capacity, cache->index[i].hash, cache->index[i].node, cache->index[i].bytes);
+        }
+    }
+
+    free(cache->index);
+    cache->index = new_index;
+    cache->index_capacity = new_capacity;
+
+    return 0;
+}
+
+/*
+    @brief Función interna para crear un nodo (con la misma disposición que los de dllist) para una entrada.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param lru_cache_pt cache: Referencia a la caché que alojará al nodo.
+
+    @retval dll_node_pt: Referencia al nodo creado (datos a 0's).
+*/
+static dll_node_pt _lru_node_init(lru_cache_pt cache){
+    // Reserva de memoria para el nodo:
+    dll_node_pt node = (dll_node_pt)malloc(sizeof(dll_node_t));
+    if (node == NULL){
+        return NULL;
+    }
+
+    node->data = calloc(1, cache->list.data_size);
+    if (node->data == NULL){
+        free(node);
+        return NULL;
+    }
+
+    node->next = NULL;
+    node->prev = NULL;
+
+    return node;
+}
+
+/*
+    @brief Función interna para eliminar un nodo.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param dll_node_pt node: Referencia al nodo a destruir.
+
+    @retval None.
+*/
+static void _lru_node_deinit(dll_node_pt node){
+    // Liberación completa de memoria del nodo:
+    free(node->data);
+    free(node);
+}
+
+/*
+    @brief Función interna que desenlaza un nodo de la lista de uso en O(1).
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param lru_cache_pt cache: Referencia a la caché.
+    @param dll_node_pt node: Referencia al nodo a desenlazar.
+
+    @retval None.
+*/
+static void _lru_list_unlink(lru_cache_pt cache, dll_node_pt node){
+    if (node->prev != NULL){
+        node->prev->next = node->next;
+    } else {
+        cache->list.head = node->next;
+    }
+
+    if (node->next != NULL){
+        node->next->prev = node->prev;
+    } else {
+        cache->list.tail = node->prev;
+    }
+
+    node->next = NULL;
+    node->prev = NULL;
+    cache->list.size--;
+}
+
+/*
+    @brief Función interna que enlaza un nodo en la cabecera (más reciente) de la lista de uso.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param lru_cache_pt cache: Referencia a la caché.
+    @param dll_node_pt node: Referencia al nodo a enlazar.
+
+    @retval None.
+*/
+static void _lru_list_push_front(lru_cache_pt cache, dll_node_pt node){
+    node->prev = NULL;
+    node->next = cache->list.head;
+
+    if (cache->list.head != NULL){
+        cache->list.head->prev = node;
+    } else {
+        cache->list.tail = node;
+    }
+
+    cache->list.head = node;
+    cache->list.size++;
+}
+
+/*
+    @brief Función interna que desaloja la entrada menos reciente: llama a la función de desalojo y la quita del índice y de la lista.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+    @note: El nodo no se libera para que el llamador pueda reutilizarlo.
+
+    @param lru_cache_pt cache: Referencia a la caché (no vacía).
+
+    @retval dll_node_pt: Referencia al nodo desalojado.
+*/
+static dll_node_pt _lru_detach_tail(lru_cache_pt cache){
+    dll_node_pt temp_node = cache->list.tail;
+
+    // Aviso al usuario antes de perder la entrada:
+    if (cache->evict_fn != NULL){
+        cache->evict_fn(temp_node->data, (uint8_t *)temp_node->data + cache->key_size, cache->evict_ctx);
+    }
+
+    // Eliminación del índice y de la lista:
+    size_t pos = _lru_index_find(cache, temp_node->data, _lru_hash(temp_node->data, cache->key_size));
+    cache->bytes -= cache->index[pos].bytes;
+    _lru_index_erase(cache, pos);
+    _lru_list_unlink(cache, temp_node);
+
+    return temp_node;
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
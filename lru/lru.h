@@ -0,0 +1,87 @@
+#ifndef LRU_HEADER
+#define LRU_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "../llist/dllist.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define LRU_MIN_KEY_SIZE 1          // En bytes.
+#define LRU_MAX_KEY_SIZE 64         // En bytes (clave + valor no pueden superar MAX_DATA_SIZE).
+#define LRU_INDEX_MIN_CAPACITY 16   // En número de ranuras (potencia de 2).
+#define LRU_INDEX_MAX_LOAD 70       // Porcentaje máximo de ocupación del índice antes de crecer.
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos---------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct lru_slot{
+    uint64_t hash;              // Hash de la clave (válido si node != NULL).
+    struct dll_node * node;     // Referencia al nodo de la lista (nulo = ranura libre).
+    size_t bytes;               // Coste (en bytes) de la entrada.
+};
+
+struct lru_cache{
+    dll_linkedlist_t list;      // Lista de uso: cabecera = más reciente, cola = menos reciente. Datos = clave | valor.
+    struct lru_slot * index;    // Índice hash (direccionamiento abierto, sondeo lineal) de clave a nodo.
+    size_t index_capacity;      // Capacidad (en nº de ranuras, potencia de 2) del índice.
+    size_t key_size;            // Tamaño (en bytes) de la clave.
+    size_t value_size;          // Tamaño (en bytes) del valor.
+    size_t max_entries;         // Límite de entradas (0 = sin límite).
+    size_t max_bytes;           // Límite de bytes (0 = sin límite).
+    size_t bytes;               // Bytes ocupados actualmente por las entradas.
+    size_t hits;                // Número de aciertos en lru_get.
+    size_t misses;              // Número de fallos en lru_get.
+    void (*evict_fn)(const void *, void *, void *); // Función llamada al desalojar (clave, valor, contexto).
+    void * evict_ctx;           // Contexto de usuario de la función de desalojo.
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct lru_slot lru_slot_t;
+typedef lru_slot_t * lru_slot_pt;
+
+typedef struct lru_cache lru_cache_t;
+typedef lru_cache_t * lru_cache_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción de la caché:
+lru_cache_pt lru_init(size_t key_size, size_t value_size, size_t max_entries, size_t max_bytes);
+void lru_deinit(lru_cache_pt * cache);
+void lru_clear(lru_cache_pt cache);
+uint8_t lru_set_evict_fn(lru_cache_pt cache, void (*evict_fn)(const void *, void *, void *), void * ctx);
+
+// Inserción y consulta de entradas:
+uint8_t lru_put(lru_cache_pt cache, const void * key, const void * value);
+uint8_t lru_put_weighted(lru_cache_pt cache, const void * key, const void * value, size_t bytes);
+uint8_t lru_get(lru_cache_pt cache, const void * key, void * out_value);
+uint8_t lru_touch(lru_cache_pt cache, const void * key);
+bool lru_contains(lru_cache_pt cache, const void * key);
+
+// Eliminación de entradas:
+uint8_t lru_evict(lru_cache_pt cache);
+uint8_t lru_remove(lru_cache_pt cache, const void * key);
+
+// Utilidades generales:
+size_t lru_get_size(lru_cache_pt cache);
+size_t lru_get_bytes(lru_cache_pt cache);
+size_t lru_get_hits(lru_cache_pt cache);
+size_t lru_get_misses(lru_cache_pt cache);
+void lru_reset_stats(lru_cache_pt cache);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
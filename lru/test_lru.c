@@ -0,0 +1,83 @@
+#include "lru.h"
+#include <stdio.h>
+
+struct test_value{
+    uint32_t id;
+    uint16_t weight;
+};
+
+// Prototipos de funciones:
+void print_evicted(const void * key, void * value, void * ctx);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de una caché limitada a 3 entradas, con función de desalojo:
+    size_t evicted = 0;
+    lru_cache_pt cache = lru_init(sizeof(uint32_t), sizeof(struct test_value), 3, 0);
+    lru_set_evict_fn(cache, print_evicted, &evicted);
+    printf("\nSe ha creado la caché correctamente en la dirección (%p)\n", (void *)cache);
+
+    // Inserción de entradas (la cuarta desaloja la menos reciente):
+    for (uint32_t key = 1; key <= 3; key++){
+        struct test_value value = {.id = key * 100, .weight = (uint16_t)key};
+        lru_put(cache, &key, &value);
+    }
+
+    uint32_t key = 1;
+    lru_touch(cache, &key);
+    key = 4;
+    struct test_value value = {.id = 400, .weight = 4};
+    lru_put(cache, &key, &value);
+
+    // Consultas (aciertos y fallos):
+    struct test_value out_value;
+    for (key = 1; key <= 4; key++){
+        if (lru_get(cache, &key, &out_value) == 0){
+            printf("Clave %u: id=%u weight=%u\n", key, out_value.id, out_value.weight);
+        } else {
+            printf("Clave %u: no está en la caché\n", key);
+        }
+    }
+
+    // Datos de la caché:
+    printf("\nEntradas: %ld, bytes: %ld\n", lru_get_size(cache), lru_get_bytes(cache));
+    printf("Aciertos: %ld, fallos: %ld, desalojos: %ld\n", lru_get_hits(cache), lru_get_misses(cache), evicted);
+
+    // Eliminación de una entrada y desalojo explícito de la menos reciente:
+    key = 3;
+    lru_remove(cache, &key);
+    lru_evict(cache);
+    printf("\nEntradas tras eliminar la clave 3 y desalojar una: %ld (contiene la 4: %d)\n", lru_get_size(cache), lru_contains(cache, &(uint32_t){4}));
+
+    // Destrucción de la caché:
+    lru_deinit(&cache);
+
+    // Caché limitada en bytes con entradas de coste variable:
+    cache = lru_init(sizeof(uint32_t), sizeof(struct test_value), 0, 1000);
+    lru_set_evict_fn(cache, print_evicted, &evicted);
+    for (key = 1; key <= 5; key++){
+        value.id = key;
+        lru_put_weighted(cache, &key, &value, key * 100);
+    }
+    printf("\nCaché limitada a 1000 bytes: %ld entradas, %ld bytes\n", lru_get_size(cache), lru_get_bytes(cache));
+    lru_deinit(&cache);
+
+    printf("\nDirección de la caché tras la eliminación: (%p)\n", (void *)cache);
+
+    return 0;
+}
+
+/*
+    @brief Función de desalojo que imprime la clave desalojada y cuenta los desalojos en el contexto.
+
+    @param const void * key: Referencia a la clave (uint32_t).
+    @param void * value: Referencia al valor (struct test_value).
+    @param void * ctx: Referencia al contador de desalojos (size_t).
+
+    @retval None.
+*/
+void print_evicted(const void * key, void * value, void * ctx){
+    printf("Desalojada la clave %u (id=%u)\n", *(const uint32_t *)key, ((struct test_value *)value)->id);
+    (*(size_t *)ctx)++;
+}
\ No newline at end of file
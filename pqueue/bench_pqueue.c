@@ -0,0 +1,129 @@
+#include "pqueue.h"
+#include "../llist/dllist.h"
+#include <stdio.h>
+#include <time.h>
+
+// Prototipos de funciones:
+double elapsed_ms(struct timespec start, struct timespec end);
+int cmp_u32_ctx(const void * a, const void * b, void * ctx);
+bool is_after(const void * target, const void * data, void * ctx);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Número de elementos (por argumento o por defecto):
+    size_t n = (argc > 1) ? strtoul(argv[1], NULL, 10) : 20000;
+    uint32_t * keys = (uint32_t *)malloc(n * sizeof(uint32_t));
+    if (keys == NULL){
+        return 1;
+    }
+
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < n; i++){
+        seed = seed * 1103515245 + 12345;
+        keys[i] = seed >> 8;
+    }
+
+    printf("\nElementos: %ld\n", n);
+    printf("%-16s %14s %14s %14s\n", "", "push(ms)", "pop(ms)", "Mops/s");
+
+    // Montículos de aridad 2, 4 y 8 (push uno a uno y pop de todos):
+    struct timespec start, mid, end;
+    uint64_t check = 0;
+    uint8_t arities[] = {2, 4, 8};
+    for (size_t a = 0; a < 3; a++){
+        pqueue_pt pqueue = pqueue_init(sizeof(uint32_t), arities[a], cmp_u32_ctx, NULL, false);
+        uint32_t value;
+        uint64_t sum = 0;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (size_t i = 0; i < n; i++){
+            pqueue_push(pqueue, &keys[i], NULL);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &mid);
+        while (pqueue_pop(pqueue, &value) == 0){
+            sum = (sum * 31) + value;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        check = sum;
+        char name[32];
+        snprintf(name, sizeof(name), "pqueue d=%u", arities[a]);
+        printf("%-16s %14.3f %14.3f %14.2f\n", name, elapsed_ms(start, mid), elapsed_ms(mid, end), (2.0 * n) / (elapsed_ms(start, end) * 1e3));
+        pqueue_deinit(&pqueue);
+    }
+
+    // Carga en bloque (heapify de Floyd) con aridad 4:
+    pqueue_pt pqueue = pqueue_init(sizeof(uint32_t), 4, cmp_u32_ctx, NULL, false);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pqueue_push_n(pqueue, keys, n, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("%-16s %14.3f %14s %14.2f\n", "push_n d=4", elapsed_ms(start, end), "-", n / (elapsed_ms(start, end) * 1e3));
+    pqueue_deinit(&pqueue);
+
+    // Lista doblemente enlazada ordenada (inserción buscando la posición, extracción por la cabeza):
+    dll_linkedlist_pt list = dllist_init(sizeof(uint32_t));
+    uint64_t sum = 0;
+    size_t index;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < n; i++){
+        if (dllist_find_index(list, &keys[i], is_after, NULL, &index) == 0){
+            dllist_insert_at(list, &keys[i], index);
+        } else {
+            dllist_push_back(list, &keys[i]);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &mid);
+    while (!dllist_is_empty(list)){
+        sum = (sum * 31) + *(uint32_t *)list->head->data;
+        dllist_pop_front(list);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("%-16s %14.3f %14.3f %14.2f\n", "dllist ordenada", elapsed_ms(start, mid), elapsed_ms(mid, end), (2.0 * n) / (elapsed_ms(start, end) * 1e3));
+    printf("\nComprobación de orden de salida: %s\n", (sum == check) ? "correcta" : "INCORRECTA");
+    dllist_deinit(&list);
+
+    free(keys);
+
+    return 0;
+}
+
+/*
+    @brief Función que calcula el tiempo transcurrido entre dos marcas de tiempo.
+
+    @param struct timespec start: Marca de inicio.
+    @param struct timespec end: Marca de fin.
+
+    @retval double: Tiempo transcurrido en milisegundos.
+*/
+double elapsed_ms(struct timespec start, struct timespec end){
+    return (double)(end.tv_sec - start.tv_sec) * 1e3 + (double)(end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+/*
+    @brief Función de comparación de uint32_t con contexto (menor valor sale antes).
+
+    @param const void * a: Referencia al primer valor.
+    @param const void * b: Referencia al segundo valor.
+    @param void * ctx: Contexto de usuario (no usado).
+
+    @retval int: <0, 0 o >0 si a es menor, igual o mayor que b.
+*/
+int cmp_u32_ctx(const void * a, const void * b, void * ctx){
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+    @brief Función que indica si un dato de la lista va después del objetivo (posición de inserción ordenada y estable).
+
+    @param const void * target: Referencia al valor a insertar.
+    @param const void * data: Referencia al dato de la lista.
+    @param void * ctx: Contexto de usuario (no usado).
+
+    @retval bool: true si el dato es mayor que el objetivo.
+*/
+bool is_after(const void * target, const void * data, void * ctx){
+    return *(const uint32_t *)data > *(const uint32_t *)target;
+}
\ No newline at end of file
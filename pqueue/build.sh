@@ -0,0 +1,82 @@
+#!/bin/bash
+
+
+# Variables de entorno             #
+# -------------------------------- #
+CC=gcc
+CFLAGS_TEST="-g -Wall -O2"
+CFLAGS_LIB="-Wall -O2 -fPIC -shared"
+CFLAGS_BENCH="-Wall -O2 -march=native"
+
+SRC_PQUEUE="pqueue.c ../array/array.c"
+SRC_TEST=test_pqueue.c
+SRC_BENCH="bench_pqueue.c ../llist/dllist.c"
+
+TEST_PROG=test_pqueue.elf
+BENCH_PROG=bench_pqueue.elf
+LIB_PROG=pqueue.so
+# -------------------------------- #
+
+
+# Lógica de uso                    #
+# -------------------------------- #
+if [ "$1" == "test" ]; then
+    echo
+    echo "[BUILD-PQUEUE-TEST]: Compilando programa de prueba de pqueue..."
+    if $CC $CFLAGS_TEST $SRC_TEST $SRC_PQUEUE -o $TEST_PROG; then
+        echo "[BUILD-PQUEUE-TEST]: Compilación completada."
+        echo "[BUILD-PQUEUE-TEST]: Ejecutando programa de prueba..."
+        echo
+        ./$TEST_PROG
+        echo
+        echo "[BUILD-PQUEUE-TEST]: Ejecución de programa de prueba finalizado."
+    else
+        echo "[BUILD-PQUEUE-TEST][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$1" == "bench" ]; then
+    echo
+    echo "[BUILD-PQUEUE-BENCH]: Compilando benchmark de pqueue..."
+    if $CC $CFLAGS_BENCH $SRC_BENCH $SRC_PQUEUE -o $BENCH_PROG; then
+        echo "[BUILD-PQUEUE-BENCH]: Compilación completada."
+        echo "[BUILD-PQUEUE-BENCH]: Ejecutando benchmark..."
+        echo
+        ./$BENCH_PROG "${@:2}"
+        echo
+        echo "[BUILD-PQUEUE-BENCH]: Ejecución de benchmark finalizada."
+    else
+        echo "[BUILD-PQUEUE-BENCH][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$1" == "lib" ]; then
+    echo
+    echo "[BUILD-PQUEUE-LIB]: Compilando la librería de pqueue..."
+    if $CC $CFLAGS_LIB $SRC_PQUEUE -o $LIB_PROG; then
+        mv $LIB_PROG ./lib
+        echo "[BUILD-PQUEUE-LIB]: Librearía compilada."
+    else
+        echo "[BUILD-PQUEUE-LIB][ERR]: Error de compilación, librería no generada."
+    fi
+    echo
+
+elif [ "$1" == "clean" ]; then
+    echo
+    echo "[BUILD-PQUEUE-CLEAN]: Limpiando espacio de trabajo..."
+    rm -f ./$TEST_PROG ./$BENCH_PROG ./lib/$LIB_PROG
+    echo "[BUILD-PQUEUE-CLEAN]: Espacio de trabajo limpio."
+    echo
+
+else
+    echo
+    echo "[BUILD-PQUEUE][ERR]: Uso incorrecto u opciones inválidas."
+    echo -e "\n\t[Uso]:"
+    echo -e "\t\t-> ./build.sh test: \tCompila y ejecuta el programa de test (.elf)"
+    echo -e "\t\t-> ./build.sh bench [n]: \tCompila y ejecuta el benchmark frente a una dllist ordenada (.elf)"
+    echo -e "\t\t-> ./build.sh lib: \tCompila y genera la librería compartida (.so) bajo la carpeta lib/"
+    echo -e "\t\t-> ./build.sh clean: \tLimpia el espacio de trabajo eliminando archivos generados"
+    echo
+    exit 1
+fi
+# -------------------------------- #
\ No newline at end of file
@@ -0,0 +1,731 @@
+#include "pqueue.h"
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static inline uint8_t * _pqueue_at(const pqueue_pt pqueue, size_t index);
+static inline void _pqueue_place(pqueue_pt pqueue, size_t index, const void * element, size_t handle);
+static inline void _pqueue_move(pqueue_pt pqueue, size_t dst, size_t src);
+static void _pqueue_sift_up(pqueue_pt pqueue, size_t index, const void * element, size_t handle);
+static void _pqueue_sift_down(pqueue_pt pqueue, size_t index, const void * element, size_t handle);
+static uint8_t _pqueue_reserve(pqueue_pt pqueue, size_t extra);
+static size_t _pqueue_new_handle(pqueue_pt pqueue);
+static void _pqueue_free_handle(pqueue_pt pqueue, size_t handle);
+static void _pqueue_remove_at(pqueue_pt pqueue, size_t index);
+static pqueue_slot_pt _pqueue_slot(const pqueue_pt pqueue, size_t handle);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar una cola de prioridad (montículo d-ario) sobre un array contiguo.
+    @note: En modo indexado cada elemento insertado recibe un manejador estable que permite modificar su prioridad o eliminarlo.
+           El manejador lleva la generación de su ranura (generación << 32 | ranura): uno antiguo nunca se confunde con el
+           de otro elemento que reutilice la ranura.
+
+    @param size_t element_size: Tamaño (en bytes) del elemento.
+    @param uint8_t arity: Número de hijos por nodo: 2, 4 u 8 (0 = PQUEUE_DEFAULT_ARITY).
+    @param int (*cmp_fn)(const void *, const void *, void *): Referencia a la función comparadora (a, b, contexto); <0 si a debe salir antes que b.
+    @param void * ctx: Referencia al contexto de usuario que se pasa a la función comparadora (puede ser nulo).
+    @param bool indexed: Indica si se activa el modo indexado (manejadores, decrease_key, update y remove).
+
+    @retval pqueue_pt: Referencia a la cola creada.
+*/
+pqueue_pt pqueue_init(size_t element_size, uint8_t arity, int (*cmp_fn)(const void *, const void *, void *), void * ctx, bool indexed){
+    // Comprobación de aridad y función comparadora válidas:
+    if (arity == 0){
+        arity = PQUEUE_DEFAULT_ARITY;
+    }
+
+    if (((arity != 2) && (arity != 4) && (arity != 8)) || (cmp_fn == NULL)){
+        return NULL;
+    }
+
+    // Reserva de memoria para la estructura básica de la cola:
+    pqueue_pt pqueue = (pqueue_pt)malloc(sizeof(pqueue_t));
+    if (pqueue == NULL){
+        return NULL;
+    }
+
+    // Creación del montículo (comprueba los límites del tamaño del elemento) y de los arrays del modo indexado:
+    pqueue->heap = array_init(element_size);
+    pqueue->heap_handles = NULL;
+    pqueue->slots = NULL;
+    if (pqueue->heap == NULL){
+        free(pqueue);
+        return NULL;
+    }
+
+    if (indexed){
+        pqueue->heap_handles = array_init(sizeof(size_t));
+        pqueue->slots = array_init(sizeof(pqueue_slot_t));
+        if ((pqueue->heap_handles == NULL) || (pqueue->slots == NULL)){
+            array_deinit(pqueue->heap);
+            array_deinit(pqueue->heap_handles);
+            array_deinit(pqueue->slots);
+            free(pqueue);
+            return NULL;
+        }
+    }
+
+    // Inicio de los miembros de la estructura:
+    pqueue->free_head = PQUEUE_NO_SLOT;
+    pqueue->free_count = 0;
+    pqueue->arity_shift = (arity == 2) ? 1 : ((arity == 4) ? 2 : 3);
+    pqueue->cmp_fn = cmp_fn;
+    pqueue->ctx = ctx;
+
+    return pqueue;
+}
+
+/*
+    @brief Función para destruir y liberar una cola de prioridad.
+
+    @param pqueue_pt * pqueue: Referencia a la referencia de la cola.
+
+    @retval None.
+*/
+void pqueue_deinit(pqueue_pt * pqueue){
+    // Comprobación de que la cola no sea nula:
+    if ((pqueue == NULL) || (*pqueue == NULL)){
+        return;
+    }
+
+    // Liberación de los arrays y de la estructura:
+    array_deinit((*pqueue)->heap);
+    array_deinit((*pqueue)->heap_handles);
+    array_deinit((*pqueue)->slots);
+    free(*pqueue);
+    *pqueue = NULL;
+}
+
+/*
+    @brief Función para eliminar todos los elementos de la cola, conservando la capacidad reservada.
+    @note: En modo indexado las ranuras de todos los elementos cambian de generación: sus manejadores dejan de ser válidos.
+
+    @param pqueue_pt pqueue: Referencia a la cola.
+
+    @retval None.
+*/
+void pqueue_clear(pqueue_pt pqueue){
+    // Comprobación de cola válida:
+    if (pqueue == NULL){
+        return;
+    }
+
+    // Liberación de los manejadores y vaciado de los arrays:
+    if (pqueue->slots != NULL){
+        for (size_t i = 0; i < array_size(pqueue->heap_handles); i++){
+            _pqueue_free_handle(pqueue, *(size_t *)array_at(pqueue->heap_handles, i));
+        }
+        array_clear(pqueue->heap_handles);
+    }
+    array_clear(pqueue->heap);
+}
+
+/*
+    @brief Función para insertar un elemento en la cola (O(log_d n)).
+
+    @param pqueue_pt pqueue: Referencia a la cola.
+    @param const void * element: Referencia al elemento.
+    @param size_t * out_handle: Referencia donde se guarda el manejador asignado (puede ser nulo; PQUEUE_NO_HANDLE en modo no indexado).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o elemento no válidos.
+                -> 2: Error al ajustar el tamaño de la cola.
+                -> 3: Se ha alcanzado el número máximo de manejadores (modo indexado).
+*/
+uint8_t pqueue_push(pqueue_pt pqueue, const void * element, size_t * out_handle){
+    // Comprobación de cola y elemento válidos:
+    if ((pqueue == NULL) || (element == NULL)){
+        return 1;
+    }
+
+    // Reserva de espacio (crecimiento geométrico):
+    uint8_t status = _pqueue_reserve(pqueue, 1);
+    if (status != 0){
+        return status;
+    }
+
+    // Inserción al final del montículo y flotación hasta su posición:
+    size_t handle = (pqueue->slots != NULL) ? _pqueue_new_handle(pqueue) : PQUEUE_NO_HANDLE;
+    size_t index = array_size(pqueue->heap);
+    array_set(pqueue->heap, element, index);
+    if (pqueue->slots != NULL){
+        array_set(pqueue->heap_handles, &handle, index);
+    }
+    _pqueue_sift_up(pqueue, index, element, handle);
+
+    if (out_handle != NULL){
+        *out_handle = handle;
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función para insertar n elementos contiguos en la cola.
+    @note: Si n es mayor o igual que el número de elementos ya presentes, se reconstruye el montículo completo en O(n) (heapify de Floyd); si no, se insertan uno a uno.
+
+    @param pqueue_pt pqueue: Referencia a la cola.
+    @param const void * elements: Referencia a los n elementos, contiguos y de element_size bytes cada uno.
+    @param size_t n: Número de elementos.
+    @param size_t * out_handles: Referencia al array de n manejadores asignados (puede ser nulo; PQUEUE_NO_HANDLE en modo no indexado).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o elementos no válidos.
+                -> 2: Error al ajustar el tamaño de la cola.
+                -> 3: Se ha alcanzado el número máximo de manejadores (modo indexado).
+*/
+uint8_t pqueue_push_n(pqueue_pt pqueue, const void * elements, size_t n, size_t * out_handles){
+    // Comprobación de cola y elementos válidos:
+    if ((pqueue == NULL) || ((elements == NULL) && (n > 0))){
+        return 1;
+    }
+
+    // Reserva de espacio para todos los elementos:
+    uint8_t status = _pqueue_reserve(pqueue, n);
+    if (status != 0){
+        return status;
+    }
+
+    size_t element_size = array_element_size(pqueue->heap);
+    size_t old_size = array_size(pqueue->heap);
+
+    // Pocos elementos frente a los existentes: inserción uno a uno:
+    if (n < old_size){
+        for (size_t i = 0; i < n; i++){
+            pqueue_push(pqueue, (const uint8_t *)elements + (i * element_size), (out_handles != NULL) ? &out_handles[i] : NULL);
+        }
+        return 0;
+    }
+
+    // Copia de los elementos al final del montículo, con sus manejadores:
+    for (size_t i = 0; i < n; i++){
+        size_t index = old_size + i;
+        size_t handle = PQUEUE_NO_HANDLE;
+        array_set(pqueue->heap, (const uint8_t *)elements + (i * element_size), index);
+        if (pqueue->slots != NULL){
+            handle = _pqueue_new_handle(pqueue);
+            array_set(pqueue->heap_handles, &handle, index);
+            _pqueue_slot(pqueue, handle)->index = index;
+        }
+        if (out_handles != NULL){
+            out_handles[i] = handle;
+        }
+    }
+
+    // Reconstrucción del montículo desde el último nodo con hijos hasta la raíz:
+    size_t size = array_size(pqueue->heap);
+    if (size > 1){
+        uint8_t element[MAX_ELEMENT_SIZE];
+        size_t i = (size - 2) >> pqueue->arity_shift;
+        while (true){
+            memcpy(element, _pqueue_at(pqueue, i), element_size);
+            _pqueue_sift_down(pqueue, i, element, (pqueue->slots != NULL) ? *(size_t *)array_at(pqueue->heap_handles, i) : PQUEUE_NO_HANDLE);
+            if (i == 0){
+                break;
+            }
+            i--;
+        }
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función para extraer el elemento prioritario de la cola (O(d log_d n)).
+
+    @param pqueue_pt pqueue: Referencia a la cola.
+    @param void * out_element: Referencia a la variable donde se copiará el elemento (puede ser nulo).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola no válida.
+                -> 2: La cola está vacía.
+*/
+uint8_t pqueue_pop(pqueue_pt pqueue, void * out_element){
+    // Comprobación de cola válida y no vacía:
+    if (pqueue == NULL){
+        return 1;
+    }
+
+    if (array_size(pqueue->heap) == 0){
+        return 2;
+    }
+
+    // Copia del elemento raíz y sustitución por el último:
+    if (out_element != NULL){
+        array_get(pqueue->heap, 0, out_element);
+    }
+    _pqueue_remove_at(pqueue, 0);
+
+    return 0;
+}
+
+/*
+    @brief Función para consultar el elemento prioritario de la cola sin extraerlo.
+
+    @param const pqueue_pt pqueue: Referencia a la cola.
+    @param void * out_element: Referencia a la variable donde se copiará el elemento (puede ser nulo).
+    @param size_t * out_handle: Referencia donde se guarda su manejador (puede ser nulo; PQUEUE_NO_HANDLE en modo no indexado).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola no válida.
+                -> 2: La cola está vacía.
+*/
+uint8_t pqueue_peek(const pqueue_pt pqueue, void * out_element, size_t * out_handle){
+    // Comprobación de cola válida y no vacía:
+    if (pqueue == NULL){
+        return 1;
+    }
+
+    if (array_size(pqueue->heap) == 0){
+        return 2;
+    }
+
+    // Copia del elemento raíz y de su manejador:
+    if (out_element != NULL){
+        array_get(pqueue->heap, 0, out_element);
+    }
+    if (out_handle != NULL){
+        *out_handle = (pqueue->slots != NULL) ? *(size_t *)array_at(pqueue->heap_handles, 0) : PQUEUE_NO_HANDLE;
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función para aumentar la prioridad de un elemento (sustituyéndolo por uno que sale antes o a la vez).
+
+    @param pqueue_pt pqueue: Referencia a la cola (modo indexado).
+    @param size_t handle: Manejador del elemento.
+    @param const void * element: Referencia al nuevo elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o elemento no válidos, o cola no indexada.
+                -> 2: El manejador no corresponde a ningún elemento de la cola.
+                -> 3: El nuevo elemento tiene menos prioridad que el actual (usar pqueue_update).
+*/
+uint8_t pqueue_decrease_key(pqueue_pt pqueue, size_t handle, const void * element){
+    // Comprobación de cola indexada y elemento válidos:
+    if ((pqueue == NULL) || (element == NULL) || (pqueue->slots == NULL)){
+        return 1;
+    }
+
+    pqueue_slot_pt slot = _pqueue_slot(pqueue, handle);
+    if (slot == NULL){
+        return 2;
+    }
+
+    // Comprobación de que la prioridad no empeora y flotación:
+    size_t index = slot->index;
+    if (pqueue->cmp_fn(element, _pqueue_at(pqueue, index), pqueue->ctx) > 0){
+        return 3;
+    }
+
+    _pqueue_sift_up(pqueue, index, element, handle);
+
+    return 0;
+}
+
+/*
+    @brief Función para sustituir un elemento por otro de cualquier prioridad, recolocándolo en el montículo.
+
+    @param pqueue_pt pqueue: Referencia a la cola (modo indexado).
+    @param size_t handle: Manejador del elemento.
+    @param const void * element: Referencia al nuevo elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o elemento no válidos, o cola no indexada.
+                -> 2: El manejador no corresponde a ningún elemento de la cola.
+*/
+uint8_t pqueue_update(pqueue_pt pqueue, size_t handle, const void * element){
+    // Comprobación de cola indexada y elemento válidos:
+    if ((pqueue == NULL) || (element == NULL) || (pqueue->slots == NULL)){
+        return 1;
+    }
+
+    pqueue_slot_pt slot = _pqueue_slot(pqueue, handle);
+    if (slot == NULL){
+        return 2;
+    }
+
+    // Flotación o hundimiento según la prioridad respecto a la actual:
+    size_t index = slot->index;
+    if (pqueue->cmp_fn(element, _pqueue_at(pqueue, index), pqueue->ctx) < 0){
+        _pqueue_sift_up(pqueue, index, element, handle);
+    } else {
+        _pqueue_sift_down(pqueue, index, element, handle);
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función para eliminar de la cola un elemento cualquiera a partir de su manejador.
+
+    @param pqueue_pt pqueue: Referencia a la cola (modo indexado).
+    @param size_t handle: Manejador del elemento.
+    @param void * out_element: Referencia a la variable donde se copiará el elemento (puede ser nulo).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola no válida o no indexada.
+                -> 2: El manejador no corresponde a ningún elemento de la cola.
+*/
+uint8_t pqueue_remove(pqueue_pt pqueue, size_t handle, void * out_element){
+    // Comprobación de cola indexada válida:
+    if ((pqueue == NULL) || (pqueue->slots == NULL)){
+        return 1;
+    }
+
+    pqueue_slot_pt slot = _pqueue_slot(pqueue, handle);
+    if (slot == NULL){
+        return 2;
+    }
+
+    // Copia y eliminación del elemento:
+    size_t index = slot->index;
+    if (out_element != NULL){
+        array_get(pqueue->heap, index, out_element);
+    }
+    _pqueue_remove_at(pqueue, index);
+
+    return 0;
+}
+
+/*
+    @brief Función que indica si un manejador corresponde a un elemento presente en la cola.
+
+    @param const pqueue_pt pqueue: Referencia a la cola (modo indexado).
+    @param size_t handle: Manejador del elemento.
+
+    @retval bool: true si el elemento está en la cola, false en caso contrario o si la cola no es indexada.
+*/
+bool pqueue_contains(const pqueue_pt pqueue, size_t handle){
+    // Comprobación de cola indexada válida:
+    if ((pqueue == NULL) || (pqueue->slots == NULL)){
+        return false;
+    }
+
+    return _pqueue_slot(pqueue, handle) != NULL;
+}
+
+/*
+    @brief Función que indica si la cola está vacía.
+
+    @param const pqueue_pt pqueue: Referencia a la cola.
+
+    @retval bool: true si está vacía (o no es válida), false en caso contrario.
+*/
+bool pqueue_is_empty(const pqueue_pt pqueue){
+    // Comprobación de cola válida:
+    if (pqueue == NULL){
+        return true;
+    }
+
+    return array_size(pqueue->heap) == 0;
+}
+
+/*
+    @brief Función que retorna el número de elementos de la cola.
+
+    @param const pqueue_pt pqueue: Referencia a la cola.
+
+    @retval size_t: Número de elementos.
+*/
+size_t pqueue_size(const pqueue_pt pqueue){
+    // Comprobación de cola válida:
+    if (pqueue == NULL){
+        return 0;
+    }
+
+    return array_size(pqueue->heap);
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna que retorna la referencia al elemento de una posición del montículo.
+
+    @param const pqueue_pt pqueue: Referencia a la cola.
+    @param size_t index: Posición en el montículo.
+
+    @retval uint8_t *: Referencia al elemento.
+*/
+static inline uint8_t * _pqueue_at(const pqueue_pt pqueue, size_t index){
+    return (uint8_t *)array_at(pqueue->heap, index);
+}
+
+/*
+    @brief Función interna que coloca un elemento (y su manejador) en una posición del montículo.
+
+    @param pqueue_pt pqueue: Referencia a la cola.
+    @param size_t index: Posición en el montículo.
+    @param const void * element: Referencia al elemento.
+    @param size_t handle: Manejador del elemento (ignorado en modo no indexado).
+
+    @retval None.
+*/
+static inline void _pqueue_place(pqueue_pt pqueue, size_t index, const void * element, size_t handle){
+    array_set(pqueue->heap, element, index);
+    if (pqueue->slots != NULL){
+        array_set(pqueue->heap_handles, &handle, index);
+        ((pqueue_slot_pt)array_at(pqueue->slots, (uint32_t)handle))->index = index;
+    }
+}
+
+/*
+    @brief Función interna que mueve un elemento (y su manejador) entre dos posiciones del montículo.
+
+    @param pqueue_pt pqueue: Referencia a la cola.
+    @param size_t dst: Posición de destino.
+    @param size_t src: Posición de origen.
+
+    @retval None.
+*/
+static inline void _pqueue_move(pqueue_pt pqueue, size_t dst, size_t src){
+    array_set(pqueue->heap, _pqueue_at(pqueue, src), dst);
+    if (pqueue->slots != NULL){
+        size_t handle = *(size_t *)array_at(pqueue->heap_handles, src);
+        array_set(pqueue->heap_handles, &handle, dst);
+        ((pqueue_slot_pt)array_at(pqueue->slots, (uint32_t)handle))->index = dst;
+    }
+}
+
+/*
+    @brief Función interna que hace flotar un elemento desde una posición libre (hueco) hacia la raíz.
+    @note: Los padres con menos prioridad se desplazan al hueco y el elemento se copia una sola vez al final.
+
+    @param pqueue_pt pqueue: Referencia a la cola.
+    @param size_t index: Posición inicial del hueco.
+    @param const void * element: Referencia al elemento (fuera del montículo o en la propia posición index).
+    @param size_t handle: Manejador del elemento.
+
+    @retval None.
+*/
+static void _pqueue_sift_up(pqueue_pt pqueue, size_t index, const void * element, size_t handle){
+    uint8_t temp_element[MAX_ELEMENT_SIZE];
+    memcpy(temp_element, element, array_element_size(pqueue->heap));
+
+    while (index > 0){
+        size_t parent = (index - 1) >> pqueue->arity_shift;
+        if (pqueue->cmp_fn(temp_element, _pqueue_at(pqueue, parent), pqueue->ctx) >= 0){
+            break;
+        }
+        _pqueue_move(pqueue, index, parent);
+        index = parent;
+    }
+
+    _pqueue_place(pqueue, index, temp_element, handle);
+}
+
+/*
+    @brief Función interna que hunde un elemento desde una posición libre (hueco) hacia las hojas.
+    @note: En cada nivel se elige el hijo prioritario entre los d hijos, contiguos en memoria.
+
+    @param pqueue_pt pqueue: Referencia a la cola.
+    @param size_t index: Posición inicial del hueco.
+    @param const void * element: Referencia al elemento (fuera del montículo o en la propia posición index).
+    @param size_t handle: Manejador del elemento.
+
+    @retval None.
+*/
+static void _pqueue_sift_down(pqueue_pt pqueue, size_t index, const void * element, size_t handle){
+    uint8_t temp_element[MAX_ELEMENT_SIZE];
+    memcpy(temp_element, element, array_element_size(pqueue->heap));
+
+    size_t size = array_size(pqueue->heap);
+    size_t arity = (size_t)1 << pqueue->arity_shift;
+    while (true){
+        size_t first = (index << pqueue->arity_shift) + 1;
+        if (first >= size){
+            break;
+        }
+
+        size_t last = (size - first > arity) ? first + arity : size;
+        size_t best = first;
+        for (size_t child = first + 1; child < last; child++){
+            if (pqueue->cmp_fn(_pqueue_at(pqueue, child), _pqueue_at(pqueue, best), pqueue->ctx) < 0){
+                best = child;
+            }
+        }
+
+        if (pqueue->cmp_fn(_pqueue_at(pqueue, best), temp_element, pqueue->ctx) >= 0){
+            break;
+        }
+        _pqueue_move(pqueue, index, best);
+        index = best;
+    }
+
+    _pqueue_place(pqueue, index, temp_element, handle);
+}
+
+/*
+    @brief Función interna que reserva espacio para extra elementos más, duplicando la capacidad si es necesario.
+    @note: En modo indexado también reserva los manejadores, de modo que extraer o eliminar nunca requiere memoria.
+
+    @param pqueue_pt pqueue: Referencia a la cola.
+    @param size_t extra: Número de elementos que se van a añadir.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 2: Error al ajustar el tamaño de algún array.
+                -> 3: No quedan ranuras para los manejadores nuevos.
+*/
+static uint8_t _pqueue_reserve(pqueue_pt pqueue, size_t extra){
+    // Comprobación del número de ranuras (las libres se reutilizan primero):
+    size_t new_slots = 0;
+    if (pqueue->slots != NULL){
+        new_slots = (extra > pqueue->free_count) ? extra - pqueue->free_count : 0;
+        if (new_slots > PQUEUE_MAX_SLOTS - array_size(pqueue->slots)){
+            return 3;
+        }
+    }
+
+    // Reserva del montículo (y de los manejadores por posición):
+    size_t needed = array_size(pqueue->heap) + extra;
+    size_t capacity = array_capacity(pqueue->heap);
+    if (needed > capacity){
+        capacity = (needed > (capacity * 2)) ? needed : capacity * 2;
+        if (array_reserve(pqueue->heap, capacity) != 0){
+            return 2;
+        }
+        if ((pqueue->slots != NULL) && (array_reserve(pqueue->heap_handles, capacity) != 0)){
+            return 2;
+        }
+    }
+
+    // Reserva de las ranuras nuevas:
+    if (new_slots > 0){
+        needed = array_size(pqueue->slots) + new_slots;
+        capacity = array_capacity(pqueue->slots);
+        if ((needed > capacity) && (array_reserve(pqueue->slots, (needed > (capacity * 2)) ? needed : capacity * 2) != 0)){
+            return 2;
+        }
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función interna que asigna un manejador (reutilizando una ranura libre si la hay) y ocupa su ranura.
+    @note: Se supone reservada la capacidad (_pqueue_reserve). La posición de la ranura la fija quien coloca el elemento.
+
+    @param pqueue_pt pqueue: Referencia a la cola (modo indexado).
+
+    @retval size_t: Manejador asignado (generación << 32 | ranura).
+*/
+static size_t _pqueue_new_handle(pqueue_pt pqueue){
+    // Obtención de una ranura (libre o nueva):
+    uint32_t slot_index;
+    if (pqueue->free_head != PQUEUE_NO_SLOT){
+        slot_index = pqueue->free_head;
+        pqueue->free_head = (uint32_t)((pqueue_slot_pt)array_at(pqueue->slots, slot_index))->index;
+        pqueue->free_count--;
+    } else {
+        slot_index = (uint32_t)array_size(pqueue->slots);
+        pqueue_slot_t new_slot = {.index = 0, .generation = 0};
+        array_set(pqueue->slots, &new_slot, slot_index);
+    }
+
+    // Ocupación de la ranura (generación impar):
+    pqueue_slot_pt slot = (pqueue_slot_pt)array_at(pqueue->slots, slot_index);
+    slot->generation++;
+
+    return ((size_t)slot->generation << 32) | slot_index;
+}
+
+/*
+    @brief Función interna que libera la ranura de un manejador, invalidándolo.
+    @note: Una ranura cuya generación da la vuelta se retira para no repetir manejadores.
+
+    @param pqueue_pt pqueue: Referencia a la cola (modo indexado).
+    @param size_t handle: Manejador (válido) del elemento.
+
+    @retval None.
+*/
+static void _pqueue_free_handle(pqueue_pt pqueue, size_t handle){
+    uint32_t slot_index = (uint32_t)handle;
+    pqueue_slot_pt slot = (pqueue_slot_pt)array_at(pqueue->slots, slot_index);
+    slot->generation++;
+    if (slot->generation != 0){
+        slot->index = pqueue->free_head;
+        pqueue->free_head = slot_index;
+        pqueue->free_count++;
+    }
+}
+
+/*
+    @brief Función interna que elimina el elemento de una posición del montículo, rellenando el hueco con el último.
+
+    @param pqueue_pt pqueue: Referencia a la cola.
+    @param size_t index: Posición del elemento a eliminar.
+
+    @retval None.
+*/
+static void _pqueue_remove_at(pqueue_pt pqueue, size_t index){
+    // Liberación del manejador del elemento eliminado:
+    if (pqueue->slots != NULL){
+        _pqueue_free_handle(pqueue, *(size_t *)array_at(pqueue->heap_handles, index));
+    }
+
+    // Retirada del último elemento (sin desplazamientos) y recolocación en el hueco (flotando o hundiéndose):
+    size_t last = array_size(pqueue->heap) - 1;
+    uint8_t temp_element[MAX_ELEMENT_SIZE];
+    size_t handle = PQUEUE_NO_HANDLE;
+    array_get(pqueue->heap, last, temp_element);
+    array_del(pqueue->heap, last);
+    if (pqueue->slots != NULL){
+        array_get(pqueue->heap_handles, last, &handle);
+        array_del(pqueue->heap_handles, last);
+    }
+
+    if (index == last){
+        return;
+    }
+
+    if ((index > 0) && (pqueue->cmp_fn(temp_element, _pqueue_at(pqueue, (index - 1) >> pqueue->arity_shift), pqueue->ctx) < 0)){
+        _pqueue_sift_up(pqueue, index, temp_element, handle);
+    } else {
+        _pqueue_sift_down(pqueue, index, temp_element, handle);
+    }
+}
+
+/*
+    @brief Función interna que retorna la ranura de un manejador si su generación coincide (elemento presente).
+
+    @param const pqueue_pt pqueue: Referencia a la cola (modo indexado).
+    @param size_t handle: Manejador.
+
+    @retval pqueue_slot_pt: Ranura del elemento (NULL si el manejador no es válido).
+*/
+static pqueue_slot_pt _pqueue_slot(const pqueue_pt pqueue, size_t handle){
+    uint32_t slot_index = (uint32_t)handle;
+    uint32_t generation = (uint32_t)(handle >> 32);
+
+    // Las generaciones de ranuras ocupadas son impares (PQUEUE_NO_HANDLE nunca coincide: su ranura no existe):
+    if (((generation & 1) == 0) || (slot_index >= array_size(pqueue->slots))){
+        return NULL;
+    }
+
+    pqueue_slot_pt slot = (pqueue_slot_pt)array_at(pqueue->slots, slot_index);
+    return (slot->generation == generation) ? slot : NULL;
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
@@ -0,0 +1,79 @@
+#ifndef PQUEUE_HEADER
+#define PQUEUE_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "../array/array.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define PQUEUE_DEFAULT_ARITY 4          // Número de hijos por nodo del montículo por defecto.
+#define PQUEUE_NO_HANDLE SIZE_MAX       // Manejador nulo (modo no indexado).
+#define PQUEUE_NO_SLOT UINT32_MAX       // Fin de la lista de ranuras libres.
+#define PQUEUE_MAX_SLOTS (UINT32_MAX - 1)   // Número máximo de ranuras (índice de 32 bits del manejador).
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos---------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct pqueue_slot{
+    size_t index;               // Posición del elemento en el montículo (ocupada) o siguiente ranura libre (libre).
+    uint32_t generation;        // Generación de la ranura (impar: ocupada, par: libre).
+};
+
+struct pqueue{
+    array_pt heap;              // Montículo d-ario de elementos (la raíz es el elemento prioritario).
+    array_pt heap_handles;      // Manejador de cada posición del montículo (solo modo indexado).
+    array_pt slots;             // Ranuras (struct pqueue_slot) a las que apuntan los manejadores (solo modo indexado).
+    uint32_t free_head;         // Primera ranura libre (PQUEUE_NO_SLOT si no hay).
+    size_t free_count;          // Número de ranuras libres.
+    size_t arity_shift;         // log2 del número de hijos por nodo (2, 4 u 8 hijos).
+    int (*cmp_fn)(const void *, const void *, void *);  // Función comparadora (a, b, contexto): <0 si a es prioritario.
+    void * ctx;                 // Contexto de usuario de la función comparadora.
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct pqueue_slot pqueue_slot_t;
+typedef pqueue_slot_t * pqueue_slot_pt;
+
+typedef struct pqueue pqueue_t;
+typedef pqueue_t * pqueue_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción de la cola:
+pqueue_pt pqueue_init(size_t element_size, uint8_t arity, int (*cmp_fn)(const void *, const void *, void *), void * ctx, bool indexed);
+void pqueue_deinit(pqueue_pt * pqueue);
+void pqueue_clear(pqueue_pt pqueue);
+
+// Inserción y extracción:
+uint8_t pqueue_push(pqueue_pt pqueue, const void * element, size_t * out_handle);
+uint8_t pqueue_push_n(pqueue_pt pqueue, const void * elements, size_t n, size_t * out_handles);
+uint8_t pqueue_pop(pqueue_pt pqueue, void * out_element);
+uint8_t pqueue_peek(const pqueue_pt pqueue, void * out_element, size_t * out_handle);
+
+// Operaciones por manejador (modo indexado):
+uint8_t pqueue_decrease_key(pqueue_pt pqueue, size_t handle, const void * element);
+uint8_t pqueue_update(pqueue_pt pqueue, size_t handle, const void * element);
+uint8_t pqueue_remove(pqueue_pt pqueue, size_t handle, void * out_element);
+bool pqueue_contains(const pqueue_pt pqueue, size_t handle);
+
+// Utilidades generales:
+bool pqueue_is_empty(const pqueue_pt pqueue);
+size_t pqueue_size(const pqueue_pt pqueue);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
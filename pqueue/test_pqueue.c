@@ -0,0 +1,90 @@
+#include "pqueue.h"
+#include <stdio.h>
+
+struct test_task{
+    uint32_t priority;
+    uint32_t id;
+};
+
+// Prototipos de funciones:
+int cmp_task(const void * a, const void * b, void * ctx);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de una cola 4-aria de tareas (menor prioridad numérica sale antes):
+    pqueue_pt pqueue = pqueue_init(sizeof(struct test_task), 4, cmp_task, NULL, false);
+    printf("\nSe ha creado la cola correctamente en la dirección (%p)\n", (void *)pqueue);
+
+    // Inserción individual y en bloque (heapify en O(n)):
+    struct test_task task = {.priority = 50, .id = 0};
+    pqueue_push(pqueue, &task, NULL);
+
+    struct test_task tasks[8];
+    for (uint32_t i = 0; i < 8; i++){
+        tasks[i] = (struct test_task){.priority = (i * 37) % 100, .id = i + 1};
+    }
+    pqueue_push_n(pqueue, tasks, 8, NULL);
+    printf("Elementos: %ld\n", pqueue_size(pqueue));
+
+    // Extracción en orden de prioridad:
+    printf("Orden de salida (prioridad:id):");
+    while (pqueue_pop(pqueue, &task) == 0){
+        printf(" %u:%u", task.priority, task.id);
+    }
+    printf("\n");
+    pqueue_deinit(&pqueue);
+
+    // Cola binaria indexada: distancias provisionales con decrease_key (estilo Dijkstra):
+    pqueue = pqueue_init(sizeof(struct test_task), 2, cmp_task, NULL, true);
+    size_t handles[5];
+    size_t handle;
+    for (uint32_t i = 0; i < 5; i++){
+        task = (struct test_task){.priority = 100 + i, .id = i};
+        pqueue_push(pqueue, &task, &handles[i]);
+    }
+
+    task = (struct test_task){.priority = 10, .id = 3};
+    pqueue_decrease_key(pqueue, handles[3], &task);
+    task = (struct test_task){.priority = 200, .id = 0};
+    printf("\ndecrease_key a peor prioridad: %u\n", pqueue_decrease_key(pqueue, handles[0], &task));
+    pqueue_update(pqueue, handles[0], &task);
+    pqueue_remove(pqueue, handles[2], NULL);
+    printf("El manejador %ld sigue en la cola: %d\n", handles[2], pqueue_contains(pqueue, handles[2]));
+
+    // Un elemento nuevo reutiliza la ranura con otra generación: el manejador antiguo sigue sin ser válido:
+    task = (struct test_task){.priority = 150, .id = 5};
+    pqueue_push(pqueue, &task, &handle);
+    printf("Manejador reutilizado %ld, el antiguo %ld es válido: %d, eliminarlo retorna: %u\n",
+           handle, handles[2], pqueue_contains(pqueue, handles[2]), pqueue_remove(pqueue, handles[2], NULL));
+
+    pqueue_peek(pqueue, &task, &handle);
+    printf("Cabeza: prioridad %u, id %u, manejador %ld\n", task.priority, task.id, handle);
+
+    printf("Orden de salida (prioridad:id):");
+    while (pqueue_pop(pqueue, &task) == 0){
+        printf(" %u:%u", task.priority, task.id);
+    }
+    printf("\n");
+
+    // Destrucción de la cola:
+    pqueue_deinit(&pqueue);
+    printf("\nDirección de la cola tras la eliminación: (%p)\n", (void *)pqueue);
+
+    return 0;
+}
+
+/*
+    @brief Función de comparación de tareas por prioridad (menor valor sale antes).
+
+    @param const void * a: Referencia a la primera tarea.
+    @param const void * b: Referencia a la segunda tarea.
+    @param void * ctx: Contexto de usuario (no usado).
+
+    @retval int: <0, 0 o >0 si a sale antes, a la vez o después que b.
+*/
+int cmp_task(const void * a, const void * b, void * ctx){
+    uint32_t x = ((const struct test_task *)a)->priority;
+    uint32_t y = ((const struct test_task *)b)->priority;
+    return (x > y) - (x < y);
+}
\ No newline at end of file
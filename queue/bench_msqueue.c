@@ -0,0 +1,181 @@
+#include "msqueue.h"
+#include "../llist/sllist.h"
+#include <stdio.h>
+#include <time.h>
+#include <sched.h>
+
+struct bench_args{
+    msqueue_pt queue;               // Cola sin bloqueos (NULL para la lista con mutex).
+    sll_linkedlist_pt list;         // Lista de referencia.
+    pthread_mutex_t * lock;         // Mutex de la lista de referencia.
+    atomic_size_t * received;       // Número total de mensajes recibidos.
+    size_t messages;                // Mensajes por productor.
+    size_t total;                   // Mensajes totales a recibir.
+    uint64_t sum;                   // Suma de los mensajes recibidos por el hilo.
+};
+
+// Prototipos de funciones:
+double elapsed_ms(struct timespec start, struct timespec end);
+void * producer_thread(void * arg);
+void * consumer_thread(void * arg);
+double run_scaling(size_t threads, size_t messages, bool lock_free, bool * ok);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Mensajes totales y número máximo de productores/consumidores (por argumento o por defecto):
+    size_t messages = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000000;
+    size_t max_threads = (argc > 2) ? strtoul(argv[2], NULL, 10) : 4;
+    if (max_threads == 0){
+        max_threads = 1;
+    }
+    if (messages < max_threads){
+        messages = max_threads;
+    }
+
+    printf("Escalado con N productores y N consumidores (%ld mensajes uint64_t en total):\n", messages);
+    printf("\t  N   sllist + mutex (Mmsg/s)   msqueue (Mmsg/s)\n");
+    for (size_t n = 1; n <= max_threads; n++){
+        bool ok_list, ok_queue;
+        double ms_list = run_scaling(n, messages, false, &ok_list);
+        double ms_queue = run_scaling(n, messages, true, &ok_queue);
+        printf("\t%3ld   %23.2f   %16.2f%s\n", n, messages / ms_list / 1e3, messages / ms_queue / 1e3,
+               (ok_list && ok_queue) ? "" : "   (¡suma incorrecta!)");
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función que calcula el tiempo transcurrido entre dos marcas de tiempo.
+
+    @param struct timespec start: Marca de inicio.
+    @param struct timespec end: Marca de fin.
+
+    @retval double: Tiempo transcurrido en milisegundos.
+*/
+double elapsed_ms(struct timespec start, struct timespec end){
+    return (double)(end.tv_sec - start.tv_sec) * 1e3 + (double)(end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+/*
+    @brief Función del hilo productor: inserta sus mensajes en la cola o en la lista con mutex.
+
+    @param void * arg: Referencia a los argumentos (struct bench_args).
+
+    @retval void *: NULL.
+*/
+void * producer_thread(void * arg){
+    struct bench_args * args = (struct bench_args *)arg;
+
+    if (args->queue != NULL){
+        msq_handle_pt handle = msqueue_register(args->queue);
+        for (uint64_t i = 0; i < args->messages; i++){
+            msqueue_enqueue(args->queue, handle, &i);
+        }
+        msqueue_unregister(args->queue, &handle);
+        return NULL;
+    }
+
+    for (uint64_t i = 0; i < args->messages; i++){
+        pthread_mutex_lock(args->lock);
+        sllist_push_back(args->list, &i);
+        pthread_mutex_unlock(args->lock);
+    }
+
+    return NULL;
+}
+
+/*
+    @brief Función del hilo consumidor: extrae mensajes hasta que se han recibido todos.
+
+    @param void * arg: Referencia a los argumentos (struct bench_args).
+
+    @retval void *: NULL.
+*/
+void * consumer_thread(void * arg){
+    struct bench_args * args = (struct bench_args *)arg;
+    msq_handle_pt handle = (args->queue != NULL) ? msqueue_register(args->queue) : NULL;
+
+    while (atomic_load_explicit(args->received, memory_order_relaxed) < args->total){
+        bool got = false;
+        uint64_t value = 0;
+        if (args->queue != NULL){
+            got = (msqueue_try_dequeue(args->queue, handle, &value) == 0);
+        } else {
+            pthread_mutex_lock(args->lock);
+            if (!sllist_is_empty(args->list)){
+                value = *(uint64_t *)args->list->head->data;
+                sllist_pop_front(args->list);
+                got = true;
+            }
+            pthread_mutex_unlock(args->lock);
+        }
+
+        if (got){
+            args->sum += value;
+            atomic_fetch_add_explicit(args->received, 1, memory_order_relaxed);
+        } else {
+            sched_yield();
+        }
+    }
+
+    msqueue_unregister(args->queue, &handle);
+
+    return NULL;
+}
+
+/*
+    @brief Función que mide el traspaso de mensajes entre N productores y N consumidores.
+
+    @param size_t threads: Número de productores (y de consumidores).
+    @param size_t messages: Mensajes totales (se reparten entre los productores).
+    @param bool lock_free: true para la cola sin bloqueos, false para la lista con mutex.
+    @param bool * ok: Indica si la suma de los mensajes recibidos es la esperada.
+
+    @retval double: Tiempo en milisegundos.
+*/
+double run_scaling(size_t threads, size_t messages, bool lock_free, bool * ok){
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    atomic_size_t received = 0;
+    size_t per_producer = messages / threads;
+    struct bench_args base = {
+        .queue = lock_free ? msqueue_init(sizeof(uint64_t)) : NULL,
+        .list = lock_free ? NULL : sllist_init(sizeof(uint64_t)),
+        .lock = &lock,
+        .received = &received,
+        .messages = per_producer,
+        .total = per_producer * threads,
+        .sum = 0
+    };
+
+    pthread_t * producers = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    pthread_t * consumers = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    struct bench_args * args = (struct bench_args *)malloc(threads * sizeof(struct bench_args));
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < threads; i++){
+        args[i] = base;
+        pthread_create(&producers[i], NULL, producer_thread, &base);
+        pthread_create(&consumers[i], NULL, consumer_thread, &args[i]);
+    }
+
+    uint64_t sum = 0;
+    for (size_t i = 0; i < threads; i++){
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+        sum += args[i].sum;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    *ok = (sum == (uint64_t)threads * per_producer * (per_producer - 1) / 2);
+
+    msqueue_deinit(&base.queue);
+    sllist_deinit(&base.list);
+    free(producers);
+    free(consumers);
+    free(args);
+
+    return elapsed_ms(start, end);
+}
\ No newline at end of file
@@ -0,0 +1,302 @@
+#define _GNU_SOURCE
+#include "spscq.h"
+#include "../llist/dllist.h"
+#include <stdio.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#define BENCH_BATCH 64
+
+struct bench_args{
+    spscq_pt queue;                 // Cola de ida.
+    spscq_pt reply;                 // Cola de vuelta (solo ping-pong).
+    dll_linkedlist_pt list;         // Lista de referencia (solo lista con mutex).
+    pthread_mutex_t * lock;         // Mutex de la lista de referencia.
+    size_t messages;                // Número de mensajes a enviar.
+    int cpu;                        // CPU a la que se fija el hilo.
+    bool batched;                   // Indica si se usa push_n / pop_n.
+};
+
+// Prototipos de funciones:
+double elapsed_ms(struct timespec start, struct timespec end);
+bool pin_thread(int cpu);
+void * producer_thread(void * arg);
+void * list_producer_thread(void * arg);
+void * echo_thread(void * arg);
+double run_throughput(size_t messages, uint8_t wait_mode, bool batched);
+double run_list_throughput(size_t messages);
+double run_round_trip(size_t rounds, uint8_t wait_mode);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Número de mensajes y de viajes de ida y vuelta (por argumento o por defecto):
+    size_t messages = (argc > 1) ? strtoul(argv[1], NULL, 10) : 2000000;
+    size_t rounds = (argc > 2) ? strtoul(argv[2], NULL, 10) : 20000;
+    if (messages == 0){
+        messages = 1;
+    }
+    if (rounds == 0){
+        rounds = 1;
+    }
+
+    // Comprobación de la fijación de hilos (con una sola CPU ambos hilos comparten procesador):
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    printf("CPUs disponibles: %ld%s\n\n", cpus, (cpus < 2) ? " (sin segunda CPU, los hilos no se pueden fijar a núcleos distintos)" : "");
+
+    // Rendimiento productor -> consumidor:
+    printf("Rendimiento (%ld mensajes uint64_t):\n", messages);
+    double ms = run_list_throughput(messages);
+    printf("\t-dllist + mutex:            %10.2f ms (%8.2f Mmsg/s)\n", ms, messages / ms / 1e3);
+    ms = run_throughput(messages, SPSCQ_WAIT_SPIN, false);
+    printf("\t-spscq espera activa:       %10.2f ms (%8.2f Mmsg/s)\n", ms, messages / ms / 1e3);
+    ms = run_throughput(messages, SPSCQ_WAIT_BLOCK, false);
+    printf("\t-spscq futex:               %10.2f ms (%8.2f Mmsg/s)\n", ms, messages / ms / 1e3);
+    ms = run_throughput(messages, SPSCQ_WAIT_SPIN, true);
+    printf("\t-spscq bloques de %d:       %10.2f ms (%8.2f Mmsg/s)\n", BENCH_BATCH, ms, messages / ms / 1e3);
+
+    // Latencia de ida y vuelta (ping-pong entre dos colas):
+    printf("\nLatencia de ida y vuelta (%ld viajes):\n", rounds);
+    ms = run_round_trip(rounds, SPSCQ_WAIT_SPIN);
+    printf("\t-spscq espera activa:       %10.2f us/viaje\n", ms * 1e3 / rounds);
+    ms = run_round_trip(rounds, SPSCQ_WAIT_BLOCK);
+    printf("\t-spscq futex:               %10.2f us/viaje\n", ms * 1e3 / rounds);
+
+    return 0;
+}
+
+/*
+    @brief Función que calcula el tiempo transcurrido entre dos marcas de tiempo.
+
+    @param struct timespec start: Marca de inicio.
+    @param struct timespec end: Marca de fin.
+
+    @retval double: Tiempo transcurrido en milisegundos.
+*/
+double elapsed_ms(struct timespec start, struct timespec end){
+    return (double)(end.tv_sec - start.tv_sec) * 1e3 + (double)(end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+/*
+    @brief Función que fija el hilo actual a una CPU (módulo el número de CPUs disponibles).
+
+    @param int cpu: CPU deseada.
+
+    @retval bool: true si se ha fijado el hilo, false en otro caso (el benchmark continúa sin fijar).
+*/
+bool pin_thread(int cpu){
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % ((cpus > 0) ? cpus : 1), &set);
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+/*
+    @brief Función del hilo productor del benchmark de rendimiento.
+
+    @param void * arg: Referencia a los argumentos (struct bench_args).
+
+    @retval void *: NULL.
+*/
+void * producer_thread(void * arg){
+    struct bench_args * args = (struct bench_args *)arg;
+    pin_thread(args->cpu);
+
+    if (!args->batched){
+        for (uint64_t i = 0; i < args->messages; i++){
+            spscq_push(args->queue, &i);
+        }
+        return NULL;
+    }
+
+    uint64_t block[BENCH_BATCH];
+    uint64_t next = 0;
+    while (next < args->messages){
+        size_t count = (args->messages - next < BENCH_BATCH) ? args->messages - next : BENCH_BATCH;
+        for (size_t i = 0; i < count; i++){
+            block[i] = next + i;
+        }
+
+        size_t sent = 0;
+        while (sent < count){
+            size_t pushed = spscq_push_n(args->queue, block + sent, count - sent);
+            if (pushed == 0){
+                sched_yield();
+            }
+            sent += pushed;
+        }
+        next += count;
+    }
+
+    return NULL;
+}
+
+/*
+    @brief Función del hilo productor del benchmark de referencia (lista doblemente enlazada protegida con mutex).
+
+    @param void * arg: Referencia a los argumentos (struct bench_args).
+
+    @retval void *: NULL.
+*/
+void * list_producer_thread(void * arg){
+    struct bench_args * args = (struct bench_args *)arg;
+    pin_thread(args->cpu);
+
+    for (uint64_t i = 0; i < args->messages; i++){
+        pthread_mutex_lock(args->lock);
+        dllist_push_back(args->list, &i);
+        pthread_mutex_unlock(args->lock);
+    }
+
+    return NULL;
+}
+
+/*
+    @brief Función del hilo de eco del benchmark de latencia: devuelve cada mensaje recibido.
+
+    @param void * arg: Referencia a los argumentos (struct bench_args).
+
+    @retval void *: NULL.
+*/
+void * echo_thread(void * arg){
+    struct bench_args * args = (struct bench_args *)arg;
+    pin_thread(args->cpu);
+
+    uint64_t value;
+    for (size_t i = 0; i < args->messages; i++){
+        spscq_pop(args->queue, &value);
+        spscq_push(args->reply, &value);
+    }
+
+    return NULL;
+}
+
+/*
+    @brief Función que mide el tiempo de traspaso de mensajes entre dos hilos a través de una cola SPSC.
+
+    @param size_t messages: Número de mensajes.
+    @param uint8_t wait_mode: Modo de espera de la cola.
+    @param bool batched: Indica si se usan operaciones por bloques.
+
+    @retval double: Tiempo en milisegundos (o -1 si los mensajes no llegan en orden).
+*/
+double run_throughput(size_t messages, uint8_t wait_mode, bool batched){
+    struct bench_args args = {.queue = spscq_init(sizeof(uint64_t), 4096, wait_mode), .messages = messages, .cpu = 1, .batched = batched};
+    pin_thread(0);
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pthread_t producer;
+    pthread_create(&producer, NULL, producer_thread, &args);
+
+    bool in_order = true;
+    uint64_t expected = 0;
+    if (!batched){
+        uint64_t value;
+        for (size_t i = 0; i < messages; i++){
+            spscq_pop(args.queue, &value);
+            in_order &= (value == expected++);
+        }
+    } else {
+        uint64_t block[BENCH_BATCH];
+        while (expected < messages){
+            size_t popped = spscq_pop_n(args.queue, block, BENCH_BATCH);
+            if (popped == 0){
+                sched_yield();
+            }
+            for (size_t i = 0; i < popped; i++){
+                in_order &= (block[i] == expected++);
+            }
+        }
+    }
+
+    pthread_join(producer, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    spscq_deinit(&args.queue);
+
+    return in_order ? elapsed_ms(start, end) : -1;
+}
+
+/*
+    @brief Función que mide el tiempo de traspaso de mensajes con una lista doblemente enlazada protegida con mutex.
+
+    @param size_t messages: Número de mensajes.
+
+    @retval double: Tiempo en milisegundos (o -1 si los mensajes no llegan en orden).
+*/
+double run_list_throughput(size_t messages){
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    struct bench_args args = {.list = dllist_init(sizeof(uint64_t)), .lock = &lock, .messages = messages, .cpu = 1};
+    pin_thread(0);
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pthread_t producer;
+    pthread_create(&producer, NULL, list_producer_thread, &args);
+
+    bool in_order = true;
+    uint64_t expected = 0;
+    while (expected < messages){
+        bool received = false;
+        uint64_t value = 0;
+        pthread_mutex_lock(&lock);
+        if (!dllist_is_empty(args.list)){
+            value = *(uint64_t *)args.list->head->data;
+            dllist_pop_front(args.list);
+            received = true;
+        }
+        pthread_mutex_unlock(&lock);
+
+        if (received){
+            in_order &= (value == expected++);
+        } else {
+            sched_yield();
+        }
+    }
+
+    pthread_join(producer, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    dllist_deinit(&args.list);
+
+    return in_order ? elapsed_ms(start, end) : -1;
+}
+
+/*
+    @brief Función que mide el tiempo de ida y vuelta de un mensaje entre dos hilos (dos colas SPSC).
+
+    @param size_t rounds: Número de viajes de ida y vuelta.
+    @param uint8_t wait_mode: Modo de espera de las colas.
+
+    @retval double: Tiempo total en milisegundos.
+*/
+double run_round_trip(size_t rounds, uint8_t wait_mode){
+    struct bench_args args = {
+        .queue = spscq_init(sizeof(uint64_t), 16, wait_mode),
+        .reply = spscq_init(sizeof(uint64_t), 16, wait_mode),
+        .messages = rounds,
+        .cpu = 1
+    };
+    pin_thread(0);
+
+    pthread_t echo;
+    pthread_create(&echo, NULL, echo_thread, &args);
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    uint64_t value;
+    for (uint64_t i = 0; i < rounds; i++){
+        spscq_push(args.queue, &i);
+        spscq_pop(args.reply, &value);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    pthread_join(echo, NULL);
+    spscq_deinit(&args.queue);
+    spscq_deinit(&args.reply);
+
+    return elapsed_ms(start, end);
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#!/bin/bash
+
+
+# Variables de entorno             #
+# -------------------------------- #
+CC=gcc
+CFLAGS_TEST="-g -Wall -O2 -pthread"
+CFLAGS_LIB="-Wall -O2 -fPIC -shared -pthread"
+CFLAGS_BENCH="-Wall -O2 -march=native -pthread"
+
+SRC_QUEUE="$1.c"
+SRC_TEST=test_$1.c
+SRC_BENCH="bench_$1.c ../llist/sllist.c ../llist/dllist.c ../array/array.c"
+
+TEST_PROG=test_$1.elf
+BENCH_PROG=bench_$1.elf
+LIB_PROG=$1.so
+# -------------------------------- #
+
+
+# Lógica de uso                    #
+# -------------------------------- #
+if [ "$2" == "test" ]; then
+    echo
+    echo "[BUILD-QUEUE-TEST]: Compilando programa de prueba de $1..."
+    if $CC $CFLAGS_TEST $SRC_TEST $SRC_QUEUE -o $TEST_PROG; then
+        echo "[BUILD-QUEUE-TEST]: Compilación completada."
+        echo "[BUILD-QUEUE-TEST]: Ejecutando programa de prueba..."
+        echo
+        ./$TEST_PROG
+        echo
+        echo "[BUILD-QUEUE-TEST]: Ejecución de programa de prueba finalizado."
+    else
+        echo "[BUILD-QUEUE-TEST][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$2" == "bench" ]; then
+    echo
+    echo "[BUILD-QUEUE-BENCH]: Compilando benchmark de $1..."
+    if $CC $CFLAGS_BENCH $SRC_BENCH $SRC_QUEUE -o $BENCH_PROG; then
+        echo "[BUILD-QUEUE-BENCH]: Compilación completada."
+        echo "[BUILD-QUEUE-BENCH]: Ejecutando benchmark..."
+        echo
+        ./$BENCH_PROG "${@:3}"
+        echo
+        echo "[BUILD-QUEUE-BENCH]: Ejecución de benchmark finalizada."
+    else
+        echo "[BUILD-QUEUE-BENCH][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$2" == "lib" ]; then
+    echo
+    echo "[BUILD-QUEUE-LIB]: Compilando la librería de $1..."
+    if $CC $CFLAGS_LIB $SRC_QUEUE -o $LIB_PROG; then
+        mv $LIB_PROG ./lib
+        echo "[BUILD-QUEUE-LIB]: Librearía compilada."
+    else
+        echo "[BUILD-QUEUE-LIB][ERR]: Error de compilación, librería no generada."
+    fi
+    echo
+
+elif [ "$2" == "clean" ]; then
+    echo
+    echo "[BUILD-QUEUE-CLEAN]: Limpiando espacio de trabajo..."
+    rm -f ./$TEST_PROG ./$BENCH_PROG ./lib/$LIB_PROG
+    echo "[BUILD-QUEUE-CLEAN]: Espacio de trabajo limpio."
+    echo
+
+else
+    echo
+    echo "[BUILD-QUEUE][ERR]: Uso incorrecto u opciones inválidas."
+    echo -e "\n\t[Uso]:"
+    echo -e "\t\t-> ./build.sh <tipo> test: \tCompila y ejecuta el programa de test (.elf)"
+    echo -e "\t\t-> ./build.sh <tipo> bench [args]: \tCompila y ejecuta el benchmark (.elf)"
+    echo -e "\t\t-> ./build.sh <tipo> lib: \tCompila y genera la librería compartida (.so) bajo la carpeta lib/"
+    echo -e "\t\t-> ./build.sh <tipo> clean: \tLimpia el espacio de trabajo eliminando archivos generados"
+    echo -e "\n\n\t<tipo>:"
+    echo -e "\t\tspscq: \tEjecuta el script para la cola 'single producer / single consumer'"
+    echo -e "\t\tmsqueue: \tEjecuta el script para la cola 'multi producer / multi consumer' de Michael-Scott"
+    echo -e "\t\tmpmcq: \tEjecuta el script para la cola acotada 'multi producer / multi consumer' con secuencias por ranura"
+    echo
+    exit 1
+fi
+# -------------------------------- #
\ No newline at end of file
@@ -0,0 +1,466 @@
+#include "mpmcq.h"
+
+#include <limits.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static inline atomic_size_t * _mpmcq_slot_seq(mpmcq_pt queue, size_t pos);
+static inline void * _mpmcq_slot_data(mpmcq_pt queue, size_t pos);
+static inline void _mpmcq_cpu_relax(void);
+static inline void _mpmcq_notify(atomic_uint * seq, atomic_uint * waiting, bool all);
+static void _mpmcq_block(mpmcq_pt queue, atomic_uint * seq, atomic_uint * waiting, bool producer);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar una cola acotada de varios productores y consumidores.
+    @note: Cada ranura guarda un número de secuencia y los datos en línea; productores y consumidores reclaman ranuras con un CAS sobre su ticket.
+
+    @param size_t data_size: Tamaño del elemento en bytes.
+    @param size_t capacity: Capacidad mínima (número de elementos, se redondea a potencia de 2).
+
+    @retval mpmcq_pt: Referencia a la cola creada.
+*/
+mpmcq_pt mpmcq_init(size_t data_size, size_t capacity){
+    // Comprobación de los límites de tamaño y capacidad:
+    if ((data_size < MIN_DATA_SIZE) || (data_size > MAX_DATA_SIZE) || (capacity == 0) || (capacity > (SIZE_MAX / 4) / (data_size + sizeof(size_t)))){
+        return NULL;
+    }
+
+    // Reserva de memoria de la estructura (alineada a línea de caché):
+    mpmcq_pt queue = (mpmcq_pt)aligned_alloc(MPMCQ_CACHE_LINE, sizeof(mpmcq_t));
+    if (queue == NULL){
+        return NULL;
+    }
+
+    size_t real_capacity = MPMCQ_MIN_CAPACITY;
+    while (real_capacity < capacity){
+        real_capacity *= 2;
+    }
+
+    // Reserva de las ranuras (secuencia + datos, alineadas a la secuencia):
+    queue->slot_size = (sizeof(atomic_size_t) + data_size + sizeof(atomic_size_t) - 1) & ~(sizeof(atomic_size_t) - 1);
+    size_t bytes = (real_capacity * queue->slot_size + MPMCQ_CACHE_LINE - 1) & ~((size_t)MPMCQ_CACHE_LINE - 1);
+    queue->slots = (uint8_t *)aligned_alloc(MPMCQ_CACHE_LINE, bytes);
+    if (queue->slots == NULL){
+        free(queue);
+        return NULL;
+    }
+
+    // Inicio de los miembros de la estructura (la ranura i espera al productor con ticket i):
+    queue->data_size = data_size;
+    queue->mask = real_capacity - 1;
+    for (size_t i = 0; i < real_capacity; i++){
+        atomic_init(_mpmcq_slot_seq(queue, i), i);
+    }
+    atomic_init(&queue->enqueue_pos, 0);
+    atomic_init(&queue->dequeue_pos, 0);
+    atomic_init(&queue->not_empty_seq, 0);
+    atomic_init(&queue->not_full_seq, 0);
+    atomic_init(&queue->consumers_waiting, 0);
+    atomic_init(&queue->producers_waiting, 0);
+
+    return queue;
+}
+
+/*
+    @brief Función para destruir y liberar una cola (ningún hilo debe estar usándola).
+
+    @param mpmcq_pt * queue: Referencia a la referencia de la cola.
+
+    @retval None.
+*/
+void mpmcq_deinit(mpmcq_pt * queue){
+    // Comprobación de que la cola no sea nula:
+    if ((queue == NULL) || (*queue == NULL)){
+        return;
+    }
+
+    // Liberación de las ranuras y de la estructura:
+    free((*queue)->slots);
+    free(*queue);
+    *queue = NULL;
+}
+
+/*
+    @brief Función para insertar un elemento sin esperar.
+
+    @param mpmcq_pt queue: Referencia a la cola.
+    @param const void * data: Referencia al elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o elemento no válidos.
+                -> 2: La cola está llena.
+*/
+uint8_t mpmcq_try_push(mpmcq_pt queue, const void * data){
+    // Comprobación de cola y elemento válidos:
+    if ((queue == NULL) || (data == NULL)){
+        return 1;
+    }
+
+    // Reclamación de la ranura del ticket actual (libre si su secuencia coincide con el ticket):
+    size_t pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    while (true){
+        size_t seq = atomic_load_explicit(_mpmcq_slot_seq(queue, pos), memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0){
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)){
+                break;
+            }
+        } else if (diff < 0){
+            return 2;
+        } else {
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+        }
+    }
+
+    // Copia del elemento y publicación para el consumidor del mismo ticket:
+    memcpy(_mpmcq_slot_data(queue, pos), data, queue->data_size);
+    atomic_store_explicit(_mpmcq_slot_seq(queue, pos), pos + 1, memory_order_release);
+    _mpmcq_notify(&queue->not_empty_seq, &queue->consumers_waiting, false);
+
+    return 0;
+}
+
+/*
+    @brief Función para extraer un elemento sin esperar.
+
+    @param mpmcq_pt queue: Referencia a la cola.
+    @param void * out_data: Referencia a la variable donde se copiará el elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o variable no válidas.
+                -> 2: La cola está vacía.
+*/
+uint8_t mpmcq_try_pop(mpmcq_pt queue, void * out_data){
+    // Comprobación de cola y variable válidas:
+    if ((queue == NULL) || (out_data == NULL)){
+        return 1;
+    }
+
+    // Reclamación de la ranura del ticket actual (llena si su secuencia es ticket + 1):
+    size_t pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    while (true){
+        size_t seq = atomic_load_explicit(_mpmcq_slot_seq(queue, pos), memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (diff == 0){
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeue_pos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)){
+                break;
+            }
+        } else if (diff < 0){
+            return 2;
+        } else {
+            pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+        }
+    }
+
+    // Copia del elemento y liberación de la ranura para el productor de la siguiente vuelta:
+    memcpy(out_data, _mpmcq_slot_data(queue, pos), queue->data_size);
+    atomic_store_explicit(_mpmcq_slot_seq(queue, pos), pos + queue->mask + 1, memory_order_release);
+    _mpmcq_notify(&queue->not_full_seq, &queue->producers_waiting, false);
+
+    return 0;
+}
+
+/*
+    @brief Función para insertar hasta n elementos sin esperar, reclamando todas sus ranuras con un único CAS.
+
+    @param mpmcq_pt queue: Referencia a la cola.
+    @param const void * data: Referencia a los n elementos, contiguos y de data_size bytes cada uno.
+    @param size_t n: Número máximo de elementos a insertar.
+
+    @retval size_t: Número de elementos insertados (los primeros del bloque).
+*/
+size_t mpmcq_push_n(mpmcq_pt queue, const void * data, size_t n){
+    // Comprobación de cola y elementos válidos:
+    if ((queue == NULL) || (data == NULL) || (n == 0)){
+        return 0;
+    }
+
+    // Reclamación de las ranuras libres consecutivas a partir del ticket actual:
+    size_t pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    size_t count;
+    while (true){
+        count = 0;
+        while ((count < n) && (atomic_load_explicit(_mpmcq_slot_seq(queue, pos + count), memory_order_acquire) == pos + count)){
+            count++;
+        }
+
+        if (count == 0){
+            size_t seq = atomic_load_explicit(_mpmcq_slot_seq(queue, pos), memory_order_acquire);
+            if ((intptr_t)seq - (intptr_t)pos < 0){
+                return 0;
+            }
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+            continue;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + count, memory_order_relaxed, memory_order_relaxed)){
+            break;
+        }
+    }
+
+    // Copia y publicación de cada elemento:
+    for (size_t i = 0; i < count; i++){
+        memcpy(_mpmcq_slot_data(queue, pos + i), (const uint8_t *)data + (i * queue->data_size), queue->data_size);
+        atomic_store_explicit(_mpmcq_slot_seq(queue, pos + i), pos + i + 1, memory_order_release);
+    }
+    _mpmcq_notify(&queue->not_empty_seq, &queue->consumers_waiting, count > 1);
+
+    return count;
+}
+
+/*
+    @brief Función para extraer hasta n elementos sin esperar, reclamando todas sus ranuras con un único CAS.
+
+    @param mpmcq_pt queue: Referencia a la cola.
+    @param void * out_data: Referencia al buffer de salida, de al menos n elementos.
+    @param size_t n: Número máximo de elementos a extraer.
+
+    @retval size_t: Número de elementos extraídos.
+*/
+size_t mpmcq_pop_n(mpmcq_pt queue, void * out_data, size_t n){
+    // Comprobación de cola y buffer válidos:
+    if ((queue == NULL) || (out_data == NULL) || (n == 0)){
+        return 0;
+    }
+
+    // Reclamación de las ranuras llenas consecutivas a partir del ticket actual:
+    size_t pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    size_t count;
+    while (true){
+        count = 0;
+        while ((count < n) && (atomic_load_explicit(_mpmcq_slot_seq(queue, pos + count), memory_order_acquire) == pos + count + 1)){
+            count++;
+        }
+
+        if (count == 0){
+            size_t seq = atomic_load_explicit(_mpmcq_slot_seq(queue, pos), memory_order_acquire);
+            if ((intptr_t)seq - (intptr_t)(pos + 1) < 0){
+                return 0;
+            }
+            pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+            continue;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(&queue->dequeue_pos, &pos, pos + count, memory_order_relaxed, memory_order_relaxed)){
+            break;
+        }
+    }
+
+    // Copia y liberación de cada ranura:
+    for (size_t i = 0; i < count; i++){
+        memcpy((uint8_t *)out_data + (i * queue->data_size), _mpmcq_slot_data(queue, pos + i), queue->data_size);
+        atomic_store_explicit(_mpmcq_slot_seq(queue, pos + i), pos + i + queue->mask + 1, memory_order_release);
+    }
+    _mpmcq_notify(&queue->not_full_seq, &queue->producers_waiting, count > 1);
+
+    return count;
+}
+
+/*
+    @brief Función para insertar un elemento, esperando mientras la cola esté llena.
+    @note: Espera activa hasta MPMCQ_SPIN_LIMIT intentos; después duerme en un futex hasta que un consumidor libere ranuras.
+
+    @param mpmcq_pt queue: Referencia a la cola.
+    @param const void * data: Referencia al elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o elemento no válidos.
+*/
+uint8_t mpmcq_push(mpmcq_pt queue, const void * data){
+    // Comprobación de cola y elemento válidos:
+    if ((queue == NULL) || (data == NULL)){
+        return 1;
+    }
+
+    // Reintentos con espera activa y después bloqueo:
+    uint32_t spins = 0;
+    while (mpmcq_try_push(queue, data) != 0){
+        if (spins < MPMCQ_SPIN_LIMIT){
+            spins++;
+            _mpmcq_cpu_relax();
+        } else {
+            _mpmcq_block(queue, &queue->not_full_seq, &queue->producers_waiting, true);
+        }
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función para extraer un elemento, esperando mientras la cola esté vacía.
+    @note: Espera activa hasta MPMCQ_SPIN_LIMIT intentos; después duerme en un futex hasta que un productor publique.
+
+    @param mpmcq_pt queue: Referencia a la cola.
+    @param void * out_data: Referencia a la variable donde se copiará el elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o variable no válidas.
+*/
+uint8_t mpmcq_pop(mpmcq_pt queue, void * out_data){
+    // Comprobación de cola y variable válidas:
+    if ((queue == NULL) || (out_data == NULL)){
+        return 1;
+    }
+
+    // Reintentos con espera activa y después bloqueo:
+    uint32_t spins = 0;
+    while (mpmcq_try_pop(queue, out_data) != 0){
+        if (spins < MPMCQ_SPIN_LIMIT){
+            spins++;
+            _mpmcq_cpu_relax();
+        } else {
+            _mpmcq_block(queue, &queue->not_empty_seq, &queue->consumers_waiting, false);
+        }
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna el número aproximado de elementos de la cola (exacto si no hay operaciones en curso).
+
+    @param const mpmcq_pt queue: Referencia a la cola.
+
+    @retval size_t: Número de elementos.
+*/
+size_t mpmcq_size(const mpmcq_pt queue){
+    // Comprobación de cola válida:
+    if (queue == NULL){
+        return 0;
+    }
+
+    size_t dequeue_pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_acquire);
+    size_t enqueue_pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_acquire);
+    intptr_t diff = (intptr_t)enqueue_pos - (intptr_t)dequeue_pos;
+
+    if (diff < 0){
+        return 0;
+    }
+
+    return ((size_t)diff > queue->mask + 1) ? queue->mask + 1 : (size_t)diff;
+}
+
+/*
+    @brief Función que retorna la capacidad de la cola.
+
+    @param const mpmcq_pt queue: Referencia a la cola.
+
+    @retval size_t: Capacidad (número de elementos).
+*/
+size_t mpmcq_capacity(const mpmcq_pt queue){
+    // Comprobación de cola válida:
+    if (queue == NULL){
+        return 0;
+    }
+
+    return queue->mask + 1;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna que retorna la secuencia de la ranura de un ticket.
+
+    @param mpmcq_pt queue: Referencia a la cola.
+    @param size_t pos: Ticket (creciente).
+
+    @retval atomic_size_t *: Referencia a la secuencia de la ranura.
+*/
+static inline atomic_size_t * _mpmcq_slot_seq(mpmcq_pt queue, size_t pos){
+    return (atomic_size_t *)(queue->slots + ((pos & queue->mask) * queue->slot_size));
+}
+
+/*
+    @brief Función interna que retorna los datos de la ranura de un ticket.
+
+    @param mpmcq_pt queue: Referencia a la cola.
+    @param size_t pos: Ticket (creciente).
+
+    @retval void *: Referencia a los datos de la ranura.
+*/
+static inline void * _mpmcq_slot_data(mpmcq_pt queue, size_t pos){
+    return queue->slots + ((pos & queue->mask) * queue->slot_size) + sizeof(atomic_size_t);
+}
+
+/*
+    @brief Función interna que indica a la CPU que el hilo está en espera activa.
+
+    @retval None.
+*/
+static inline void _mpmcq_cpu_relax(void){
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/*
+    @brief Función interna que despierta a los hilos dormidos del otro lado, si los hay.
+    @note: La barrera seq_cst, emparejada con la de _mpmcq_block, evita avisos perdidos.
+
+    @param atomic_uint * seq: Referencia a la secuencia de avisos (palabra del futex).
+    @param atomic_uint * waiting: Referencia al contador de hilos dormidos.
+    @param bool all: Indica si se despierta a todos (bloques) o a uno solo.
+
+    @retval None.
+*/
+static inline void _mpmcq_notify(atomic_uint * seq, atomic_uint * waiting, bool all){
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(waiting, memory_order_relaxed) != 0){
+        atomic_fetch_add_explicit(seq, 1, memory_order_release);
+        syscall(SYS_futex, seq, FUTEX_WAKE_PRIVATE, all ? INT_MAX : 1, NULL, NULL, 0);
+    }
+}
+
+/*
+    @brief Función interna que duerme en un futex hasta recibir un aviso, si la ranura del ticket actual sigue sin estar lista.
+
+    @param mpmcq_pt queue: Referencia a la cola.
+    @param atomic_uint * seq: Referencia a la secuencia de avisos (palabra del futex).
+    @param atomic_uint * waiting: Referencia al contador de hilos dormidos.
+    @param bool producer: Indica si espera un productor (cola llena) o un consumidor (cola vacía).
+
+    @retval None.
+*/
+static void _mpmcq_block(mpmcq_pt queue, atomic_uint * seq, atomic_uint * waiting, bool producer){
+    // Lectura de la secuencia antes de anunciar la espera (un aviso posterior hace fallar FUTEX_WAIT):
+    unsigned int expected = atomic_load_explicit(seq, memory_order_acquire);
+    atomic_fetch_add_explicit(waiting, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    // Nueva comprobación de la ranura del ticket actual tras anunciar la espera:
+    size_t pos = producer ? atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed) : atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    size_t slot_seq = atomic_load_explicit(_mpmcq_slot_seq(queue, pos), memory_order_acquire);
+    bool must_wait = producer ? ((intptr_t)slot_seq - (intptr_t)pos < 0) : ((intptr_t)slot_seq - (intptr_t)(pos + 1) < 0);
+
+    if (must_wait){
+        syscall(SYS_futex, seq, FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+    }
+
+    atomic_fetch_sub_explicit(waiting, 1, memory_order_relaxed);
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
@@ -0,0 +1,75 @@
+#ifndef MPMCQ_HEADER
+#define MPMCQ_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdatomic.h>
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define MIN_DATA_SIZE 1             // En bytes.
+#define MAX_DATA_SIZE 128           // En bytes.
+
+#define MPMCQ_CACHE_LINE 64         // Tamaño (bytes) de la línea de caché usada para separar los tickets.
+#define MPMCQ_MIN_CAPACITY 2        // En número de elementos (potencia de 2).
+#define MPMCQ_SPIN_LIMIT 1024       // Iteraciones de espera activa antes de dormir en el futex.
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos --------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct mpmcq{
+    _Alignas(MPMCQ_CACHE_LINE) atomic_size_t enqueue_pos;   // Ticket (creciente) del siguiente productor.
+    _Alignas(MPMCQ_CACHE_LINE) atomic_size_t dequeue_pos;   // Ticket (creciente) del siguiente consumidor.
+
+    // Palabras de espera de las operaciones bloqueantes:
+    _Alignas(MPMCQ_CACHE_LINE) atomic_uint not_empty_seq;   // Secuencia de avisos a consumidores (futex).
+    atomic_uint not_full_seq;                               // Secuencia de avisos a productores (futex).
+    atomic_uint consumers_waiting;                          // Consumidores dormidos (o a punto de dormir).
+    atomic_uint producers_waiting;                          // Productores dormidos (o a punto de dormir).
+
+    // Datos de solo lectura tras la creación:
+    _Alignas(MPMCQ_CACHE_LINE) uint8_t * slots;             // Ranuras: secuencia (atomic_size_t) + datos en línea.
+    size_t slot_size;                                       // Tamaño (bytes) de cada ranura.
+    size_t data_size;                                       // Tamaño (bytes) del elemento.
+    size_t mask;                                            // Capacidad - 1 (la capacidad es potencia de 2).
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct mpmcq mpmcq_t;
+typedef mpmcq_t * mpmcq_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción de la cola:
+mpmcq_pt mpmcq_init(size_t data_size, size_t capacity);
+void mpmcq_deinit(mpmcq_pt * queue);
+
+// Operaciones sin espera:
+uint8_t mpmcq_try_push(mpmcq_pt queue, const void * data);
+uint8_t mpmcq_try_pop(mpmcq_pt queue, void * out_data);
+size_t mpmcq_push_n(mpmcq_pt queue, const void * data, size_t n);
+size_t mpmcq_pop_n(mpmcq_pt queue, void * out_data, size_t n);
+
+// Operaciones con espera (activa y después futex):
+uint8_t mpmcq_push(mpmcq_pt queue, const void * data);
+uint8_t mpmcq_pop(mpmcq_pt queue, void * out_data);
+
+// Utilidades generales:
+size_t mpmcq_size(const mpmcq_pt queue);
+size_t mpmcq_capacity(const mpmcq_pt queue);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
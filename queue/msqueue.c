@@ -0,0 +1,493 @@
+#include "msqueue.h"
+
+#include <sched.h>
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static msq_node_pt _msqueue_node_alloc(msqueue_pt queue, msq_handle_pt handle);
+static void _msqueue_node_recycle(msqueue_pt queue, msq_handle_pt handle, msq_node_pt node);
+static void _msqueue_flush_cache(msqueue_pt queue, msq_handle_pt handle);
+static void _msqueue_retire(msqueue_pt queue, msq_handle_pt handle, msq_node_pt node);
+static void _msqueue_scan(msqueue_pt queue, msq_handle_pt handle);
+static bool _msqueue_is_hazard(msqueue_pt queue, msq_node_pt node);
+static void _msqueue_free_chain(msq_node_pt node);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar una cola sin bloqueos de varios productores y consumidores (Michael-Scott).
+    @note: Los nodos tienen la misma disposición que los de sllist (datos + siguiente), con los datos en la misma reserva.
+
+    @param size_t data_size: Tamaño (en bytes) de los datos de cada nodo.
+
+    @retval msqueue_pt: Referencia a la cola creada.
+*/
+msqueue_pt msqueue_init(size_t data_size){
+    // Comprobación de los límites de tamaño:
+    if ((data_size < MIN_DATA_SIZE) || (data_size > MAX_DATA_SIZE)){
+        return NULL;
+    }
+
+    // Reserva de memoria de la estructura (alineada a línea de caché):
+    msqueue_pt queue = (msqueue_pt)aligned_alloc(MSQUEUE_CACHE_LINE, sizeof(msqueue_t));
+    if (queue == NULL){
+        return NULL;
+    }
+
+    // Creación del nodo centinela inicial:
+    msq_node_pt sentinel = (msq_node_pt)malloc(sizeof(msq_node_t) + data_size);
+    if (sentinel == NULL){
+        free(queue);
+        return NULL;
+    }
+    sentinel->data = sentinel + 1;
+    atomic_init(&sentinel->next, NULL);
+
+    // Inicio de los miembros de la estructura:
+    atomic_init(&queue->head, sentinel);
+    atomic_init(&queue->tail, sentinel);
+    atomic_init(&queue->handles, NULL);
+    pthread_mutex_init(&queue->pool_lock, NULL);
+    queue->pool = NULL;
+    queue->pool_size = 0;
+    queue->data_size = data_size;
+
+    return queue;
+}
+
+/*
+    @brief Función para destruir y liberar una cola, sus nodos y los registros de hilos.
+    @note: Ningún hilo debe estar usando la cola; los manejadores registrados dejan de ser válidos.
+
+    @param msqueue_pt * queue: Referencia a la referencia de la cola.
+
+    @retval None.
+*/
+void msqueue_deinit(msqueue_pt * queue){
+    // Comprobación de que la cola no sea nula:
+    if ((queue == NULL) || (*queue == NULL)){
+        return;
+    }
+
+    // Liberación de los nodos de la cola (centinela incluido):
+    _msqueue_free_chain(atomic_load_explicit(&(*queue)->head, memory_order_relaxed));
+
+    // Liberación de los registros con sus nodos retirados y en caché:
+    msq_handle_pt temp_handle = atomic_load_explicit(&(*queue)->handles, memory_order_relaxed);
+    while (temp_handle != NULL){
+        msq_handle_pt temp_next_handle = temp_handle->next;
+        for (size_t i = 0; i < temp_handle->retired_count; i++){
+            free(temp_handle->retired[i]);
+        }
+        free(temp_handle->retired);
+        _msqueue_free_chain(temp_handle->cache);
+        free(temp_handle);
+        temp_handle = temp_next_handle;
+    }
+
+    // Liberación de la reserva común y de la estructura:
+    _msqueue_free_chain((*queue)->pool);
+    pthread_mutex_destroy(&(*queue)->pool_lock);
+    free(*queue);
+    *queue = NULL;
+}
+
+/*
+    @brief Función para registrar el hilo actual en la cola y obtener su manejador.
+    @note: Cada hilo que use la cola necesita su propio manejador (punteros de riesgo, nodos retirados y caché de nodos).
+    @note: Se reutilizan los registros de hilos que ya se dieron de baja.
+
+    @param msqueue_pt queue: Referencia a la cola.
+
+    @retval msq_handle_pt: Manejador del hilo (NULL si la cola no es válida o no hay memoria).
+*/
+msq_handle_pt msqueue_register(msqueue_pt queue){
+    // Comprobación de cola válida:
+    if (queue == NULL){
+        return NULL;
+    }
+
+    // Búsqueda de un registro inactivo para reutilizarlo:
+    for (msq_handle_pt temp_handle = atomic_load(&queue->handles); temp_handle != NULL; temp_handle = temp_handle->next){
+        bool expected = false;
+        if (!atomic_load_explicit(&temp_handle->active, memory_order_relaxed) &&
+            atomic_compare_exchange_strong(&temp_handle->active, &expected, true)){
+            return temp_handle;
+        }
+    }
+
+    // Creación de un registro nuevo:
+    msq_handle_pt handle = (msq_handle_pt)aligned_alloc(MSQUEUE_CACHE_LINE, sizeof(msq_handle_t));
+    if (handle == NULL){
+        return NULL;
+    }
+
+    handle->retired = (msq_node_pt *)malloc(MSQUEUE_RETIRE_THRESHOLD * sizeof(msq_node_pt));
+    if (handle->retired == NULL){
+        free(handle);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < MSQUEUE_HAZARDS; i++){
+        atomic_init(&handle->hazard[i], NULL);
+    }
+    atomic_init(&handle->active, true);
+    handle->retired_count = 0;
+    handle->retired_capacity = MSQUEUE_RETIRE_THRESHOLD;
+    handle->cache = NULL;
+    handle->cache_size = 0;
+
+    // Publicación del registro al principio de la lista:
+    msq_handle_pt temp_head = atomic_load(&queue->handles);
+    do {
+        handle->next = temp_head;
+    } while (!atomic_compare_exchange_weak(&queue->handles, &temp_head, handle));
+
+    return handle;
+}
+
+/*
+    @brief Función para dar de baja el manejador de un hilo.
+    @note: Los nodos retirados que sigan protegidos por otros hilos quedan en el registro para su siguiente dueño.
+
+    @param msqueue_pt queue: Referencia a la cola.
+    @param msq_handle_pt * handle: Referencia al manejador (se anula).
+
+    @retval None.
+*/
+void msqueue_unregister(msqueue_pt queue, msq_handle_pt * handle){
+    // Comprobación de cola y manejador válidos:
+    if ((queue == NULL) || (handle == NULL) || (*handle == NULL)){
+        return;
+    }
+
+    // Reutilización de los nodos retirados que ya no estén protegidos:
+    for (size_t i = 0; i < MSQUEUE_HAZARDS; i++){
+        atomic_store(&(*handle)->hazard[i], NULL);
+    }
+    _msqueue_scan(queue, *handle);
+
+    // Cesión de la caché local a la reserva común:
+    _msqueue_flush_cache(queue, *handle);
+
+    // Liberación del registro para otro hilo:
+    atomic_store_explicit(&(*handle)->active, false, memory_order_release);
+    *handle = NULL;
+}
+
+/*
+    @brief Función para insertar un elemento al final de la cola.
+
+    @param msqueue_pt queue: Referencia a la cola.
+    @param msq_handle_pt handle: Manejador del hilo que inserta.
+    @param const void * data: Referencia a los datos.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola, manejador o datos no válidos.
+                -> 2: Error en la creación del nodo.
+*/
+uint8_t msqueue_enqueue(msqueue_pt queue, msq_handle_pt handle, const void * data){
+    // Comprobación de cola, manejador y datos válidos:
+    if ((queue == NULL) || (handle == NULL) || (data == NULL)){
+        return 1;
+    }
+
+    // Obtención de un nodo (caché local, reserva común o memoria nueva) y copia de los datos:
+    msq_node_pt new_node = _msqueue_node_alloc(queue, handle);
+    if (new_node == NULL){
+        return 2;
+    }
+    memcpy(new_node->data, data, queue->data_size);
+    atomic_store_explicit(&new_node->next, NULL, memory_order_relaxed);
+
+    // Enlace del nodo tras el último (protegido con un puntero de riesgo):
+    msq_node_pt temp_tail;
+    while (true){
+        temp_tail = atomic_load(&queue->tail);
+        atomic_store(&handle->hazard[0], temp_tail);
+        if (temp_tail != atomic_load(&queue->tail)){
+            continue;
+        }
+
+        msq_node_pt temp_next = atomic_load(&temp_tail->next);
+        if (temp_tail != atomic_load(&queue->tail)){
+            continue;
+        }
+
+        // La cola va retrasada: se ayuda a avanzarla antes de reintentar:
+        if (temp_next != NULL){
+            atomic_compare_exchange_strong(&queue->tail, &temp_tail, temp_next);
+            continue;
+        }
+
+        if (atomic_compare_exchange_strong(&temp_tail->next, &temp_next, new_node)){
+            break;
+        }
+    }
+
+    // Avance de la cola (si falla, otro hilo ya la ha avanzado):
+    atomic_compare_exchange_strong(&queue->tail, &temp_tail, new_node);
+    atomic_store_explicit(&handle->hazard[0], NULL, memory_order_release);
+
+    return 0;
+}
+
+/*
+    @brief Función para extraer el primer elemento de la cola copiando sus datos.
+    @note: El centinela antiguo se retira y se reutiliza cuando ningún hilo lo tiene protegido.
+
+    @param msqueue_pt queue: Referencia a la cola.
+    @param msq_handle_pt handle: Manejador del hilo que extrae.
+    @param void * out_data: Referencia a la variable donde se copiarán los datos.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola, manejador o variable no válidos.
+                -> 2: La cola está vacía.
+*/
+uint8_t msqueue_try_dequeue(msqueue_pt queue, msq_handle_pt handle, void * out_data){
+    // Comprobación de cola, manejador y variable válidos:
+    if ((queue == NULL) || (handle == NULL) || (out_data == NULL)){
+        return 1;
+    }
+
+    // Avance de la cabeza (centinela y siguiente protegidos con punteros de riesgo):
+    msq_node_pt temp_head;
+    msq_node_pt temp_next;
+    while (true){
+        temp_head = atomic_load(&queue->head);
+        atomic_store(&handle->hazard[0], temp_head);
+        if (temp_head != atomic_load(&queue->head)){
+            continue;
+        }
+
+        msq_node_pt temp_tail = atomic_load(&queue->tail);
+        temp_next = atomic_load(&temp_head->next);
+        atomic_store(&handle->hazard[1], temp_next);
+        if (temp_head != atomic_load(&queue->head)){
+            continue;
+        }
+
+        if (temp_next == NULL){
+            atomic_store_explicit(&handle->hazard[0], NULL, memory_order_release);
+            atomic_store_explicit(&handle->hazard[1], NULL, memory_order_release);
+            return 2;
+        }
+
+        // La cola va retrasada respecto a la cabeza: se ayuda a avanzarla:
+        if (temp_head == temp_tail){
+            atomic_compare_exchange_strong(&queue->tail, &temp_tail, temp_next);
+            continue;
+        }
+
+        if (atomic_compare_exchange_strong(&queue->head, &temp_head, temp_next)){
+            break;
+        }
+    }
+
+    // Copia de los datos del nuevo centinela (sigue protegido, sus datos no cambian hasta reutilizarlo):
+    memcpy(out_data, temp_next->data, queue->data_size);
+    atomic_store_explicit(&handle->hazard[0], NULL, memory_order_release);
+    atomic_store_explicit(&handle->hazard[1], NULL, memory_order_release);
+
+    _msqueue_retire(queue, handle, temp_head);
+
+    return 0;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna para obtener un nodo libre: caché local, después reserva común y por último memoria nueva.
+    @note: De la reserva común se toma la cadena completa para amortizar el bloqueo.
+
+    @param msqueue_pt queue: Referencia a la cola.
+    @param msq_handle_pt handle: Manejador del hilo.
+
+    @retval msq_node_pt: Referencia al nodo (NULL si no hay memoria).
+*/
+static msq_node_pt _msqueue_node_alloc(msqueue_pt queue, msq_handle_pt handle){
+    // Recarga de la caché local desde la reserva común:
+    if (handle->cache == NULL){
+        pthread_mutex_lock(&queue->pool_lock);
+        handle->cache = queue->pool;
+        handle->cache_size = queue->pool_size;
+        queue->pool = NULL;
+        queue->pool_size = 0;
+        pthread_mutex_unlock(&queue->pool_lock);
+    }
+
+    // Extracción de la caché local:
+    if (handle->cache != NULL){
+        msq_node_pt node = handle->cache;
+        handle->cache = atomic_load_explicit(&node->next, memory_order_relaxed);
+        handle->cache_size--;
+        return node;
+    }
+
+    // Reserva de un nodo nuevo (datos a continuación del nodo):
+    msq_node_pt node = (msq_node_pt)malloc(sizeof(msq_node_t) + queue->data_size);
+    if (node == NULL){
+        return NULL;
+    }
+    node->data = node + 1;
+
+    return node;
+}
+
+/*
+    @brief Función interna para devolver un nodo libre a la caché local, cediéndola entera a la reserva común al llenarse.
+
+    @param msqueue_pt queue: Referencia a la cola.
+    @param msq_handle_pt handle: Manejador del hilo.
+    @param msq_node_pt node: Referencia al nodo.
+
+    @retval None.
+*/
+static void _msqueue_node_recycle(msqueue_pt queue, msq_handle_pt handle, msq_node_pt node){
+    atomic_store_explicit(&node->next, handle->cache, memory_order_relaxed);
+    handle->cache = node;
+    handle->cache_size++;
+
+    if (handle->cache_size >= MSQUEUE_CACHE_MAX){
+        _msqueue_flush_cache(queue, handle);
+    }
+}
+
+/*
+    @brief Función interna que cede la caché local completa a la reserva común (un solo bloqueo), o la libera si no cabe.
+
+    @param msqueue_pt queue: Referencia a la cola.
+    @param msq_handle_pt handle: Manejador del hilo.
+
+    @retval None.
+*/
+static void _msqueue_flush_cache(msqueue_pt queue, msq_handle_pt handle){
+    // Comprobación de caché no vacía:
+    if (handle->cache == NULL){
+        return;
+    }
+
+    // Búsqueda del último nodo de la caché:
+    msq_node_pt temp_last_node = handle->cache;
+    msq_node_pt temp_next_node;
+    while ((temp_next_node = atomic_load_explicit(&temp_last_node->next, memory_order_relaxed)) != NULL){
+        temp_last_node = temp_next_node;
+    }
+
+    // Traspaso de la cadena a la reserva común (si cabe):
+    msq_node_pt chain = handle->cache;
+    pthread_mutex_lock(&queue->pool_lock);
+    if (queue->pool_size + handle->cache_size <= MSQUEUE_POOL_MAX){
+        atomic_store_explicit(&temp_last_node->next, queue->pool, memory_order_relaxed);
+        queue->pool = chain;
+        queue->pool_size += handle->cache_size;
+        chain = NULL;
+    }
+    pthread_mutex_unlock(&queue->pool_lock);
+
+    _msqueue_free_chain(chain);
+    handle->cache = NULL;
+    handle->cache_size = 0;
+}
+
+/*
+    @brief Función interna para retirar un nodo extraído de la cola, buscando nodos reutilizables al superar el umbral.
+
+    @param msqueue_pt queue: Referencia a la cola.
+    @param msq_handle_pt handle: Manejador del hilo.
+    @param msq_node_pt node: Referencia al nodo retirado.
+
+    @retval None.
+*/
+static void _msqueue_retire(msqueue_pt queue, msq_handle_pt handle, msq_node_pt node){
+    // Ampliación del vector si los nodos protegidos lo mantienen lleno:
+    if (handle->retired_count == handle->retired_capacity){
+        msq_node_pt * temp_retired = (msq_node_pt *)realloc(handle->retired, 2 * handle->retired_capacity * sizeof(msq_node_pt));
+        if (temp_retired == NULL){
+            // Sin memoria para retirarlo: se espera a que deje de estar protegido.
+            while (_msqueue_is_hazard(queue, node)){
+                sched_yield();
+            }
+            _msqueue_node_recycle(queue, handle, node);
+            return;
+        }
+        handle->retired = temp_retired;
+        handle->retired_capacity *= 2;
+    }
+
+    handle->retired[handle->retired_count++] = node;
+    if (handle->retired_count >= MSQUEUE_RETIRE_THRESHOLD){
+        _msqueue_scan(queue, handle);
+    }
+}
+
+/*
+    @brief Función interna que reutiliza los nodos retirados por un hilo que ningún otro hilo tiene protegidos.
+
+    @param msqueue_pt queue: Referencia a la cola.
+    @param msq_handle_pt handle: Manejador del hilo.
+
+    @retval None.
+*/
+static void _msqueue_scan(msqueue_pt queue, msq_handle_pt handle){
+    size_t kept = 0;
+    for (size_t i = 0; i < handle->retired_count; i++){
+        msq_node_pt temp_node = handle->retired[i];
+        if (_msqueue_is_hazard(queue, temp_node)){
+            handle->retired[kept++] = temp_node;
+        } else {
+            _msqueue_node_recycle(queue, handle, temp_node);
+        }
+    }
+    handle->retired_count = kept;
+}
+
+/*
+    @brief Función interna que indica si algún hilo tiene protegido un nodo con un puntero de riesgo.
+
+    @param msqueue_pt queue: Referencia a la cola.
+    @param msq_node_pt node: Referencia al nodo.
+
+    @retval bool: true si está protegido, false en otro caso.
+*/
+static bool _msqueue_is_hazard(msqueue_pt queue, msq_node_pt node){
+    for (msq_handle_pt temp_handle = atomic_load(&queue->handles); temp_handle != NULL; temp_handle = temp_handle->next){
+        for (size_t i = 0; i < MSQUEUE_HAZARDS; i++){
+            if (atomic_load(&temp_handle->hazard[i]) == node){
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/*
+    @brief Función interna que libera una cadena de nodos enlazados por su siguiente.
+
+    @param msq_node_pt node: Referencia al primer nodo.
+
+    @retval None.
+*/
+static void _msqueue_free_chain(msq_node_pt node){
+    while (node != NULL){
+        msq_node_pt temp_next_node = atomic_load_explicit(&node->next, memory_order_relaxed);
+        free(node);
+        node = temp_next_node;
+    }
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
@@ -0,0 +1,90 @@
+#ifndef MSQUEUE_HEADER
+#define MSQUEUE_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define MIN_DATA_SIZE 1             // En bytes.
+#define MAX_DATA_SIZE 128           // En bytes.
+
+#define MSQUEUE_CACHE_LINE 64       // Tamaño (bytes) de la línea de caché usada para separar cabeza, cola y registros.
+#define MSQUEUE_HAZARDS 2           // Punteros de riesgo (hazard pointers) por hilo.
+#define MSQUEUE_RETIRE_THRESHOLD 64 // Nodos retirados por hilo antes de buscar los que ya se pueden reutilizar.
+#define MSQUEUE_CACHE_MAX 256       // Nodos libres en la caché local de un hilo antes de cederla entera a la reserva común.
+#define MSQUEUE_POOL_MAX 65536      // Nodos libres en la reserva común (por encima se liberan).
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos --------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct msq_node{
+    void * data;                            // Referencia a los datos (a continuación del nodo, misma reserva).
+    _Atomic(struct msq_node *) next;        // Referencia al siguiente nodo.
+};
+
+struct msq_handle{
+    _Alignas(MSQUEUE_CACHE_LINE) _Atomic(struct msq_node *) hazard[MSQUEUE_HAZARDS];  // Nodos protegidos por el hilo.
+    atomic_bool active;                     // Indica si el registro está asignado a un hilo.
+    struct msq_handle * next;               // Siguiente registro de la cola (inmutable tras publicarse).
+
+    struct msq_node ** retired;             // Nodos retirados pendientes de reutilizar.
+    size_t retired_count;                   // Número de nodos retirados.
+    size_t retired_capacity;                // Capacidad del vector de retirados.
+
+    struct msq_node * cache;                // Pila local de nodos libres.
+    size_t cache_size;                      // Número de nodos en la pila local.
+};
+
+struct msqueue{
+    _Alignas(MSQUEUE_CACHE_LINE) _Atomic(struct msq_node *) head;   // Nodo centinela (el primer elemento es su siguiente).
+    _Alignas(MSQUEUE_CACHE_LINE) _Atomic(struct msq_node *) tail;   // Último nodo (o penúltimo, de forma transitoria).
+    _Alignas(MSQUEUE_CACHE_LINE) _Atomic(struct msq_handle *) handles;  // Lista de registros de hilos.
+
+    pthread_mutex_t pool_lock;              // Protección de la reserva común de nodos libres.
+    struct msq_node * pool;                 // Reserva común de nodos libres.
+    size_t pool_size;                       // Número de nodos en la reserva común.
+    size_t data_size;                       // Tamaño (en bytes) de los datos de cada nodo.
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct msq_node msq_node_t;
+typedef msq_node_t * msq_node_pt;
+
+typedef struct msq_handle msq_handle_t;
+typedef msq_handle_t * msq_handle_pt;
+
+typedef struct msqueue msqueue_t;
+typedef msqueue_t * msqueue_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción de la cola:
+msqueue_pt msqueue_init(size_t data_size);
+void msqueue_deinit(msqueue_pt * queue);
+
+// Registro de hilos:
+msq_handle_pt msqueue_register(msqueue_pt queue);
+void msqueue_unregister(msqueue_pt queue, msq_handle_pt * handle);
+
+// Inserción y extracción (cualquier número de productores y consumidores):
+uint8_t msqueue_enqueue(msqueue_pt queue, msq_handle_pt handle, const void * data);
+uint8_t msqueue_try_dequeue(msqueue_pt queue, msq_handle_pt handle, void * out_data);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
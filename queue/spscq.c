@@ -0,0 +1,464 @@
+#include "spscq.h"
+
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static inline void _spscq_cpu_relax(void);
+static inline void _spscq_notify(atomic_uint * seq, atomic_bool * waiting);
+static void _spscq_block(spscq_pt queue, atomic_uint * seq, atomic_bool * waiting, bool producer);
+static void _spscq_copy_in(spscq_pt queue, size_t index, const void * data, size_t n);
+static void _spscq_copy_out(spscq_pt queue, size_t index, void * out_data, size_t n);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar una cola acotada sin bloqueos de un productor y un consumidor.
+    @note: Solo un hilo puede usar las operaciones de productor y solo otro las de consumidor.
+
+    @param size_t data_size: Tamaño del elemento en bytes.
+    @param size_t capacity: Capacidad mínima (número de elementos, se redondea a potencia de 2).
+    @param uint8_t wait_mode: Modo de espera de spscq_push / spscq_pop (SPSCQ_WAIT_SPIN o SPSCQ_WAIT_BLOCK).
+
+    @retval spscq_pt: Referencia a la cola creada.
+*/
+spscq_pt spscq_init(size_t data_size, size_t capacity, uint8_t wait_mode){
+    // Comprobación de los límites de tamaño, capacidad y modo de espera:
+    if ((data_size < MIN_DATA_SIZE) || (data_size > MAX_DATA_SIZE) || (capacity == 0) || (capacity > (SIZE_MAX / 2) / data_size)){
+        return NULL;
+    }
+
+    if ((wait_mode != SPSCQ_WAIT_SPIN) && (wait_mode != SPSCQ_WAIT_BLOCK)){
+        return NULL;
+    }
+
+    // Reserva de memoria de la estructura (alineada a línea de caché) y del buffer:
+    spscq_pt queue = (spscq_pt)aligned_alloc(SPSCQ_CACHE_LINE, sizeof(spscq_t));
+    if (queue == NULL){
+        return NULL;
+    }
+
+    size_t real_capacity = SPSCQ_MIN_CAPACITY;
+    while (real_capacity < capacity){
+        real_capacity *= 2;
+    }
+
+    queue->buffer = malloc(real_capacity * data_size);
+    if (queue->buffer == NULL){
+        free(queue);
+        return NULL;
+    }
+
+    // Inicio de los miembros de la estructura:
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->not_empty_seq, 0);
+    atomic_init(&queue->not_full_seq, 0);
+    atomic_init(&queue->consumer_waiting, false);
+    atomic_init(&queue->producer_waiting, false);
+    queue->cached_head = 0;
+    queue->cached_tail = 0;
+    queue->data_size = data_size;
+    queue->capacity = real_capacity;
+    queue->wait_mode = wait_mode;
+
+    return queue;
+}
+
+/*
+    @brief Función para destruir y liberar una cola (ningún hilo debe estar usándola).
+
+    @param spscq_pt * queue: Referencia a la referencia de la cola.
+
+    @retval None.
+*/
+void spscq_deinit(spscq_pt * queue){
+    // Comprobación de que la cola no sea nula:
+    if ((queue == NULL) || (*queue == NULL)){
+        return;
+    }
+
+    // Liberación del buffer y de la estructura:
+    free((*queue)->buffer);
+    free(*queue);
+    *queue = NULL;
+}
+
+/*
+    @brief Función (productor) para insertar un elemento sin esperar.
+    @note: El índice del consumidor solo se vuelve a leer (línea de caché remota) cuando la copia local indica cola llena.
+
+    @param spscq_pt queue: Referencia a la cola.
+    @param const void * data: Referencia al elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o elemento no válidos.
+                -> 2: La cola está llena.
+*/
+uint8_t spscq_try_push(spscq_pt queue, const void * data){
+    // Comprobación de cola y elemento válidos:
+    if ((queue == NULL) || (data == NULL)){
+        return 1;
+    }
+
+    // Comprobación de espacio libre (refrescando la copia del índice del consumidor solo si hace falta):
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    if ((tail - queue->cached_head) == queue->capacity){
+        queue->cached_head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        if ((tail - queue->cached_head) == queue->capacity){
+            return 2;
+        }
+    }
+
+    // Copia del elemento y publicación (release):
+    _spscq_copy_in(queue, tail, data, 1);
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+
+    if (queue->wait_mode == SPSCQ_WAIT_BLOCK){
+        _spscq_notify(&queue->not_empty_seq, &queue->consumer_waiting);
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función (consumidor) para extraer un elemento sin esperar.
+    @note: El índice del productor solo se vuelve a leer (línea de caché remota) cuando la copia local indica cola vacía.
+
+    @param spscq_pt queue: Referencia a la cola.
+    @param void * out_data: Referencia a la variable donde se copiará el elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o variable no válidas.
+                -> 2: La cola está vacía.
+*/
+uint8_t spscq_try_pop(spscq_pt queue, void * out_data){
+    // Comprobación de cola y variable válidas:
+    if ((queue == NULL) || (out_data == NULL)){
+        return 1;
+    }
+
+    // Comprobación de elementos disponibles (refrescando la copia del índice del productor solo si hace falta):
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if (head == queue->cached_tail){
+        queue->cached_tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        if (head == queue->cached_tail){
+            return 2;
+        }
+    }
+
+    // Copia del elemento y liberación de la ranura (release):
+    _spscq_copy_out(queue, head, out_data, 1);
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+
+    if (queue->wait_mode == SPSCQ_WAIT_BLOCK){
+        _spscq_notify(&queue->not_full_seq, &queue->producer_waiting);
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función (productor) para insertar hasta n elementos contiguos sin esperar, con una sola publicación.
+
+    @param spscq_pt queue: Referencia a la cola.
+    @param const void * data: Referencia a los n elementos, contiguos y de data_size bytes cada uno.
+    @param size_t n: Número máximo de elementos a insertar.
+
+    @retval size_t: Número de elementos insertados (los primeros del bloque).
+*/
+size_t spscq_push_n(spscq_pt queue, const void * data, size_t n){
+    // Comprobación de cola y elementos válidos:
+    if ((queue == NULL) || (data == NULL) || (n == 0)){
+        return 0;
+    }
+
+    // Cálculo del espacio libre (refrescando la copia del índice del consumidor si no basta):
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t free_slots = queue->capacity - (tail - queue->cached_head);
+    if (free_slots < n){
+        queue->cached_head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        free_slots = queue->capacity - (tail - queue->cached_head);
+    }
+
+    if (n > free_slots){
+        n = free_slots;
+    }
+
+    if (n == 0){
+        return 0;
+    }
+
+    // Copia de los elementos y publicación conjunta:
+    _spscq_copy_in(queue, tail, data, n);
+    atomic_store_explicit(&queue->tail, tail + n, memory_order_release);
+
+    if (queue->wait_mode == SPSCQ_WAIT_BLOCK){
+        _spscq_notify(&queue->not_empty_seq, &queue->consumer_waiting);
+    }
+
+    return n;
+}
+
+/*
+    @brief Función (consumidor) para extraer hasta n elementos sin esperar, con una sola liberación.
+
+    @param spscq_pt queue: Referencia a la cola.
+    @param void * out_data: Referencia al buffer de salida, de al menos n elementos.
+    @param size_t n: Número máximo de elementos a extraer.
+
+    @retval size_t: Número de elementos extraídos.
+*/
+size_t spscq_pop_n(spscq_pt queue, void * out_data, size_t n){
+    // Comprobación de cola y buffer válidos:
+    if ((queue == NULL) || (out_data == NULL) || (n == 0)){
+        return 0;
+    }
+
+    // Cálculo de los elementos disponibles (refrescando la copia del índice del productor si no bastan):
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t available = queue->cached_tail - head;
+    if (available < n){
+        queue->cached_tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        available = queue->cached_tail - head;
+    }
+
+    if (n > available){
+        n = available;
+    }
+
+    if (n == 0){
+        return 0;
+    }
+
+    // Copia de los elementos y liberación conjunta de las ranuras:
+    _spscq_copy_out(queue, head, out_data, n);
+    atomic_store_explicit(&queue->head, head + n, memory_order_release);
+
+    if (queue->wait_mode == SPSCQ_WAIT_BLOCK){
+        _spscq_notify(&queue->not_full_seq, &queue->producer_waiting);
+    }
+
+    return n;
+}
+
+/*
+    @brief Función (productor) para insertar un elemento, esperando mientras la cola esté llena.
+    @note: Espera activa hasta SPSCQ_SPIN_LIMIT intentos; después cede la CPU (SPSCQ_WAIT_SPIN) o duerme en un futex (SPSCQ_WAIT_BLOCK).
+
+    @param spscq_pt queue: Referencia a la cola.
+    @param const void * data: Referencia al elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o elemento no válidos.
+*/
+uint8_t spscq_push(spscq_pt queue, const void * data){
+    // Comprobación de cola y elemento válidos:
+    if ((queue == NULL) || (data == NULL)){
+        return 1;
+    }
+
+    // Reintentos con espera según el modo:
+    uint32_t spins = 0;
+    while (spscq_try_push(queue, data) != 0){
+        if (spins < SPSCQ_SPIN_LIMIT){
+            spins++;
+            _spscq_cpu_relax();
+        } else if (queue->wait_mode == SPSCQ_WAIT_SPIN){
+            sched_yield();
+        } else {
+            _spscq_block(queue, &queue->not_full_seq, &queue->producer_waiting, true);
+        }
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función (consumidor) para extraer un elemento, esperando mientras la cola esté vacía.
+    @note: Espera activa hasta SPSCQ_SPIN_LIMIT intentos; después cede la CPU (SPSCQ_WAIT_SPIN) o duerme en un futex (SPSCQ_WAIT_BLOCK).
+
+    @param spscq_pt queue: Referencia a la cola.
+    @param void * out_data: Referencia a la variable donde se copiará el elemento.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Cola o variable no válidas.
+*/
+uint8_t spscq_pop(spscq_pt queue, void * out_data){
+    // Comprobación de cola y variable válidas:
+    if ((queue == NULL) || (out_data == NULL)){
+        return 1;
+    }
+
+    // Reintentos con espera según el modo:
+    uint32_t spins = 0;
+    while (spscq_try_pop(queue, out_data) != 0){
+        if (spins < SPSCQ_SPIN_LIMIT){
+            spins++;
+            _spscq_cpu_relax();
+        } else if (queue->wait_mode == SPSCQ_WAIT_SPIN){
+            sched_yield();
+        } else {
+            _spscq_block(queue, &queue->not_empty_seq, &queue->consumer_waiting, false);
+        }
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna el número aproximado de elementos de la cola (exacto si no hay operaciones en curso).
+
+    @param const spscq_pt queue: Referencia a la cola.
+
+    @retval size_t: Número de elementos.
+*/
+size_t spscq_size(const spscq_pt queue){
+    // Comprobación de cola válida:
+    if (queue == NULL){
+        return 0;
+    }
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+    return (tail > head) ? tail - head : 0;
+}
+
+/*
+    @brief Función que retorna la capacidad de la cola.
+
+    @param const spscq_pt queue: Referencia a la cola.
+
+    @retval size_t: Capacidad (número de elementos).
+*/
+size_t spscq_capacity(const spscq_pt queue){
+    // Comprobación de cola válida:
+    if (queue == NULL){
+        return 0;
+    }
+
+    return queue->capacity;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna que indica a la CPU que el hilo está en espera activa.
+
+    @retval None.
+*/
+static inline void _spscq_cpu_relax(void){
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/*
+    @brief Función interna que despierta al hilo del otro extremo si ha indicado que va a dormir.
+    @note: La barrera seq_cst, emparejada con la de _spscq_block, impide que ambos lados se pierdan mutuamente (aviso perdido).
+
+    @param atomic_uint * seq: Referencia a la secuencia de avisos (palabra del futex).
+    @param atomic_bool * waiting: Referencia al indicador de espera del otro extremo.
+
+    @retval None.
+*/
+static inline void _spscq_notify(atomic_uint * seq, atomic_bool * waiting){
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(waiting, memory_order_relaxed)){
+        atomic_fetch_add_explicit(seq, 1, memory_order_release);
+        syscall(SYS_futex, seq, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+}
+
+/*
+    @brief Función interna que duerme en un futex hasta que el otro extremo avise, si la condición de espera se mantiene.
+
+    @param spscq_pt queue: Referencia a la cola.
+    @param atomic_uint * seq: Referencia a la secuencia de avisos (palabra del futex).
+    @param atomic_bool * waiting: Referencia al indicador de espera propio.
+    @param bool producer: Indica si espera el productor (cola llena) o el consumidor (cola vacía).
+
+    @retval None.
+*/
+static void _spscq_block(spscq_pt queue, atomic_uint * seq, atomic_bool * waiting, bool producer){
+    // Lectura de la secuencia antes de anunciar la espera (un aviso posterior hace fallar FUTEX_WAIT):
+    unsigned int expected = atomic_load_explicit(seq, memory_order_acquire);
+    atomic_store_explicit(waiting, true, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    // Nueva comprobación de la condición tras anunciar la espera:
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    bool must_wait = producer ? ((tail - head) == queue->capacity) : (tail == head);
+
+    if (must_wait){
+        syscall(SYS_futex, seq, FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+    }
+
+    atomic_store_explicit(waiting, false, memory_order_relaxed);
+}
+
+/*
+    @brief Función interna que copia n elementos al buffer circular a partir de un índice (a lo sumo dos tramos).
+
+    @param spscq_pt queue: Referencia a la cola.
+    @param size_t index: Índice (creciente) de la primera ranura.
+    @param const void * data: Referencia a los elementos.
+    @param size_t n: Número de elementos.
+
+    @retval None.
+*/
+static void _spscq_copy_in(spscq_pt queue, size_t index, const void * data, size_t n){
+    size_t slot = index & (queue->capacity - 1);
+    size_t first = queue->capacity - slot;
+    if (first > n){
+        first = n;
+    }
+
+    memcpy((uint8_t *)queue->buffer + (slot * queue->data_size), data, first * queue->data_size);
+    memcpy(queue->buffer, (const uint8_t *)data + (first * queue->data_size), (n - first) * queue->data_size);
+}
+
+/*
+    @brief Función interna que copia n elementos desde el buffer circular a partir de un índice (a lo sumo dos tramos).
+
+    @param spscq_pt queue: Referencia a la cola.
+    @param size_t index: Índice (creciente) de la primera ranura.
+    @param void * out_data: Referencia al buffer de salida.
+    @param size_t n: Número de elementos.
+
+    @retval None.
+*/
+static void _spscq_copy_out(spscq_pt queue, size_t index, void * out_data, size_t n){
+    size_t slot = index & (queue->capacity - 1);
+    size_t first = queue->capacity - slot;
+    if (first > n){
+        first = n;
+    }
+
+    memcpy(out_data, (uint8_t *)queue->buffer + (slot * queue->data_size), first * queue->data_size);
+    memcpy((uint8_t *)out_data + (first * queue->data_size), queue->buffer, (n - first) * queue->data_size);
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
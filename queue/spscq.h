@@ -0,0 +1,83 @@
+#ifndef SPSCQ_HEADER
+#define SPSCQ_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdatomic.h>
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define MIN_DATA_SIZE 1             // En bytes.
+#define MAX_DATA_SIZE 128           // En bytes.
+
+#define SPSCQ_CACHE_LINE 64         // Tamaño (bytes) de la línea de caché usada para separar índices.
+#define SPSCQ_MIN_CAPACITY 2        // En número de elementos (potencia de 2).
+#define SPSCQ_SPIN_LIMIT 1024       // Iteraciones de espera activa antes de ceder la CPU o dormir.
+
+#define SPSCQ_WAIT_SPIN 0           // Espera activa (pausa de CPU y cesión periódica del procesador).
+#define SPSCQ_WAIT_BLOCK 1          // Espera activa breve y después bloqueo en futex.
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos --------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct spscq{
+    // Línea del productor:
+    _Alignas(SPSCQ_CACHE_LINE) atomic_size_t tail;  // Índice (creciente) de la siguiente escritura.
+    size_t cached_head;                             // Copia local del índice del consumidor.
+
+    // Línea del consumidor:
+    _Alignas(SPSCQ_CACHE_LINE) atomic_size_t head;  // Índice (creciente) de la siguiente lectura.
+    size_t cached_tail;                             // Copia local del índice del productor.
+
+    // Palabras de espera (solo modo bloqueante):
+    _Alignas(SPSCQ_CACHE_LINE) atomic_uint not_empty_seq;  // Secuencia de avisos al consumidor (futex).
+    atomic_uint not_full_seq;                       // Secuencia de avisos al productor (futex).
+    atomic_bool consumer_waiting;                   // Indica que el consumidor está (o va a estar) dormido.
+    atomic_bool producer_waiting;                   // Indica que el productor está (o va a estar) dormido.
+
+    // Datos de solo lectura tras la creación:
+    _Alignas(SPSCQ_CACHE_LINE) void * buffer;       // Buffer circular de elementos.
+    size_t data_size;                               // Tamaño (bytes) del elemento.
+    size_t capacity;                                // Capacidad (número de elementos, potencia de 2).
+    uint8_t wait_mode;                              // Modo de espera de las operaciones bloqueantes.
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct spscq spscq_t;
+typedef spscq_t * spscq_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción de la cola:
+spscq_pt spscq_init(size_t data_size, size_t capacity, uint8_t wait_mode);
+void spscq_deinit(spscq_pt * queue);
+
+// Operaciones sin espera (productor / consumidor):
+uint8_t spscq_try_push(spscq_pt queue, const void * data);
+uint8_t spscq_try_pop(spscq_pt queue, void * out_data);
+size_t spscq_push_n(spscq_pt queue, const void * data, size_t n);
+size_t spscq_pop_n(spscq_pt queue, void * out_data, size_t n);
+
+// Operaciones con espera (productor / consumidor):
+uint8_t spscq_push(spscq_pt queue, const void * data);
+uint8_t spscq_pop(spscq_pt queue, void * out_data);
+
+// Utilidades generales:
+size_t spscq_size(const spscq_pt queue);
+size_t spscq_capacity(const spscq_pt queue);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
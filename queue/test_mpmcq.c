@@ -0,0 +1,101 @@
+#include "mpmcq.h"
+#include <stdio.h>
+#include <pthread.h>
+
+#define TEST_THREADS 3
+#define TEST_MESSAGES 30000
+
+// Prototipos de funciones:
+void * producer_thread(void * arg);
+void * consumer_thread(void * arg);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de una cola de uint32_t (la capacidad se redondea a potencia de 2):
+    mpmcq_pt queue = mpmcq_init(sizeof(uint32_t), 5);
+    printf("\nSe ha creado la cola correctamente en la dirección (%p), capacidad: %ld\n", (void *)queue, mpmcq_capacity(queue));
+
+    // Inserción hasta llenar la cola:
+    uint32_t value = 0;
+    while (mpmcq_try_push(queue, &value) == 0){
+        value++;
+    }
+    printf("Insertados %u elementos antes de llenar la cola, tamaño: %ld\n", value, mpmcq_size(queue));
+
+    // Extracción y reinserción por bloques (un único CAS por bloque):
+    uint32_t out[8];
+    size_t popped = mpmcq_pop_n(queue, out, 3);
+    printf("Extraídos por bloque %ld elementos: %u %u %u\n", popped, out[0], out[1], out[2]);
+
+    uint32_t block[4] = {100, 101, 102, 103};
+    size_t pushed = mpmcq_push_n(queue, block, 4);
+    printf("Insertados por bloque %ld de 4 elementos (espacio libre: 3)\n", pushed);
+
+    popped = mpmcq_pop_n(queue, out, 8);
+    printf("Extraídos por bloque %ld elementos:", popped);
+    for (size_t i = 0; i < popped; i++){
+        printf(" %u", out[i]);
+    }
+    printf("\nCola vacía (try_pop retorna %d)\n", mpmcq_try_pop(queue, &value));
+
+    // Varios productores y consumidores con operaciones bloqueantes:
+    pthread_t producers[TEST_THREADS];
+    pthread_t consumers[TEST_THREADS];
+    for (size_t i = 0; i < TEST_THREADS; i++){
+        pthread_create(&producers[i], NULL, producer_thread, queue);
+        pthread_create(&consumers[i], NULL, consumer_thread, queue);
+    }
+
+    uint64_t sum = 0;
+    for (size_t i = 0; i < TEST_THREADS; i++){
+        pthread_join(producers[i], NULL);
+        void * partial;
+        pthread_join(consumers[i], &partial);
+        sum += (uintptr_t)partial;
+    }
+
+    uint64_t expected = (uint64_t)TEST_THREADS * TEST_MESSAGES * (TEST_MESSAGES - 1) / 2;
+    printf("\n%d productores y %d consumidores bloqueantes, suma correcta: %s\n", TEST_THREADS, TEST_THREADS, (sum == expected) ? "sí" : "no");
+
+    // Destrucción de la cola:
+    mpmcq_deinit(&queue);
+    printf("\nCola destruida, referencia: %p\n", (void *)queue);
+
+    return 0;
+}
+
+/*
+    @brief Función del hilo productor: inserta TEST_MESSAGES valores consecutivos.
+
+    @param void * arg: Referencia a la cola (mpmcq_pt).
+
+    @retval void *: NULL.
+*/
+void * producer_thread(void * arg){
+    mpmcq_pt queue = (mpmcq_pt)arg;
+    for (uint32_t i = 0; i < TEST_MESSAGES; i++){
+        mpmcq_push(queue, &i);
+    }
+
+    return NULL;
+}
+
+/*
+    @brief Función del hilo consumidor: extrae TEST_MESSAGES valores y retorna su suma.
+
+    @param void * arg: Referencia a la cola (mpmcq_pt).
+
+    @retval void *: Suma de los valores recibidos (uintptr_t).
+*/
+void * consumer_thread(void * arg){
+    mpmcq_pt queue = (mpmcq_pt)arg;
+    uint64_t sum = 0;
+    uint32_t value;
+    for (uint32_t i = 0; i < TEST_MESSAGES; i++){
+        mpmcq_pop(queue, &value);
+        sum += value;
+    }
+
+    return (void *)(uintptr_t)sum;
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "msqueue.h"
+#include <stdio.h>
+
+#define TEST_THREADS 2
+#define TEST_MESSAGES 50000
+
+struct test_args{
+    msqueue_pt queue;               // Cola compartida.
+    atomic_size_t * received;       // Número total de mensajes recibidos.
+    uint64_t sum;                   // Suma de los mensajes recibidos por el hilo.
+};
+
+// Prototipos de funciones:
+void * producer_thread(void * arg);
+void * consumer_thread(void * arg);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de una cola de uint32_t y registro del hilo principal:
+    msqueue_pt queue = msqueue_init(sizeof(uint32_t));
+    msq_handle_pt handle = msqueue_register(queue);
+    printf("\nSe ha creado la cola correctamente en la dirección (%p), manejador: (%p)\n", (void *)queue, (void *)handle);
+
+    // Inserción y extracción desde un solo hilo (orden FIFO):
+    for (uint32_t i = 1; i <= 5; i++){
+        msqueue_enqueue(queue, handle, &i);
+    }
+
+    uint32_t value;
+    printf("Extraídos:");
+    while (msqueue_try_dequeue(queue, handle, &value) == 0){
+        printf(" %u", value);
+    }
+    printf("\nCola vacía (try_dequeue retorna %d)\n", msqueue_try_dequeue(queue, handle, &value));
+    msqueue_unregister(queue, &handle);
+
+    // Varios productores y consumidores concurrentes:
+    pthread_t producers[TEST_THREADS];
+    pthread_t consumers[TEST_THREADS];
+    atomic_size_t received = 0;
+    struct test_args args[TEST_THREADS];
+    for (size_t i = 0; i < TEST_THREADS; i++){
+        args[i] = (struct test_args){.queue = queue, .received = &received, .sum = 0};
+        pthread_create(&producers[i], NULL, producer_thread, queue);
+        pthread_create(&consumers[i], NULL, consumer_thread, &args[i]);
+    }
+
+    uint64_t sum = 0;
+    for (size_t i = 0; i < TEST_THREADS; i++){
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+        sum += args[i].sum;
+    }
+
+    uint64_t expected = (uint64_t)TEST_THREADS * TEST_MESSAGES * (TEST_MESSAGES - 1) / 2;
+    printf("\n%d productores y %d consumidores: recibidos %ld mensajes, suma correcta: %s\n",
+           TEST_THREADS, TEST_THREADS, (size_t)received, (sum == expected) ? "sí" : "no");
+
+    // Destrucción de la cola:
+    msqueue_deinit(&queue);
+    printf("\nCola destruida, referencia: %p\n", (void *)queue);
+
+    return 0;
+}
+
+/*
+    @brief Función del hilo productor: inserta TEST_MESSAGES valores consecutivos.
+
+    @param void * arg: Referencia a la cola (msqueue_pt).
+
+    @retval void *: NULL.
+*/
+void * producer_thread(void * arg){
+    msqueue_pt queue = (msqueue_pt)arg;
+    msq_handle_pt handle = msqueue_register(queue);
+    for (uint32_t i = 0; i < TEST_MESSAGES; i++){
+        msqueue_enqueue(queue, handle, &i);
+    }
+    msqueue_unregister(queue, &handle);
+
+    return NULL;
+}
+
+/*
+    @brief Función del hilo consumidor: extrae mensajes hasta que se han recibido todos.
+
+    @param void * arg: Referencia a los argumentos (struct test_args).
+
+    @retval void *: NULL.
+*/
+void * consumer_thread(void * arg){
+    struct test_args * args = (struct test_args *)arg;
+    msq_handle_pt handle = msqueue_register(args->queue);
+    uint32_t value;
+    while (atomic_load(args->received) < (size_t)TEST_THREADS * TEST_MESSAGES){
+        if (msqueue_try_dequeue(args->queue, handle, &value) == 0){
+            args->sum += value;
+            atomic_fetch_add(args->received, 1);
+        }
+    }
+    msqueue_unregister(args->queue, &handle);
+
+    return NULL;
+}
\ No newline at end of file
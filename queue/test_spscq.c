@@ -0,0 +1,80 @@
+#include "spscq.h"
+#include <stdio.h>
+#include <pthread.h>
+
+#define TEST_MESSAGES 100000
+
+// Prototipos de funciones:
+void * producer_thread(void * arg);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de una cola de uint32_t (la capacidad se redondea a potencia de 2):
+    spscq_pt queue = spscq_init(sizeof(uint32_t), 6, SPSCQ_WAIT_BLOCK);
+    printf("\nSe ha creado la cola correctamente en la dirección (%p), capacidad: %ld\n", (void *)queue, spscq_capacity(queue));
+
+    // Inserción hasta llenar la cola (un único hilo hace de productor y consumidor):
+    uint32_t value = 0;
+    while (spscq_try_push(queue, &value) == 0){
+        value++;
+    }
+    printf("Insertados %u elementos antes de llenar la cola, tamaño: %ld\n", value, spscq_size(queue));
+
+    // Extracción de unos pocos y reinserción por bloques (el bloque da la vuelta al buffer):
+    spscq_try_pop(queue, &value);
+    printf("Extraído: %u, ", value);
+    spscq_try_pop(queue, &value);
+    printf("extraído: %u, ", value);
+    spscq_try_pop(queue, &value);
+    printf("extraído: %u\n", value);
+
+    uint32_t block[4] = {100, 101, 102, 103};
+    size_t pushed = spscq_push_n(queue, block, 4);
+    printf("Insertados por bloque %ld de 4 elementos (espacio libre: 3)\n", pushed);
+
+    uint32_t out[8];
+    size_t popped = spscq_pop_n(queue, out, 8);
+    printf("Extraídos por bloque %ld elementos:", popped);
+    for (size_t i = 0; i < popped; i++){
+        printf(" %u", out[i]);
+    }
+    printf("\nCola vacía: %s (try_pop retorna %d)\n", (spscq_size(queue) == 0) ? "sí" : "no", spscq_try_pop(queue, &value));
+
+    // Traspaso entre dos hilos con espera bloqueante (la cola es muy pequeña para forzar esperas):
+    pthread_t producer;
+    pthread_create(&producer, NULL, producer_thread, queue);
+
+    uint32_t expected = 0;
+    bool in_order = true;
+    for (uint32_t i = 0; i < TEST_MESSAGES; i++){
+        spscq_pop(queue, &value);
+        if (value != expected++){
+            in_order = false;
+        }
+    }
+    pthread_join(producer, NULL);
+    printf("\nRecibidos %d mensajes de otro hilo, en orden: %s\n", TEST_MESSAGES, in_order ? "sí" : "no");
+
+    // Destrucción de la cola:
+    spscq_deinit(&queue);
+    printf("\nCola destruida, referencia: %p\n", (void *)queue);
+
+    return 0;
+}
+
+/*
+    @brief Función del hilo productor: envía TEST_MESSAGES valores consecutivos.
+
+    @param void * arg: Referencia a la cola (spscq_pt).
+
+    @retval void *: NULL.
+*/
+void * producer_thread(void * arg){
+    spscq_pt queue = (spscq_pt)arg;
+    for (uint32_t i = 0; i < TEST_MESSAGES; i++){
+        spscq_push(queue, &i);
+    }
+
+    return NULL;
+}
\ No newline at end of file
@@ -0,0 +1,660 @@
+#include "aggstack.h"
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static void _aggstack_fill(const aggstack_pt aggstack, uint8_t * entry, const uint8_t * below);
+static void _aggstack_move_top(aggstack_pt src, aggstack_pt dst);
+static const uint8_t * _aggstack_top(const aggstack_pt aggstack);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar una pila agregada: cada entrada guarda, junto al elemento, el mínimo, el máximo
+           y el pliegue de usuario de todos los elementos desde el fondo hasta ella, de modo que se consultan en O(1).
+    @note: El pliegue debe ser asociativo: fold_fn acumula un elemento a la derecha del acumulador y combine_fn combina un
+           acumulador con otro posterior (acumulador = acumulador ⊕ posterior), con identity como valor neutro.
+    @note: El tamaño de la entrada (elemento, mínimo y máximo si hay comparador, y acumulador) no puede superar MAX_DATA_SIZE.
+
+    @param size_t element_size: Tamaño (bytes) del elemento.
+    @param int (*cmp_fn)(const void *, const void *): Función comparadora (al estilo de qsort; NULL: sin mínimo ni máximo).
+    @param size_t acc_size: Tamaño (bytes) del acumulador (0: sin pliegue de usuario).
+    @param const void * identity: Valor neutro del acumulador (se copia).
+    @param void (*fold_fn)(void *, const void *, void *): Acumulación de un elemento (acumulador, elemento, contexto).
+    @param void (*combine_fn)(void *, const void *, void *): Combinación de acumuladores (acumulador, acumulador posterior, contexto).
+    @param void * ctx: Contexto de usuario del pliegue (puede ser nulo).
+
+    @retval aggstack_pt: Referencia a la pila creada (NULL si los parámetros no son válidos o no hay memoria).
+*/
+aggstack_pt aggstack_init(size_t element_size, int (*cmp_fn)(const void *, const void *), size_t acc_size, const void * identity,
+                          void (*fold_fn)(void *, const void *, void *), void (*combine_fn)(void *, const void *, void *), void * ctx){
+    // Comprobación de parámetros válidos (el pliegue requiere sus tres componentes):
+    if ((element_size < MIN_DATA_SIZE) || ((acc_size > 0) && ((identity == NULL) || (fold_fn == NULL) || (combine_fn == NULL)))){
+        return NULL;
+    }
+
+    // Distribución de la entrada: elemento | mínimo | máximo | acumulador (alineado):
+    size_t min_offset = element_size;
+    size_t max_offset = min_offset + ((cmp_fn != NULL) ? element_size : 0);
+    size_t acc_offset = max_offset + ((cmp_fn != NULL) ? element_size : 0);
+    if (acc_size > 0){
+        acc_offset = (acc_offset + AGGSTACK_ACC_ALIGN - 1) / AGGSTACK_ACC_ALIGN * AGGSTACK_ACC_ALIGN;
+    }
+    if (acc_offset + acc_size > MAX_DATA_SIZE){
+        return NULL;
+    }
+
+    // Reserva de memoria de la estructura, de la pila y del valor neutro:
+    aggstack_pt aggstack = (aggstack_pt)malloc(sizeof(aggstack_t));
+    if (aggstack == NULL){
+        return NULL;
+    }
+
+    aggstack->stack = stack_init(acc_offset + acc_size);
+    aggstack->identity = (acc_size > 0) ? malloc(acc_size) : NULL;
+    if ((aggstack->stack == NULL) || ((acc_size > 0) && (aggstack->identity == NULL))){
+        stack_deinit(&aggstack->stack);
+        free(aggstack->identity);
+        free(aggstack);
+        return NULL;
+    }
+
+    // Inicio de los miembros de la estructura:
+    if (acc_size > 0){
+        memcpy(aggstack->identity, identity, acc_size);
+    }
+    aggstack->element_size = element_size;
+    aggstack->acc_size = acc_size;
+    aggstack->min_offset = min_offset;
+    aggstack->max_offset = max_offset;
+    aggstack->acc_offset = acc_offset;
+    aggstack->cmp_fn = cmp_fn;
+    aggstack->fold_fn = fold_fn;
+    aggstack->combine_fn = combine_fn;
+    aggstack->ctx = ctx;
+    aggstack->prepend = false;
+    aggstack->free_nodes = NULL;
+
+    return aggstack;
+}
+
+/*
+    @brief Función para destruir y liberar una pila agregada.
+
+    @param aggstack_pt * aggstack: Referencia a la referencia de la pila.
+
+    @retval None.
+*/
+void aggstack_deinit(aggstack_pt * aggstack){
+    // Comprobación de que la pila no sea nula:
+    if ((aggstack == NULL) || (*aggstack == NULL)){
+        return;
+    }
+
+    // Liberación de los nodos reservados para reutilizar y de la pila:
+    stack_node_pt temp_node = (*aggstack)->free_nodes;
+    while (temp_node != NULL){
+        stack_node_pt temp_next_node = temp_node->next;
+        free(temp_node->data);
+        free(temp_node);
+        temp_node = temp_next_node;
+    }
+
+    stack_deinit(&(*aggstack)->stack);
+    free((*aggstack)->identity);
+
+    free(*aggstack);
+    *aggstack = NULL;
+}
+
+/*
+    @brief Función para introducir un elemento en la pila, calculando sus agregados a partir de la entrada inferior. Coste O(1).
+    @note: Se reutilizan los nodos extraídos antes de reservar uno nuevo con stack_push.
+
+    @param aggstack_pt aggstack: Referencia a la pila.
+    @param const void * element: Referencia al elemento.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Pila o elemento no válidos.
+                    -> 2: Error en la creación del nuevo nodo.
+*/
+uint8_t aggstack_push(aggstack_pt aggstack, const void * element){
+    // Comprobación de pila y elemento válidos:
+    if ((aggstack == NULL) || (element == NULL)){
+        return 1;
+    }
+
+    // Reutilización de un nodo extraído (composición de la entrada en sitio):
+    stack_node_pt temp_node = aggstack->free_nodes;
+    if (temp_node != NULL){
+        aggstack->free_nodes = temp_node->next;
+        memcpy(temp_node->data, element, aggstack->element_size);
+        _aggstack_fill(aggstack, (uint8_t *)temp_node->data, _aggstack_top(aggstack));
+        temp_node->next = aggstack->stack->top;
+        aggstack->stack->top = temp_node;
+        aggstack->stack->size++;
+        return 0;
+    }
+
+    // Composición de la entrada y alta en la pila con un nodo nuevo:
+    _Alignas(AGGSTACK_ACC_ALIGN) uint8_t entry[MAX_DATA_SIZE];
+    memcpy(entry, element, aggstack->element_size);
+    _aggstack_fill(aggstack, entry, _aggstack_top(aggstack));
+
+    return (stack_push(aggstack->stack, entry) == 0) ? 0 : 2;
+}
+
+/*
+    @brief Función para extraer el elemento de la cima de la pila. Coste O(1).
+    @note: Los agregados de la pila pasan a ser los guardados en la entrada inferior (no se recalculan).
+    @note: El nodo se guarda para reutilizarlo en inserciones posteriores (se libera al destruir la pila).
+
+    @param aggstack_pt aggstack: Referencia a la pila.
+    @param void * out_element: Referencia donde copiar el elemento (puede ser nula).
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Pila no válida.
+                    -> 2: La pila está vacía.
+*/
+uint8_t aggstack_pop(aggstack_pt aggstack, void * out_element){
+    // Comprobación de pila válida y no vacía:
+    if (aggstack == NULL){
+        return 1;
+    }
+
+    if (stack_is_empty(aggstack->stack)){
+        return 2;
+    }
+
+    // Desenlace del nodo de la cima, copia del elemento y traslado a los nodos para reutilizar:
+    stack_node_pt temp_node = aggstack->stack->top;
+    aggstack->stack->top = temp_node->next;
+    aggstack->stack->size--;
+    if (out_element != NULL){
+        memcpy(out_element, temp_node->data, aggstack->element_size);
+    }
+    temp_node->next = aggstack->free_nodes;
+    aggstack->free_nodes = temp_node;
+
+    return 0;
+}
+
+/*
+    @brief Función para consultar el elemento de la cima de la pila sin extraerlo.
+
+    @param const aggstack_pt aggstack: Referencia a la pila.
+    @param void * out_element: Referencia donde copiar el elemento.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Pila o referencia no válidas.
+                    -> 2: La pila está vacía.
+*/
+uint8_t aggstack_peek(const aggstack_pt aggstack, void * out_element){
+    // Comprobación de pila y referencia válidas:
+    if ((aggstack == NULL) || (out_element == NULL)){
+        return 1;
+    }
+
+    const uint8_t * top = _aggstack_top(aggstack);
+    if (top == NULL){
+        return 2;
+    }
+    memcpy(out_element, top, aggstack->element_size);
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna el mínimo de los elementos de la pila. Coste O(1).
+
+    @param const aggstack_pt aggstack: Referencia a la pila.
+    @param void * out_element: Referencia donde copiar el mínimo.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Pila o referencia no válidas, o pila sin comparador.
+                    -> 2: La pila está vacía.
+*/
+uint8_t aggstack_min(const aggstack_pt aggstack, void * out_element){
+    // Comprobación de pila, comparador y referencia válidos:
+    if ((aggstack == NULL) || (aggstack->cmp_fn == NULL) || (out_element == NULL)){
+        return 1;
+    }
+
+    const uint8_t * top = _aggstack_top(aggstack);
+    if (top == NULL){
+        return 2;
+    }
+    memcpy(out_element, top + aggstack->min_offset, aggstack->element_size);
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna el máximo de los elementos de la pila. Coste O(1).
+
+    @param const aggstack_pt aggstack: Referencia a la pila.
+    @param void * out_element: Referencia donde copiar el máximo.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Pila o referencia no válidas, o pila sin comparador.
+                    -> 2: La pila está vacía.
+*/
+uint8_t aggstack_max(const aggstack_pt aggstack, void * out_element){
+    // Comprobación de pila, comparador y referencia válidos:
+    if ((aggstack == NULL) || (aggstack->cmp_fn == NULL) || (out_element == NULL)){
+        return 1;
+    }
+
+    const uint8_t * top = _aggstack_top(aggstack);
+    if (top == NULL){
+        return 2;
+    }
+    memcpy(out_element, top + aggstack->max_offset, aggstack->element_size);
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna el pliegue de usuario de los elementos de la pila (del fondo a la cima). Coste O(1).
+    @note: Con la pila vacía se retorna el valor neutro.
+
+    @param const aggstack_pt aggstack: Referencia a la pila.
+    @param void * out_acc: Referencia donde copiar el acumulador.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Pila o referencia no válidas, o pila sin pliegue de usuario.
+*/
+uint8_t aggstack_aggregate(const aggstack_pt aggstack, void * out_acc){
+    // Comprobación de pila, pliegue y referencia válidos:
+    if ((aggstack == NULL) || (aggstack->acc_size == 0) || (out_acc == NULL)){
+        return 1;
+    }
+
+    const uint8_t * top = _aggstack_top(aggstack);
+    memcpy(out_acc, (top != NULL) ? top + aggstack->acc_offset : (const uint8_t *)aggstack->identity, aggstack->acc_size);
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna si la pila está o no vacía.
+
+    @param const aggstack_pt aggstack: Referencia a la pila.
+
+    @retval bool: true si la pila está vacía (o no es válida).
+*/
+bool aggstack_is_empty(const aggstack_pt aggstack){
+    // Comprobación de pila válida:
+    if (aggstack == NULL){
+        return true;
+    }
+
+    return stack_is_empty(aggstack->stack);
+}
+
+/*
+    @brief Función que retorna el número de elementos de la pila.
+
+    @param const aggstack_pt aggstack: Referencia a la pila.
+
+    @retval size_t: Número de elementos (0 si la pila no es válida).
+*/
+size_t aggstack_get_size(const aggstack_pt aggstack){
+    // Comprobación de pila válida:
+    if (aggstack == NULL){
+        return 0;
+    }
+
+    return stack_get_size(aggstack->stack);
+}
+
+/*
+    @brief Función para crear e inicializar una cola de dos pilas agregadas (ventana deslizante con agregados en O(1)).
+    @note: Se insertan elementos en la pila de entrada; al extraer con la pila de salida vacía, se trasladan a ella todos
+           los nodos de la de entrada (sin reservar memoria), recalculando sus agregados. Coste O(1) amortizado.
+    @note: Los parámetros tienen el mismo significado que en aggstack_init; el pliegue recorre la cola del más antiguo al más reciente.
+
+    @param size_t element_size: Tamaño (bytes) del elemento.
+    @param int (*cmp_fn)(const void *, const void *): Función comparadora (al estilo de qsort; NULL: sin mínimo ni máximo).
+    @param size_t acc_size: Tamaño (bytes) del acumulador (0: sin pliegue de usuario).
+    @param const void * identity: Valor neutro del acumulador (se copia).
+    @param void (*fold_fn)(void *, const void *, void *): Acumulación de un elemento (acumulador, elemento, contexto).
+    @param void (*combine_fn)(void *, const void *, void *): Combinación de acumuladores (acumulador, acumulador posterior, contexto).
+    @param void * ctx: Contexto de usuario del pliegue (puede ser nulo).
+
+    @retval aggqueue_pt: Referencia a la cola creada (NULL si los parámetros no son válidos o no hay memoria).
+*/
+aggqueue_pt aggqueue_init(size_t element_size, int (*cmp_fn)(const void *, const void *), size_t acc_size, const void * identity,
+                          void (*fold_fn)(void *, const void *, void *), void (*combine_fn)(void *, const void *, void *), void * ctx){
+    // Reserva de memoria de la estructura:
+    aggqueue_pt aggqueue = (aggqueue_pt)malloc(sizeof(aggqueue_t));
+    if (aggqueue == NULL){
+        return NULL;
+    }
+
+    // Creación de las dos pilas (la de salida acumula cada elemento nuevo por la izquierda):
+    aggqueue->in = aggstack_init(element_size, cmp_fn, acc_size, identity, fold_fn, combine_fn, ctx);
+    aggqueue->out = aggstack_init(element_size, cmp_fn, acc_size, identity, fold_fn, combine_fn, ctx);
+    if ((aggqueue->in == NULL) || (aggqueue->out == NULL)){
+        aggstack_deinit(&aggqueue->in);
+        aggstack_deinit(&aggqueue->out);
+        free(aggqueue);
+        return NULL;
+    }
+    aggqueue->out->prepend = true;
+
+    return aggqueue;
+}
+
+/*
+    @brief Función para destruir y liberar una cola de dos pilas.
+
+    @param aggqueue_pt * aggqueue: Referencia a la referencia de la cola.
+
+    @retval None.
+*/
+void aggqueue_deinit(aggqueue_pt * aggqueue){
+    // Comprobación de que la cola no sea nula:
+    if ((aggqueue == NULL) || (*aggqueue == NULL)){
+        return;
+    }
+
+    aggstack_deinit(&(*aggqueue)->in);
+    aggstack_deinit(&(*aggqueue)->out);
+
+    free(*aggqueue);
+    *aggqueue = NULL;
+}
+
+/*
+    @brief Función para insertar un elemento al final de la cola. Coste O(1).
+
+    @param aggqueue_pt aggqueue: Referencia a la cola.
+    @param const void * element: Referencia al elemento.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Cola o elemento no válidos.
+                    -> 2: Error en la creación del nuevo nodo.
+*/
+uint8_t aggqueue_push(aggqueue_pt aggqueue, const void * element){
+    // Comprobación de cola válida:
+    if (aggqueue == NULL){
+        return 1;
+    }
+
+    return aggstack_push(aggqueue->in, element);
+}
+
+/*
+    @brief Función para extraer el elemento más antiguo de la cola. Coste O(1) amortizado.
+
+    @param aggqueue_pt aggqueue: Referencia a la cola.
+    @param void * out_element: Referencia donde copiar el elemento (puede ser nula).
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Cola no válida.
+                    -> 2: La cola está vacía.
+*/
+uint8_t aggqueue_pop(aggqueue_pt aggqueue, void * out_element){
+    // Comprobación de cola válida:
+    if (aggqueue == NULL){
+        return 1;
+    }
+
+    // Traslado de la pila de entrada a la de salida si esta se ha vaciado:
+    if (aggstack_is_empty(aggqueue->out)){
+        while (!aggstack_is_empty(aggqueue->in)){
+            _aggstack_move_top(aggqueue->in, aggqueue->out);
+        }
+    }
+
+    uint8_t err = aggstack_pop(aggqueue->out, out_element);
+    if (err != 0){
+        return err;
+    }
+
+    // El nodo extraído pasa a la pila de entrada, que es la que lo reutilizará:
+    stack_node_pt temp_node = aggqueue->out->free_nodes;
+    aggqueue->out->free_nodes = temp_node->next;
+    temp_node->next = aggqueue->in->free_nodes;
+    aggqueue->in->free_nodes = temp_node;
+
+    return 0;
+}
+
+/*
+    @brief Función para consultar el elemento más antiguo de la cola sin extraerlo. Coste O(1) amortizado.
+
+    @param aggqueue_pt aggqueue: Referencia a la cola.
+    @param void * out_element: Referencia donde copiar el elemento.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Cola o referencia no válidas.
+                    -> 2: La cola está vacía.
+*/
+uint8_t aggqueue_peek(aggqueue_pt aggqueue, void * out_element){
+    // Comprobación de cola válida:
+    if (aggqueue == NULL){
+        return 1;
+    }
+
+    // Traslado de la pila de entrada a la de salida si esta se ha vaciado:
+    if (aggstack_is_empty(aggqueue->out)){
+        while (!aggstack_is_empty(aggqueue->in)){
+            _aggstack_move_top(aggqueue->in, aggqueue->out);
+        }
+    }
+
+    return aggstack_peek(aggqueue->out, out_element);
+}
+
+/*
+    @brief Función que retorna el mínimo de los elementos de la cola. Coste O(1).
+
+    @param const aggqueue_pt aggqueue: Referencia a la cola.
+    @param void * out_element: Referencia donde copiar el mínimo.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Cola o referencia no válidas, o cola sin comparador.
+                    -> 2: La cola está vacía.
+*/
+uint8_t aggqueue_min(const aggqueue_pt aggqueue, void * out_element){
+    // Comprobación de cola, comparador y referencia válidos:
+    if ((aggqueue == NULL) || (aggqueue->in->cmp_fn == NULL) || (out_element == NULL)){
+        return 1;
+    }
+
+    // Menor de los mínimos de ambas pilas:
+    const uint8_t * in_top = _aggstack_top(aggqueue->in);
+    const uint8_t * out_top = _aggstack_top(aggqueue->out);
+    if ((in_top == NULL) && (out_top == NULL)){
+        return 2;
+    }
+
+    size_t offset = aggqueue->in->min_offset;
+    const uint8_t * min = ((in_top == NULL) || ((out_top != NULL) && (aggqueue->in->cmp_fn(out_top + offset, in_top + offset) <= 0))) ?
+                          out_top + offset : in_top + offset;
+    memcpy(out_element, min, aggqueue->in->element_size);
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna el máximo de los elementos de la cola. Coste O(1).
+
+    @param const aggqueue_pt aggqueue: Referencia a la cola.
+    @param void * out_element: Referencia donde copiar el máximo.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Cola o referencia no válidas, o cola sin comparador.
+                    -> 2: La cola está vacía.
+*/
+uint8_t aggqueue_max(const aggqueue_pt aggqueue, void * out_element){
+    // Comprobación de cola, comparador y referencia válidos:
+    if ((aggqueue == NULL) || (aggqueue->in->cmp_fn == NULL) || (out_element == NULL)){
+        return 1;
+    }
+
+    // Mayor de los máximos de ambas pilas:
+    const uint8_t * in_top = _aggstack_top(aggqueue->in);
+    const uint8_t * out_top = _aggstack_top(aggqueue->out);
+    if ((in_top == NULL) && (out_top == NULL)){
+        return 2;
+    }
+
+    size_t offset = aggqueue->in->max_offset;
+    const uint8_t * max = ((in_top == NULL) || ((out_top != NULL) && (aggqueue->in->cmp_fn(out_top + offset, in_top + offset) >= 0))) ?
+                          out_top + offset : in_top + offset;
+    memcpy(out_element, max, aggqueue->in->element_size);
+
+    return 0;
+}
+
+/*
+    @brief Función que retorna el pliegue de usuario de los elementos de la cola (del más antiguo al más reciente). Coste O(1).
+    @note: Con la cola vacía se retorna el valor neutro.
+
+    @param const aggqueue_pt aggqueue: Referencia a la cola.
+    @param void * out_acc: Referencia donde copiar el acumulador.
+
+    @retval uint8_t: Código de error.
+                    -> 0: No han ocurrido errores.
+                    -> 1: Cola o referencia no válidas, o cola sin pliegue de usuario.
+*/
+uint8_t aggqueue_aggregate(const aggqueue_pt aggqueue, void * out_acc){
+    // Comprobación de cola válida:
+    if (aggqueue == NULL){
+        return 1;
+    }
+
+    // Pliegue de la pila de salida (más antiguos) combinado con el de la pila de entrada (más recientes):
+    uint8_t err = aggstack_aggregate(aggqueue->out, out_acc);
+    const uint8_t * in_top = _aggstack_top(aggqueue->in);
+    if ((err == 0) && (in_top != NULL)){
+        aggqueue->in->combine_fn(out_acc, in_top + aggqueue->in->acc_offset, aggqueue->in->ctx);
+    }
+
+    return err;
+}
+
+/*
+    @brief Función que retorna si la cola está o no vacía.
+
+    @param const aggqueue_pt aggqueue: Referencia a la cola.
+
+    @retval bool: true si la cola está vacía (o no es válida).
+*/
+bool aggqueue_is_empty(const aggqueue_pt aggqueue){
+    // Comprobación de cola válida:
+    if (aggqueue == NULL){
+        return true;
+    }
+
+    return aggstack_is_empty(aggqueue->in) && aggstack_is_empty(aggqueue->out);
+}
+
+/*
+    @brief Función que retorna el número de elementos de la cola.
+
+    @param const aggqueue_pt aggqueue: Referencia a la cola.
+
+    @retval size_t: Número de elementos (0 si la cola no es válida).
+*/
+size_t aggqueue_get_size(const aggqueue_pt aggqueue){
+    // Comprobación de cola válida:
+    if (aggqueue == NULL){
+        return 0;
+    }
+
+    return aggstack_get_size(aggqueue->in) + aggstack_get_size(aggqueue->out);
+}
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna que calcula los agregados de una entrada a partir de su elemento y de la entrada inferior.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param const aggstack_pt aggstack: Referencia a la pila.
+    @param uint8_t * entry: Entrada con el elemento ya copiado al inicio.
+    @param const uint8_t * below: Entrada inferior (NULL si la entrada queda en el fondo).
+
+    @retval None.
+*/
+static void _aggstack_fill(const aggstack_pt aggstack, uint8_t * entry, const uint8_t * below){
+    size_t element_size = aggstack->element_size;
+
+    // Mínimo y máximo (el elemento o los de la entrada inferior):
+    if (aggstack->cmp_fn != NULL){
+        bool is_min = (below == NULL) || (aggstack->cmp_fn(entry, below + aggstack->min_offset) < 0);
+        bool is_max = (below == NULL) || (aggstack->cmp_fn(entry, below + aggstack->max_offset) > 0);
+        memcpy(entry + aggstack->min_offset, is_min ? entry : below + aggstack->min_offset, element_size);
+        memcpy(entry + aggstack->max_offset, is_max ? entry : below + aggstack->max_offset, element_size);
+    }
+
+    // Pliegue de usuario (el elemento a la derecha del acumulado inferior, o a su izquierda en modo prepend):
+    if (aggstack->acc_size > 0){
+        uint8_t * acc = entry + aggstack->acc_offset;
+        if (aggstack->prepend){
+            memcpy(acc, aggstack->identity, aggstack->acc_size);
+            aggstack->fold_fn(acc, entry, aggstack->ctx);
+            if (below != NULL){
+                aggstack->combine_fn(acc, below + aggstack->acc_offset, aggstack->ctx);
+            }
+        } else {
+            memcpy(acc, (below != NULL) ? below + aggstack->acc_offset : (const uint8_t *)aggstack->identity, aggstack->acc_size);
+            aggstack->fold_fn(acc, entry, aggstack->ctx);
+        }
+    }
+}
+
+/*
+    @brief Función interna que traslada el nodo de la cima de una pila a la cima de otra, recalculando sus agregados.
+    @note: El nodo se reenlaza sin reservar ni liberar memoria.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param aggstack_pt src: Pila origen (no vacía).
+    @param aggstack_pt dst: Pila destino.
+
+    @retval None.
+*/
+static void _aggstack_move_top(aggstack_pt src, aggstack_pt dst){
+    stack_node_pt temp_node = src->stack->top;
+    src->stack->top = temp_node->next;
+    src->stack->size--;
+
+    _aggstack_fill(dst, (uint8_t *)temp_node->data, _aggstack_top(dst));
+    temp_node->next = dst->stack->top;
+    dst->stack->top = temp_node;
+    dst->stack->size++;
+}
+
+/*
+    @brief Función interna que retorna la entrada de la cima de la pila.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param const aggstack_pt aggstack: Referencia a la pila.
+
+    @retval const uint8_t *: Entrada de la cima (NULL si la pila está vacía).
+*/
+static const uint8_t * _aggstack_top(const aggstack_pt aggstack){
+    return (aggstack->stack->top != NULL) ? (const uint8_t *)aggstack->stack->top->data : NULL;
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
@@ -0,0 +1,99 @@
+#ifndef AGGSTACK_HEADER
+#define AGGSTACK_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stddef.h>
+
+#include "stack.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define AGGSTACK_ACC_ALIGN _Alignof(max_align_t)    // Alineación del acumulador dentro de la entrada.
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos --------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct aggstack{
+    stack_pt stack;                 // Pila de entradas (elemento, mínimo, máximo y acumulado hasta la entrada).
+    size_t element_size;            // Tamaño (bytes) del elemento.
+    size_t acc_size;                // Tamaño (bytes) del acumulador del pliegue de usuario (0: sin pliegue).
+    size_t min_offset;              // Desplazamiento del mínimo dentro de la entrada.
+    size_t max_offset;              // Desplazamiento del máximo dentro de la entrada.
+    size_t acc_offset;              // Desplazamiento del acumulador dentro de la entrada.
+    int (*cmp_fn)(const void *, const void *);      // Función comparadora (NULL: sin mínimo ni máximo).
+    void * identity;                // Valor neutro del acumulador (copia propia).
+    void (*fold_fn)(void *, const void *, void *);  // Acumulación de un elemento (acumulador, elemento, contexto).
+    void (*combine_fn)(void *, const void *, void *);   // Combinación de acumuladores (acumulador, acumulador posterior, contexto).
+    void * ctx;                     // Contexto de usuario del pliegue.
+    bool prepend;                   // Los elementos nuevos son los primeros del pliegue (pila de salida de aggqueue).
+    struct stack_node * free_nodes; // Nodos extraídos para reutilizar (enlazados por next).
+};
+
+struct aggqueue{
+    struct aggstack * in;           // Pila de entrada (el elemento más reciente en la cima).
+    struct aggstack * out;          // Pila de salida (el elemento más antiguo en la cima).
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct aggstack aggstack_t;
+typedef aggstack_t * aggstack_pt;
+
+typedef struct aggqueue aggqueue_t;
+typedef aggqueue_t * aggqueue_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción de la pila agregada:
+aggstack_pt aggstack_init(size_t element_size, int (*cmp_fn)(const void *, const void *), size_t acc_size, const void * identity,
+                          void (*fold_fn)(void *, const void *, void *), void (*combine_fn)(void *, const void *, void *), void * ctx);
+void aggstack_deinit(aggstack_pt * aggstack);
+
+// Entrada y salida de datos de la pila:
+uint8_t aggstack_push(aggstack_pt aggstack, const void * element);
+uint8_t aggstack_pop(aggstack_pt aggstack, void * out_element);
+uint8_t aggstack_peek(const aggstack_pt aggstack, void * out_element);
+
+// Agregados de la pila:
+uint8_t aggstack_min(const aggstack_pt aggstack, void * out_element);
+uint8_t aggstack_max(const aggstack_pt aggstack, void * out_element);
+uint8_t aggstack_aggregate(const aggstack_pt aggstack, void * out_acc);
+
+// Utilidades de la pila:
+bool aggstack_is_empty(const aggstack_pt aggstack);
+size_t aggstack_get_size(const aggstack_pt aggstack);
+
+// Creación y destrucción de la cola de dos pilas:
+aggqueue_pt aggqueue_init(size_t element_size, int (*cmp_fn)(const void *, const void *), size_t acc_size, const void * identity,
+                          void (*fold_fn)(void *, const void *, void *), void (*combine_fn)(void *, const void *, void *), void * ctx);
+void aggqueue_deinit(aggqueue_pt * aggqueue);
+
+// Entrada y salida de datos de la cola:
+uint8_t aggqueue_push(aggqueue_pt aggqueue, const void * element);
+uint8_t aggqueue_pop(aggqueue_pt aggqueue, void * out_element);
+uint8_t aggqueue_peek(aggqueue_pt aggqueue, void * out_element);
+
+// Agregados de la ventana (todos los elementos de la cola):
+uint8_t aggqueue_min(const aggqueue_pt aggqueue, void * out_element);
+uint8_t aggqueue_max(const aggqueue_pt aggqueue, void * out_element);
+uint8_t aggqueue_aggregate(const aggqueue_pt aggqueue, void * out_acc);
+
+// Utilidades de la cola:
+bool aggqueue_is_empty(const aggqueue_pt aggqueue);
+size_t aggqueue_get_size(const aggqueue_pt aggqueue);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
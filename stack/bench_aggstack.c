@@ -0,0 +1,144 @@
+#include "aggstack.h"
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_RESCAN_BUDGET 200000000   // Elementos visitados como máximo por el recorrido completo en cada ventana.
+
+// Prototipos de funciones:
+double elapsed_ms(struct timespec start, struct timespec end);
+int cmp_u32(const void * a, const void * b);
+void fold_sum(void * acc, const void * element, void * ctx);
+void combine_sum(void * acc, const void * other, void * ctx);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Longitud del flujo (por argumento o por defecto; al menos el doble de la ventana mayor):
+    size_t n = (argc > 1) ? strtoul(argv[1], NULL, 10) : 4000000;
+    size_t windows[] = {10, 100, 1000, 10000, 100000, 1000000};
+    if (n < 2 * windows[5]){
+        n = 2 * windows[5];
+    }
+
+    uint32_t * data = (uint32_t *)malloc(n * sizeof(uint32_t));
+    if (data == NULL){
+        return 1;
+    }
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < n; i++){
+        seed = seed * 1103515245 + 12345;
+        data[i] = seed >> 8;
+    }
+
+    printf("\nFlujo: %ld elementos (por tick: entra uno, sale otro y se consultan min, max y suma)\n", n);
+    printf("%-10s %16s %16s %16s %12s\n", "ventana", "aggqueue(ns/tick)", "recorrido(ns/tick)", "ticks recorrido", "comprobación");
+
+    uint64_t zero = 0;
+    struct timespec start, end;
+    for (size_t w = 0; w < 6; w++){
+        size_t width = windows[w];
+        size_t ticks = n - width;
+        size_t rescan_ticks = BENCH_RESCAN_BUDGET / width;
+        rescan_ticks = (rescan_ticks == 0) ? 1 : ((rescan_ticks > ticks) ? ticks : rescan_ticks);
+
+        // Cola de dos pilas agregadas:
+        aggqueue_pt window = aggqueue_init(sizeof(uint32_t), cmp_u32, sizeof(uint64_t), &zero, fold_sum, combine_sum, NULL);
+        for (size_t i = 0; i < width; i++){
+            aggqueue_push(window, &data[i]);
+        }
+
+        uint32_t min, max;
+        uint64_t sum, check_queue = 0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (size_t t = 0; t < ticks; t++){
+            aggqueue_push(window, &data[width + t]);
+            aggqueue_pop(window, NULL);
+            aggqueue_min(window, &min);
+            aggqueue_max(window, &max);
+            aggqueue_aggregate(window, &sum);
+            if (t < rescan_ticks){
+                check_queue += min ^ max ^ sum;
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        double queue_ms = elapsed_ms(start, end);
+        aggqueue_deinit(&window);
+
+        // Recorrido completo de la ventana en cada tick (esquema anterior, limitado a BENCH_RESCAN_BUDGET visitas):
+        uint64_t check_rescan = 0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (size_t t = 0; t < rescan_ticks; t++){
+            const uint32_t * begin = &data[t + 1];
+            min = begin[0];
+            max = begin[0];
+            sum = 0;
+            for (size_t i = 0; i < width; i++){
+                min = (begin[i] < min) ? begin[i] : min;
+                max = (begin[i] > max) ? begin[i] : max;
+                sum += begin[i];
+            }
+            check_rescan += min ^ max ^ sum;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        double rescan_ms = elapsed_ms(start, end);
+
+        printf("%-10ld %16.1f %16.1f %16ld %12s\n", width, queue_ms * 1e6 / ticks, rescan_ms * 1e6 / rescan_ticks, rescan_ticks,
+               (check_queue == check_rescan) ? "correcta" : "INCORRECTA");
+    }
+
+    free(data);
+
+    return 0;
+}
+
+/*
+    @brief Función que calcula el tiempo transcurrido entre dos marcas de tiempo.
+
+    @param struct timespec start: Marca de inicio.
+    @param struct timespec end: Marca de fin.
+
+    @retval double: Tiempo transcurrido en milisegundos.
+*/
+double elapsed_ms(struct timespec start, struct timespec end){
+    return (double)(end.tv_sec - start.tv_sec) * 1e3 + (double)(end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+/*
+    @brief Función comparadora de uint32_t (al estilo de qsort).
+
+    @param const void * a: Primer valor.
+    @param const void * b: Segundo valor.
+
+    @retval int: <0 si a < b, 0 si a == b, >0 si a > b.
+*/
+int cmp_u32(const void * a, const void * b){
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+    @brief Función de acumulación de un elemento (uint32_t) en una suma (uint64_t).
+
+    @param void * acc: Referencia al acumulador.
+    @param const void * element: Referencia al elemento.
+    @param void * ctx: Contexto de usuario (no usado).
+
+    @retval None.
+*/
+void fold_sum(void * acc, const void * element, void * ctx){
+    *(uint64_t *)acc += *(const uint32_t *)element;
+}
+
+/*
+    @brief Función de combinación de dos sumas (uint64_t).
+
+    @param void * acc: Referencia al acumulador.
+    @param const void * other: Referencia al acumulador posterior.
+    @param void * ctx: Contexto de usuario (no usado).
+
+    @retval None.
+*/
+void combine_sum(void * acc, const void * other, void * ctx){
+    *(uint64_t *)acc += *(const uint64_t *)other;
+}
\ No newline at end of file
@@ -6,20 +6,31 @@
 CC=gcc
 CFLAGS_TEST="-g -Wall -O2"
 CFLAGS_LIB="-Wall -O2 -fPIC -shared"
+CFLAGS_BENCH="-Wall -O2 -march=native"
 
-SRC_STACK=stack.c
-SRC_TEST=test_stack.c
+# Uso anterior sin <tipo> (./build.sh test|lib|clean): equivale a la pila
+if [ "$1" == "test" ] || [ "$1" == "lib" ] || [ "$1" == "clean" ]; then
+    set -- stack "$1"
+fi
+
+SRC_STACK=$1.c
+if [ "$1" == "aggstack" ]; then
+    SRC_STACK="$SRC_STACK stack.c"
+fi
+SRC_TEST=test_$1.c
+SRC_BENCH=bench_$1.c
 
-TEST_PROG=test_stack.elf
-LIB_PROG=stack.so
+TEST_PROG=test_$1.elf
+BENCH_PROG=bench_$1.elf
+LIB_PROG=$1.so
 # -------------------------------- #
 
 
 # Lógica de uso                    #
 # -------------------------------- #
-if [ "$1" == "test" ]; then
+if [ "$2" == "test" ]; then
     echo
-    echo "[BUILD-STACK-TEST]: Compilando programa de prueba de stack..."
+    echo "[BUILD-STACK-TEST]: Compilando programa de prueba de $1..."
     if $CC $CFLAGS_TEST $SRC_TEST $SRC_STACK -o $TEST_PROG; then
         echo "[BUILD-STACK-TEST]: Compilación completada."
         echo "[BUILD-STACK-TEST]: Ejecutando programa de prueba..."
@@ -32,9 +43,24 @@ if [ "$1" == "test" ]; then
     fi
     echo
 
-elif [ "$1" == "lib" ]; then
+elif [ "$2" == "bench" ] && [ "$1" == "aggstack" ]; then
+    echo
+    echo "[BUILD-STACK-BENCH]: Compilando benchmark de $1..."
+    if $CC $CFLAGS_BENCH $SRC_BENCH $SRC_STACK -o $BENCH_PROG; then
+        echo "[BUILD-STACK-BENCH]: Compilación completada."
+        echo "[BUILD-STACK-BENCH]: Ejecutando benchmark..."
+        echo
+        ./$BENCH_PROG "${@:3}"
+        echo
+        echo "[BUILD-STACK-BENCH]: Ejecución de benchmark finalizada."
+    else
+        echo "[BUILD-STACK-BENCH][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$2" == "lib" ]; then
     echo
-    echo "[BUILD-STACK-LIB]: Compilando la librería de stack..."
+    echo "[BUILD-STACK-LIB]: Compilando la librería de $1..."
     if $CC $CFLAGS_LIB $SRC_STACK -o $LIB_PROG; then
         mv $LIB_PROG ./lib
         echo "[BUILD-STACK-LIB]: Librearía compilada."
@@ -43,10 +69,10 @@ elif [ "$1" == "lib" ]; then
     fi
     echo
 
-elif [ "$1" == "clean" ]; then
+elif [ "$2" == "clean" ]; then
     echo
     echo "[BUILD-STACK-CLEAN]: Limpiando espacio de trabajo..."
-    rm -f ./$TEST_PROG ./lib/$LIB_PROG
+    rm -f ./$TEST_PROG ./$BENCH_PROG ./lib/$LIB_PROG
     echo "[BUILD-STACK-CLEAN]: Espacio de trabajo limpio."
     echo
 
@@ -54,9 +80,14 @@ else
     echo
     echo "[BUILD-STACK][ERR]: Uso incorrecto u opciones inválidas."
     echo -e "\n\t[Uso]:"
-    echo -e "\t\t-> ./build.sh test: \tCompila y ejecuta el programa de test (.elf)"
-    echo -e "\t\t-> ./build.sh lib: \tCompila y genera la librería compartida (.so) bajo la carpeta lib/"
-    echo -e "\t\t-> ./build.sh clean: \tLimpia el espacio de trabajo eliminando archivos generados"
+    echo -e "\t\t-> ./build.sh <tipo> test: \tCompila y ejecuta el programa de test (.elf)"
+    echo -e "\t\t-> ./build.sh <tipo> bench [n]: \tCompila y ejecuta el benchmark de ventanas deslizantes (.elf, solo aggstack)"
+    echo -e "\t\t-> ./build.sh <tipo> lib: \tCompila y genera la librería compartida (.so) bajo la carpeta lib/"
+    echo -e "\t\t-> ./build.sh <tipo> clean: \tLimpia el espacio de trabajo eliminando archivos generados"
+    echo -e "\t\t-> ./build.sh test|lib|clean: \tEquivale a ./build.sh stack test|lib|clean"
+    echo -e "\n\n\t<tipo>:"
+    echo -e "\t\tstack: \tEjecuta el script para la pila"
+    echo -e "\t\taggstack: \tEjecuta el script para la pila agregada y la cola de dos pilas"
     echo
     exit 1
 fi
@@ -150,6 +150,43 @@ uint8_t stack_peek(stack_pt stack, void * out_data){
     return 0;
 }
 
+/*
+    @brief Función para eliminar, en una sola pasada, todos los nodos de la pila cuyos datos cumplen un predicado.
+    @note: Se conserva el orden relativo del resto de nodos.
+
+    @param stack_pt stack: Referencia a la pila.
+    @param bool (*pred_fn)(const void *, void *): Referencia al predicado (datos, contexto); true indica eliminar.
+    @param void * ctx: Referencia al contexto de usuario que se pasa al predicado (puede ser nulo).
+
+    @retval size_t: Número de nodos eliminados.
+*/
+size_t stack_remove_if(stack_pt stack, bool (*pred_fn)(const void *, void *), void * ctx){
+    // Comprobación de pila y predicado válidos:
+    if ((stack == NULL) || (pred_fn == NULL)){
+        return 0;
+    }
+
+    // Recorrido de la pila desenlazando y destruyendo los nodos que cumplen el predicado:
+    size_t removed = 0;
+    stack_node_pt * temp_link = &stack->top;
+    stack_node_pt temp_current_node;
+    while (*temp_link != NULL){
+        temp_current_node = *temp_link;
+        if (pred_fn(temp_current_node->data, ctx)){
+            *temp_link = temp_current_node->next;
+            _stack_node_deinit(temp_current_node);
+            removed++;
+        } else {
+            temp_link = &temp_current_node->next;
+        }
+    }
+
+    // Actualización del tamaño de la pila:
+    stack->size -= removed;
+
+    return removed;
+}
+
 /*
     @brief Función que retorna si la lista está o no vacía.
 
@@ -56,6 +56,9 @@ uint8_t stack_push(stack_pt stack, void * data);
 uint8_t stack_pop(stack_pt stack, void * out_data);
 uint8_t stack_peek(stack_pt stack, void * out_data);
 
+// Eliminación de datos:
+size_t stack_remove_if(stack_pt stack, bool (*pred_fn)(const void *, void *), void * ctx);
+
 // Utilidades:
 bool stack_is_empty(stack_pt stack);
 size_t stack_get_size(stack_pt stack);
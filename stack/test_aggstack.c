@@ -0,0 +1,182 @@
+#include "aggstack.h"
+#include <stdio.h>
+
+struct span{
+    int32_t first;                  // Primer elemento plegado.
+    int32_t last;                   // Último elemento plegado.
+    uint32_t count;                 // Elementos plegados.
+};
+
+// Prototipos de funciones:
+int cmp_i32(const void * a, const void * b);
+void fold_sum(void * acc, const void * element, void * ctx);
+void combine_sum(void * acc, const void * other, void * ctx);
+void fold_span(void * acc, const void * element, void * ctx);
+void combine_span(void * acc, const void * other, void * ctx);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Pila agregada de enteros con mínimo, máximo y suma:
+    int64_t zero = 0;
+    aggstack_pt stack = aggstack_init(sizeof(int32_t), cmp_i32, sizeof(int64_t), &zero, fold_sum, combine_sum, NULL);
+    printf("\nSe ha creado la pila agregada correctamente en la dirección (%p)\n", (void *)stack);
+
+    int32_t values[] = {5, 3, 8, -2, 7};
+    int32_t min, max;
+    int64_t sum;
+    for (size_t i = 0; i < 5; i++){
+        aggstack_push(stack, &values[i]);
+        aggstack_min(stack, &min);
+        aggstack_max(stack, &max);
+        aggstack_aggregate(stack, &sum);
+        printf("push %3d -> min %3d, max %3d, suma %3ld\n", values[i], min, max, sum);
+    }
+
+    // Al extraer, los agregados vuelven a los de la entrada inferior:
+    int32_t value;
+    while (aggstack_pop(stack, &value) == 0){
+        if (aggstack_min(stack, &min) == 0){
+            aggstack_max(stack, &max);
+            aggstack_aggregate(stack, &sum);
+            printf("pop  %3d -> min %3d, max %3d, suma %3ld\n", value, min, max, sum);
+        } else {
+            aggstack_aggregate(stack, &sum);
+            printf("pop  %3d -> pila vacía (min: %u, suma: valor neutro %ld)\n", value, aggstack_min(stack, &min), sum);
+        }
+    }
+    aggstack_deinit(&stack);
+
+    // Cola de dos pilas como ventana deslizante (mínimo, máximo y suma de los 4 últimos elementos):
+    aggqueue_pt window = aggqueue_init(sizeof(int32_t), cmp_i32, sizeof(int64_t), &zero, fold_sum, combine_sum, NULL);
+    int32_t stream[] = {4, 2, 12, 3, 9, 1, 6, 6, 0, 15};
+    printf("\nVentana deslizante de 4 elementos:\n");
+    for (size_t i = 0; i < 10; i++){
+        aggqueue_push(window, &stream[i]);
+        if (aggqueue_get_size(window) > 4){
+            aggqueue_pop(window, NULL);
+        }
+        aggqueue_min(window, &min);
+        aggqueue_max(window, &max);
+        aggqueue_aggregate(window, &sum);
+        aggqueue_peek(window, &value);
+        printf("\t-> entra %2d: más antiguo %2d, min %2d, max %2d, suma %3ld\n", stream[i], value, min, max, sum);
+    }
+    aggqueue_deinit(&window);
+
+    // Comprobación masiva frente a un recorrido completo, con un pliegue no conmutativo (primero, último y cuenta):
+    struct span identity = {0, 0, 0};
+    window = aggqueue_init(sizeof(int32_t), cmp_i32, sizeof(struct span), &identity, fold_span, combine_span, NULL);
+    size_t n = 20000;
+    size_t width = 37;
+    int32_t * data = (int32_t *)malloc(n * sizeof(int32_t));
+    uint32_t seed = 12345;
+    size_t errors = 0;
+    for (size_t i = 0; i < n; i++){
+        seed = seed * 1103515245 + 12345;
+        data[i] = (int32_t)(seed >> 8) % 1000;
+        aggqueue_push(window, &data[i]);
+        if (aggqueue_get_size(window) > width){
+            aggqueue_pop(window, NULL);
+        }
+
+        size_t begin = (i + 1 > width) ? i + 1 - width : 0;
+        int32_t expected_min = data[begin], expected_max = data[begin];
+        for (size_t j = begin; j <= i; j++){
+            expected_min = (data[j] < expected_min) ? data[j] : expected_min;
+            expected_max = (data[j] > expected_max) ? data[j] : expected_max;
+        }
+        struct span span;
+        aggqueue_min(window, &min);
+        aggqueue_max(window, &max);
+        aggqueue_aggregate(window, &span);
+        errors += (min != expected_min) || (max != expected_max) ||
+                  (span.first != data[begin]) || (span.last != data[i]) || (span.count != i + 1 - begin);
+    }
+    printf("\nVentanas de %ld elementos comprobadas: %ld, errores: %ld\n", width, n, errors);
+    free(data);
+    aggqueue_deinit(&window);
+    printf("Dirección de la cola tras destruirla: (%p)\n", (void *)window);
+
+    return 0;
+}
+
+/*
+    @brief Función comparadora de int32_t (al estilo de qsort).
+
+    @param const void * a: Primer valor.
+    @param const void * b: Segundo valor.
+
+    @retval int: <0 si a < b, 0 si a == b, >0 si a > b.
+*/
+int cmp_i32(const void * a, const void * b){
+    int32_t x = *(const int32_t *)a;
+    int32_t y = *(const int32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+    @brief Función de acumulación de un elemento (int32_t) en una suma (int64_t).
+
+    @param void * acc: Referencia al acumulador.
+    @param const void * element: Referencia al elemento.
+    @param void * ctx: Contexto de usuario (no usado).
+
+    @retval None.
+*/
+void fold_sum(void * acc, const void * element, void * ctx){
+    *(int64_t *)acc += *(const int32_t *)element;
+}
+
+/*
+    @brief Función de combinación de dos sumas (int64_t).
+
+    @param void * acc: Referencia al acumulador.
+    @param const void * other: Referencia al acumulador posterior.
+    @param void * ctx: Contexto de usuario (no usado).
+
+    @retval None.
+*/
+void combine_sum(void * acc, const void * other, void * ctx){
+    *(int64_t *)acc += *(const int64_t *)other;
+}
+
+/*
+    @brief Función de acumulación de un elemento (int32_t) en un tramo (primero, último y cuenta).
+
+    @param void * acc: Referencia al tramo.
+    @param const void * element: Referencia al elemento.
+    @param void * ctx: Contexto de usuario (no usado).
+
+    @retval None.
+*/
+void fold_span(void * acc, const void * element, void * ctx){
+    struct span * span = (struct span *)acc;
+    if (span->count == 0){
+        span->first = *(const int32_t *)element;
+    }
+    span->last = *(const int32_t *)element;
+    span->count++;
+}
+
+/*
+    @brief Función de combinación de dos tramos (no conmutativa: el primero es el del acumulador, el último el del posterior).
+
+    @param void * acc: Referencia al tramo.
+    @param const void * other: Referencia al tramo posterior.
+    @param void * ctx: Contexto de usuario (no usado).
+
+    @retval None.
+*/
+void combine_span(void * acc, const void * other, void * ctx){
+    struct span * span = (struct span *)acc;
+    const struct span * next = (const struct span *)other;
+    if (next->count == 0){
+        return;
+    }
+    if (span->count == 0){
+        span->first = next->first;
+    }
+    span->last = next->last;
+    span->count += next->count;
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "stack.h"
 #include <stdio.h>
 
+// Prototipos de funciones:
+bool is_less_than(const void * data, void * ctx);
 
 
 int main(int argc, char ** argv){
@@ -35,8 +37,31 @@ int main(int argc, char ** argv){
     printf("Tamaño de la lista: %ld elementos.\n", stack_get_size(stack));
     printf("Tamaño de tipo de dato por nodo de la pila: %ld bytes.\n", stack_get_data_size(stack));
 
+    // Eliminación en una sola pasada de los datos menores que un límite dado:
+    stack_push(stack, "x");
+    stack_push(stack, "d");
+    stack_push(stack, "z");
+    uint8_t limit = 'e';
+    size_t removed = stack_remove_if(stack, is_less_than, &limit);
+    printf("\nSe han eliminado %ld datos menores que '%c'.\n", removed, limit);
+    printf("Tamaño de la lista: %ld elementos.\n", stack_get_size(stack));
+    stack_peek(stack, (void *)&data);
+    printf("Peek del la cabecera del stack: %c\n", data);
+
     // Destrucción de la pila:
     stack_deinit(&stack);
     printf("\nDirección de pila tras la eliminación: (%p)\n", (void *)stack);
     return 0;
+}
+
+/*
+    @brief Predicado que indica si un dato (uint8_t) es menor que el límite dado como contexto.
+
+    @param const void * data: Referencia al dato.
+    @param void * ctx: Referencia al límite (uint8_t).
+
+    @retval bool: true si data < ctx, false en caso contrario.
+*/
+bool is_less_than(const void * data, void * ctx){
+    return *(const uint8_t *)data < *(uint8_t *)ctx;
 }
\ No newline at end of file
@@ -0,0 +1,63 @@
+#!/bin/bash
+
+
+# Variables de entorno             #
+# -------------------------------- #
+CC=gcc
+CFLAGS_TEST="-g -Wall -O2 -pthread"
+CFLAGS_LIB="-Wall -O2 -fPIC -shared -pthread"
+
+SRC_TPOOL="tpool.c palgo.c ../deque/wsdeque.c ../queue/mpmcq.c ../array/array.c ../llist/sllist.c ../llist/dllist.c"
+SRC_TEST=test_tpool.c
+
+TEST_PROG=test_tpool.elf
+LIB_PROG=tpool.so
+# -------------------------------- #
+
+
+# Lógica de uso                    #
+# -------------------------------- #
+if [ "$1" == "test" ]; then
+    echo
+    echo "[BUILD-TPOOL-TEST]: Compilando programa de prueba de tpool..."
+    if $CC $CFLAGS_TEST $SRC_TEST $SRC_TPOOL -o $TEST_PROG; then
+        echo "[BUILD-TPOOL-TEST]: Compilación completada."
+        echo "[BUILD-TPOOL-TEST]: Ejecutando programa de prueba..."
+        echo
+        ./$TEST_PROG
+        echo
+        echo "[BUILD-TPOOL-TEST]: Ejecución de programa de prueba finalizado."
+    else
+        echo "[BUILD-TPOOL-TEST][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$1" == "lib" ]; then
+    echo
+    echo "[BUILD-TPOOL-LIB]: Compilando la librería de tpool..."
+    if $CC $CFLAGS_LIB $SRC_TPOOL -o $LIB_PROG; then
+        mv $LIB_PROG ./lib
+        echo "[BUILD-TPOOL-LIB]: Librearía compilada."
+    else
+        echo "[BUILD-TPOOL-LIB][ERR]: Error de compilación, librería no generada."
+    fi
+    echo
+
+elif [ "$1" == "clean" ]; then
+    echo
+    echo "[BUILD-TPOOL-CLEAN]: Limpiando espacio de trabajo..."
+    rm -f ./$TEST_PROG ./lib/$LIB_PROG
+    echo "[BUILD-TPOOL-CLEAN]: Espacio de trabajo limpio."
+    echo
+
+else
+    echo
+    echo "[BUILD-TPOOL][ERR]: Uso incorrecto u opciones inválidas."
+    echo -e "\n\t[Uso]:"
+    echo -e "\t\t-> ./build.sh test: \tCompila y ejecuta el programa de test (.elf)"
+    echo -e "\t\t-> ./build.sh lib: \tCompila y genera la librería compartida (.so) bajo la carpeta lib/"
+    echo -e "\t\t-> ./build.sh clean: \tLimpia el espacio de trabajo eliminando archivos generados"
+    echo
+    exit 1
+fi
+# -------------------------------- #
\ No newline at end of file
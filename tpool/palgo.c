@@ -0,0 +1,466 @@
+#include "palgo.h"
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static void _palgo_foreach_range(size_t begin, size_t end, void * arg);
+static void _palgo_reduce_range(size_t begin, size_t end, void * arg);
+static void _palgo_find_range(size_t begin, size_t end, void * arg);
+static void _palgo_sort_range(size_t begin, size_t end, void * arg);
+static void _palgo_merge_range(size_t begin, size_t end, void * arg);
+static void _palgo_copy_range(size_t begin, size_t end, void * arg);
+static uint8_t _palgo_gather(tpool_pt pool, void ** sources, size_t n, array_pt out);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para aplicar una función a trozos contiguos de un array en paralelo.
+    @note: Cada llamada recibe un trozo [primero, primero + nº) disjunto; el orden entre trozos no está definido.
+
+    @param tpool_pt pool: Referencia al pool (NULL para ejecutar en serie).
+    @param array_pt array: Referencia al array.
+    @param size_t grain: Elementos por trozo (0 para el grano por defecto del pool).
+    @param void (*chunk_fn)(void *, size_t, void *): Función de trozo (primer elemento, nº de elementos, contexto).
+    @param void * ctx: Contexto de la función.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Array o función no válidos.
+*/
+uint8_t palgo_array_foreach(tpool_pt pool, array_pt array, size_t grain, void (*chunk_fn)(void *, size_t, void *), void * ctx){
+    // Comprobación de array y función válidos:
+    if ((array == NULL) || (chunk_fn == NULL)){
+        return 1;
+    }
+
+    struct palgo_foreach_ctx foreach_ctx = {.array = array, .chunk_fn = chunk_fn, .ctx = ctx};
+
+    return tpool_parallel_for(pool, 0, array->size, grain, _palgo_foreach_range, &foreach_ctx);
+}
+
+/*
+    @brief Función para reducir un array en paralelo a un acumulador de tamaño arbitrario.
+    @note: Cada trozo de grano acumula desde la identidad con fold_fn; los parciales se combinan en orden con combine_fn (solo se exige asociatividad).
+
+    @param tpool_pt pool: Referencia al pool (NULL para ejecutar en serie).
+    @param const array_pt array: Referencia al array.
+    @param size_t grain: Elementos por acumulador parcial (0 para el grano por defecto del pool).
+    @param const void * identity: Referencia al valor inicial del acumulador.
+    @param size_t acc_size: Tamaño (bytes) del acumulador.
+    @param void (*fold_fn)(void *, const void *, void *): Acumulación de un elemento (acumulador, elemento, contexto).
+    @param void (*combine_fn)(void *, const void *, void *): Combinación de un parcial en el acumulador (acumulador, parcial, contexto).
+    @param void * ctx: Contexto de las funciones.
+    @param void * out_acc: Referencia a la variable donde se copiará el resultado.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Argumentos no válidos.
+                -> 2: Error al reservar los acumuladores parciales.
+*/
+uint8_t palgo_array_reduce(tpool_pt pool, const array_pt array, size_t grain, const void * identity, size_t acc_size,
+                           void (*fold_fn)(void *, const void *, void *), void (*combine_fn)(void *, const void *, void *), void * ctx, void * out_acc){
+    // Comprobación de argumentos válidos:
+    if ((array == NULL) || (identity == NULL) || (acc_size == 0) || (fold_fn == NULL) || (combine_fn == NULL) || (out_acc == NULL)){
+        return 1;
+    }
+
+    memcpy(out_acc, identity, acc_size);
+    if (array->size == 0){
+        return 0;
+    }
+
+    // Reserva de un acumulador parcial por trozo de grano:
+    grain = tpool_grain(pool, array->size, grain);
+    size_t chunks = (array->size + grain - 1) / grain;
+    struct palgo_reduce_ctx reduce_ctx = {
+        .array = array, .grain = grain, .identity = identity, .acc_size = acc_size,
+        .fold_fn = fold_fn, .ctx = ctx, .partials = (uint8_t *)malloc(chunks * acc_size)
+    };
+    if (reduce_ctx.partials == NULL){
+        return 2;
+    }
+
+    // Reducción paralela por trozos y combinación en orden:
+    tpool_parallel_for(pool, 0, array->size, grain, _palgo_reduce_range, &reduce_ctx);
+    for (size_t i = 0; i < chunks; i++){
+        combine_fn(out_acc, reduce_ctx.partials + (i * acc_size), ctx);
+    }
+
+    free(reduce_ctx.partials);
+
+    return 0;
+}
+
+/*
+    @brief Función para buscar en paralelo el primer elemento de un array que cumple un predicado.
+    @note: Los trozos posteriores al mejor índice ya encontrado abandonan la búsqueda.
+
+    @param tpool_pt pool: Referencia al pool (NULL para ejecutar en serie).
+    @param const array_pt array: Referencia al array.
+    @param size_t grain: Elementos por trozo (0 para el grano por defecto del pool).
+    @param bool (*pred_fn)(const void *, void *): Predicado (elemento, contexto).
+    @param void * ctx: Contexto del predicado.
+    @param size_t * out_index: Referencia a la variable donde se guardará el índice encontrado.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Argumentos no válidos.
+                -> 2: Ningún elemento cumple el predicado.
+*/
+uint8_t palgo_array_find(tpool_pt pool, const array_pt array, size_t grain, bool (*pred_fn)(const void *, void *), void * ctx, size_t * out_index){
+    // Comprobación de argumentos válidos:
+    if ((array == NULL) || (pred_fn == NULL) || (out_index == NULL)){
+        return 1;
+    }
+
+    // Búsqueda paralela del menor índice:
+    struct palgo_find_ctx find_ctx = {.array = array, .pred_fn = pred_fn, .ctx = ctx};
+    atomic_init(&find_ctx.best, SIZE_MAX);
+    tpool_parallel_for(pool, 0, array->size, grain, _palgo_find_range, &find_ctx);
+
+    size_t best = atomic_load(&find_ctx.best);
+    if (best == SIZE_MAX){
+        return 2;
+    }
+
+    *out_index = best;
+
+    return 0;
+}
+
+/*
+    @brief Función para ordenar un array en paralelo (ordenación de trozos y mezclas por pasadas).
+    @note: Cada trozo de grano se ordena con qsort en paralelo; después cada pasada mezcla parejas de tramos en paralelo (la última mezcla es serie).
+    @note: La ordenación no es estable (qsort no lo es).
+
+    @param tpool_pt pool: Referencia al pool (NULL para ejecutar en serie).
+    @param array_pt array: Referencia al array.
+    @param size_t grain: Elementos por trozo ordenado inicial (0 para el grano por defecto del pool).
+    @param int (*cmp_fn)(const void *, const void *): Función comparadora (estilo qsort).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Array o función no válidos.
+                -> 2: Error al reservar el buffer de mezcla.
+*/
+uint8_t palgo_array_sort(tpool_pt pool, array_pt array, size_t grain, int (*cmp_fn)(const void *, const void *)){
+    // Comprobación de array y función válidos:
+    if ((array == NULL) || (cmp_fn == NULL)){
+        return 1;
+    }
+
+    if (array->size < 2){
+        return 0;
+    }
+
+    // Ordenación paralela de los trozos iniciales:
+    grain = tpool_grain(pool, array->size, grain);
+    struct palgo_merge_ctx merge_ctx = {
+        .src = (const uint8_t *)array->arr, .dst = (uint8_t *)array->arr, .width = grain,
+        .size = array->size, .element_size = array->element_size, .cmp_fn = cmp_fn
+    };
+    tpool_parallel_for(pool, 0, array->size, grain, _palgo_sort_range, &merge_ctx);
+
+    if (grain >= array->size){
+        return 0;
+    }
+
+    // Mezclas por pasadas alternando entre el array y un buffer auxiliar:
+    uint8_t * buffer = (uint8_t *)malloc(array->size * array->element_size);
+    if (buffer == NULL){
+        return 2;
+    }
+
+    merge_ctx.dst = buffer;
+    while (merge_ctx.width < array->size){
+        tpool_parallel_for(pool, 0, array->size, 2 * merge_ctx.width, _palgo_merge_range, &merge_ctx);
+
+        uint8_t * temp_src = (uint8_t *)merge_ctx.src;
+        merge_ctx.src = merge_ctx.dst;
+        merge_ctx.dst = temp_src;
+        merge_ctx.width *= 2;
+    }
+
+    if (merge_ctx.src != array->arr){
+        memcpy(array->arr, merge_ctx.src, array->size * array->element_size);
+    }
+    free(buffer);
+
+    return 0;
+}
+
+/*
+    @brief Función para añadir al final de un array los datos de una lista simplemente enlazada, copiándolos en paralelo.
+    @note: El recorrido de la lista es inevitablemente serie (solo se recogen referencias); la copia de los datos se reparte.
+
+    @param tpool_pt pool: Referencia al pool (NULL para ejecutar en serie).
+    @param const sll_linkedlist_pt list: Referencia a la lista.
+    @param array_pt out: Referencia al array de destino (mismo tamaño de elemento que la lista).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Lista o array no válidos.
+                -> 2: Error de reserva de memoria.
+                -> 3: El tamaño de elemento del array no coincide con el de la lista.
+*/
+uint8_t palgo_sllist_to_array(tpool_pt pool, const sll_linkedlist_pt list, array_pt out){
+    // Comprobación de lista y array válidos y compatibles:
+    if ((list == NULL) || (out == NULL)){
+        return 1;
+    }
+
+    if (out->element_size != list->data_size){
+        return 3;
+    }
+
+    if (list->size == 0){
+        return 0;
+    }
+
+    // Recogida de las referencias a los datos de cada nodo:
+    void ** sources = (void **)malloc(list->size * sizeof(void *));
+    if (sources == NULL){
+        return 2;
+    }
+
+    size_t n = 0;
+    for (sll_node_pt temp_node = list->head; temp_node != NULL; temp_node = temp_node->next){
+        sources[n++] = temp_node->data;
+    }
+
+    uint8_t status = _palgo_gather(pool, sources, n, out);
+    free(sources);
+
+    return status;
+}
+
+/*
+    @brief Función para añadir al final de un array los datos de una lista doblemente enlazada, copiándolos en paralelo.
+    @note: El recorrido de la lista es inevitablemente serie (solo se recogen referencias); la copia de los datos se reparte.
+
+    @param tpool_pt pool: Referencia al pool (NULL para ejecutar en serie).
+    @param const dll_linkedlist_pt list: Referencia a la lista.
+    @param array_pt out: Referencia al array de destino (mismo tamaño de elemento que la lista).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Lista o array no válidos.
+                -> 2: Error de reserva de memoria.
+                -> 3: El tamaño de elemento del array no coincide con el de la lista.
+*/
+uint8_t palgo_dllist_to_array(tpool_pt pool, const dll_linkedlist_pt list, array_pt out){
+    // Comprobación de lista y array válidos y compatibles:
+    if ((list == NULL) || (out == NULL)){
+        return 1;
+    }
+
+    if (out->element_size != list->data_size){
+        return 3;
+    }
+
+    if (list->size == 0){
+        return 0;
+    }
+
+    // Recogida de las referencias a los datos de cada nodo:
+    void ** sources = (void **)malloc(list->size * sizeof(void *));
+    if (sources == NULL){
+        return 2;
+    }
+
+    size_t n = 0;
+    for (dll_node_pt temp_node = list->head; temp_node != NULL; temp_node = temp_node->next){
+        sources[n++] = temp_node->data;
+    }
+
+    uint8_t status = _palgo_gather(pool, sources, n, out);
+    free(sources);
+
+    return status;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna (trozo de parallel_for) que pasa un trozo del array a la función de usuario.
+
+    @param size_t begin: Primer índice del trozo.
+    @param size_t end: Índice final (excluido) del trozo.
+    @param void * arg: Referencia al contexto (struct palgo_foreach_ctx).
+
+    @retval None.
+*/
+static void _palgo_foreach_range(size_t begin, size_t end, void * arg){
+    struct palgo_foreach_ctx * foreach_ctx = (struct palgo_foreach_ctx *)arg;
+    array_pt array = foreach_ctx->array;
+
+    foreach_ctx->chunk_fn((uint8_t *)array->arr + (begin * array->element_size), end - begin, foreach_ctx->ctx);
+}
+
+/*
+    @brief Función interna (trozo de parallel_for) que acumula cada trozo de grano en su acumulador parcial.
+
+    @param size_t begin: Primer índice del trozo (múltiplo del grano).
+    @param size_t end: Índice final (excluido) del trozo.
+    @param void * arg: Referencia al contexto (struct palgo_reduce_ctx).
+
+    @retval None.
+*/
+static void _palgo_reduce_range(size_t begin, size_t end, void * arg){
+    struct palgo_reduce_ctx * reduce_ctx = (struct palgo_reduce_ctx *)arg;
+    const uint8_t * elements = (const uint8_t *)reduce_ctx->array->arr;
+    size_t element_size = reduce_ctx->array->element_size;
+
+    for (size_t chunk_begin = begin; chunk_begin < end; chunk_begin += reduce_ctx->grain){
+        size_t chunk_end = (chunk_begin + reduce_ctx->grain < end) ? chunk_begin + reduce_ctx->grain : end;
+        void * acc = reduce_ctx->partials + ((chunk_begin / reduce_ctx->grain) * reduce_ctx->acc_size);
+
+        memcpy(acc, reduce_ctx->identity, reduce_ctx->acc_size);
+        for (size_t i = chunk_begin; i < chunk_end; i++){
+            reduce_ctx->fold_fn(acc, elements + (i * element_size), reduce_ctx->ctx);
+        }
+    }
+}
+
+/*
+    @brief Función interna (trozo de parallel_for) que busca el primer elemento del trozo que cumple el predicado.
+
+    @param size_t begin: Primer índice del trozo.
+    @param size_t end: Índice final (excluido) del trozo.
+    @param void * arg: Referencia al contexto (struct palgo_find_ctx).
+
+    @retval None.
+*/
+static void _palgo_find_range(size_t begin, size_t end, void * arg){
+    struct palgo_find_ctx * find_ctx = (struct palgo_find_ctx *)arg;
+    const uint8_t * elements = (const uint8_t *)find_ctx->array->arr;
+    size_t element_size = find_ctx->array->element_size;
+
+    for (size_t i = begin; i < end; i++){
+        // Abandono si otro trozo anterior ya ha encontrado un índice menor:
+        size_t best = atomic_load_explicit(&find_ctx->best, memory_order_relaxed);
+        if (i >= best){
+            return;
+        }
+
+        if (find_ctx->pred_fn(elements + (i * element_size), find_ctx->ctx)){
+            while ((i < best) && !atomic_compare_exchange_weak_explicit(&find_ctx->best, &best, i, memory_order_relaxed, memory_order_relaxed));
+            return;
+        }
+    }
+}
+
+/*
+    @brief Función interna (trozo de parallel_for) que ordena con qsort cada trozo de grano.
+
+    @param size_t begin: Primer índice del trozo (múltiplo del grano).
+    @param size_t end: Índice final (excluido) del trozo.
+    @param void * arg: Referencia al contexto (struct palgo_merge_ctx, width es el grano).
+
+    @retval None.
+*/
+static void _palgo_sort_range(size_t begin, size_t end, void * arg){
+    struct palgo_merge_ctx * merge_ctx = (struct palgo_merge_ctx *)arg;
+
+    for (size_t chunk_begin = begin; chunk_begin < end; chunk_begin += merge_ctx->width){
+        size_t chunk_end = (chunk_begin + merge_ctx->width < end) ? chunk_begin + merge_ctx->width : end;
+        qsort(merge_ctx->dst + (chunk_begin * merge_ctx->element_size), chunk_end - chunk_begin, merge_ctx->element_size, merge_ctx->cmp_fn);
+    }
+}
+
+/*
+    @brief Función interna (trozo de parallel_for) que mezcla parejas de tramos ordenados de longitud width.
+
+    @param size_t begin: Primer índice del trozo (múltiplo de 2 * width).
+    @param size_t end: Índice final (excluido) del trozo.
+    @param void * arg: Referencia al contexto (struct palgo_merge_ctx).
+
+    @retval None.
+*/
+static void _palgo_merge_range(size_t begin, size_t end, void * arg){
+    struct palgo_merge_ctx * merge_ctx = (struct palgo_merge_ctx *)arg;
+    size_t element_size = merge_ctx->element_size;
+
+    for (size_t pair_begin = begin; pair_begin < end; pair_begin += 2 * merge_ctx->width){
+        size_t mid = (pair_begin + merge_ctx->width < merge_ctx->size) ? pair_begin + merge_ctx->width : merge_ctx->size;
+        size_t pair_end = (mid + merge_ctx->width < merge_ctx->size) ? mid + merge_ctx->width : merge_ctx->size;
+
+        // Mezcla de [pair_begin, mid) y [mid, pair_end) (a igualdad, primero el tramo izquierdo):
+        size_t left = pair_begin;
+        size_t right = mid;
+        uint8_t * out = merge_ctx->dst + (pair_begin * element_size);
+        while ((left < mid) && (right < pair_end)){
+            const uint8_t * left_element = merge_ctx->src + (left * element_size);
+            const uint8_t * right_element = merge_ctx->src + (right * element_size);
+            if (merge_ctx->cmp_fn(left_element, right_element) <= 0){
+                memcpy(out, left_element, element_size);
+                left++;
+            } else {
+                memcpy(out, right_element, element_size);
+                right++;
+            }
+            out += element_size;
+        }
+
+        memcpy(out, merge_ctx->src + (left * element_size), (mid - left) * element_size);
+        out += (mid - left) * element_size;
+        memcpy(out, merge_ctx->src + (right * element_size), (pair_end - right) * element_size);
+    }
+}
+
+/*
+    @brief Función interna (trozo de parallel_for) que copia los datos referenciados a su posición del array.
+
+    @param size_t begin: Primer índice del trozo.
+    @param size_t end: Índice final (excluido) del trozo.
+    @param void * arg: Referencia al contexto (struct palgo_copy_ctx).
+
+    @retval None.
+*/
+static void _palgo_copy_range(size_t begin, size_t end, void * arg){
+    struct palgo_copy_ctx * copy_ctx = (struct palgo_copy_ctx *)arg;
+
+    for (size_t i = begin; i < end; i++){
+        memcpy(copy_ctx->dst + (i * copy_ctx->element_size), copy_ctx->sources[i], copy_ctx->element_size);
+    }
+}
+
+/*
+    @brief Función interna que reserva espacio al final del array y copia en paralelo los datos referenciados.
+
+    @param tpool_pt pool: Referencia al pool.
+    @param void ** sources: Referencias a los datos.
+    @param size_t n: Número de referencias.
+    @param array_pt out: Referencia al array de destino.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 2: Error de reserva de memoria.
+*/
+static uint8_t _palgo_gather(tpool_pt pool, void ** sources, size_t n, array_pt out){
+    if (array_reserve(out, out->size + n) != 0){
+        return 2;
+    }
+
+    struct palgo_copy_ctx copy_ctx = {
+        .sources = sources,
+        .dst = (uint8_t *)out->arr + (out->size * out->element_size),
+        .element_size = out->element_size
+    };
+    tpool_parallel_for(pool, 0, n, 0, _palgo_copy_range, &copy_ctx);
+    out->size += n;
+
+    return 0;
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
@@ -0,0 +1,77 @@
+#ifndef PALGO_HEADER
+#define PALGO_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "tpool.h"
+#include "../array/array.h"
+#include "../llist/sllist.h"
+#include "../llist/dllist.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos --------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct palgo_foreach_ctx{
+    array_t * array;                    // Array recorrido.
+    void (*chunk_fn)(void *, size_t, void *);   // Función de trozo (primer elemento, nº de elementos, contexto).
+    void * ctx;                         // Contexto de usuario.
+};
+
+struct palgo_reduce_ctx{
+    const array_t * array;              // Array recorrido.
+    size_t grain;                       // Elementos por acumulador parcial.
+    const void * identity;              // Valor inicial de cada acumulador.
+    size_t acc_size;                    // Tamaño (bytes) del acumulador.
+    void (*fold_fn)(void *, const void *, void *);  // Acumulación de un elemento (acumulador, elemento, contexto).
+    void * ctx;                         // Contexto de usuario.
+    uint8_t * partials;                 // Acumuladores parciales (uno por trozo de grano).
+};
+
+struct palgo_find_ctx{
+    const array_t * array;              // Array recorrido.
+    bool (*pred_fn)(const void *, void *);  // Predicado de búsqueda.
+    void * ctx;                         // Contexto de usuario.
+    atomic_size_t best;                 // Menor índice encontrado hasta el momento (SIZE_MAX si ninguno).
+};
+
+struct palgo_merge_ctx{
+    const uint8_t * src;                // Tramos ordenados de origen.
+    uint8_t * dst;                      // Destino de la mezcla.
+    size_t width;                       // Longitud de los tramos ordenados.
+    size_t size;                        // Número de elementos.
+    size_t element_size;                // Tamaño (bytes) del elemento.
+    int (*cmp_fn)(const void *, const void *);  // Función comparadora.
+};
+
+struct palgo_copy_ctx{
+    void ** sources;                    // Referencias a los datos de cada nodo.
+    uint8_t * dst;                      // Destino de la copia en el array.
+    size_t element_size;                // Tamaño (bytes) del elemento.
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Recorrido y reducción de arrays:
+uint8_t palgo_array_foreach(tpool_pt pool, array_pt array, size_t grain, void (*chunk_fn)(void *, size_t, void *), void * ctx);
+uint8_t palgo_array_reduce(tpool_pt pool, const array_pt array, size_t grain, const void * identity, size_t acc_size,
+                           void (*fold_fn)(void *, const void *, void *), void (*combine_fn)(void *, const void *, void *), void * ctx, void * out_acc);
+
+// Búsqueda y ordenación de arrays:
+uint8_t palgo_array_find(tpool_pt pool, const array_pt array, size_t grain, bool (*pred_fn)(const void *, void *), void * ctx, size_t * out_index);
+uint8_t palgo_array_sort(tpool_pt pool, array_pt array, size_t grain, int (*cmp_fn)(const void *, const void *));
+
+// Conversión de listas a arrays:
+uint8_t palgo_sllist_to_array(tpool_pt pool, const sll_linkedlist_pt list, array_pt out);
+uint8_t palgo_dllist_to_array(tpool_pt pool, const dll_linkedlist_pt list, array_pt out);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
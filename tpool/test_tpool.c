@@ -0,0 +1,190 @@
+#include "palgo.h"
+#include <stdio.h>
+
+#define TEST_ELEMENTS 200000
+
+// Prototipos de funciones:
+void count_task(void * ctx);
+void square_range(size_t begin, size_t end, void * ctx);
+void add_one_chunk(void * elements, size_t count, void * ctx);
+void sum_fold(void * acc, const void * element, void * ctx);
+void sum_combine(void * acc, const void * partial, void * ctx);
+bool is_target(const void * element, void * ctx);
+int cmp_uint32(const void * a, const void * b);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación del pool (un trabajador por CPU) con grano automático:
+    tpool_pt pool = tpool_init(0);
+    printf("\nSe ha creado el pool correctamente en la dirección (%p) con %ld trabajadores\n", (void *)pool, tpool_worker_count(pool));
+
+    // Grupo de tareas sueltas y espera:
+    atomic_size_t counter = 0;
+    tpool_group_t group;
+    tpool_group_init(&group);
+    for (size_t i = 0; i < 100; i++){
+        tpool_spawn(pool, &group, count_task, &counter);
+    }
+    tpool_group_wait(pool, &group);
+    printf("Tareas del grupo ejecutadas: %ld\n", (size_t)atomic_load(&counter));
+
+    // Bucle paralelo sobre un vector de enteros:
+    uint64_t * squares = (uint64_t *)malloc(TEST_ELEMENTS * sizeof(uint64_t));
+    tpool_parallel_for(pool, 0, TEST_ELEMENTS, 0, square_range, squares);
+    printf("parallel_for: cuadrado de %d = %lu (grano efectivo: %ld)\n", TEST_ELEMENTS - 1, squares[TEST_ELEMENTS - 1], tpool_grain(pool, TEST_ELEMENTS, 0));
+    free(squares);
+
+    // Array de prueba en orden inverso:
+    array_pt array = array_init(sizeof(uint32_t));
+    array_reserve(array, TEST_ELEMENTS);
+    for (uint32_t i = 0; i < TEST_ELEMENTS; i++){
+        uint32_t value = TEST_ELEMENTS - 1 - i;
+        array_set(array, &value, i);
+    }
+
+    // Recorrido por trozos, reducción y búsqueda:
+    palgo_array_foreach(pool, array, 0, add_one_chunk, NULL);
+
+    uint64_t identity = 0;
+    uint64_t sum = 0;
+    palgo_array_reduce(pool, array, 0, &identity, sizeof(uint64_t), sum_fold, sum_combine, NULL, &sum);
+    printf("\nSuma tras sumar 1 a cada elemento: %lu (esperada: %lu)\n", sum, (uint64_t)TEST_ELEMENTS * (TEST_ELEMENTS + 1) / 2);
+
+    uint32_t target = 1000;
+    size_t index;
+    if (palgo_array_find(pool, array, 0, is_target, &target, &index) == 0){
+        printf("Primer elemento igual a %u en la posición: %ld\n", target, index);
+    }
+
+    // Ordenación paralela:
+    palgo_array_sort(pool, array, 0, cmp_uint32);
+    bool sorted = true;
+    uint32_t prev = 0;
+    for (size_t i = 0; i < array_size(array); i++){
+        uint32_t value;
+        array_get(array, i, &value);
+        sorted &= (value >= prev);
+        prev = value;
+    }
+    printf("Array ordenado: %s\n", sorted ? "sí" : "no");
+
+    // Conversión de una lista a array (copia paralela de los datos):
+    dll_linkedlist_pt list = dllist_init(sizeof(uint32_t));
+    for (uint32_t i = 0; i < 10; i++){
+        dllist_push_back(list, &i);
+    }
+    array_pt from_list = array_init(sizeof(uint32_t));
+    palgo_dllist_to_array(pool, list, from_list);
+    printf("\nLista convertida a array de %ld elementos:", array_size(from_list));
+    for (size_t i = 0; i < array_size(from_list); i++){
+        uint32_t value;
+        array_get(from_list, i, &value);
+        printf(" %u", value);
+    }
+    printf("\n");
+
+    // Liberación de recursos:
+    dllist_deinit(&list);
+    array_deinit(from_list);
+    array_deinit(array);
+    tpool_deinit(&pool);
+    printf("\nPool destruido, referencia: %p\n", (void *)pool);
+
+    return 0;
+}
+
+/*
+    @brief Tarea que incrementa un contador atómico.
+
+    @param void * ctx: Referencia al contador (atomic_size_t).
+
+    @retval None.
+*/
+void count_task(void * ctx){
+    atomic_fetch_add((atomic_size_t *)ctx, 1);
+}
+
+/*
+    @brief Trozo de parallel_for que guarda el cuadrado de cada índice.
+
+    @param size_t begin: Primer índice del trozo.
+    @param size_t end: Índice final (excluido) del trozo.
+    @param void * ctx: Referencia al vector de resultados (uint64_t).
+
+    @retval None.
+*/
+void square_range(size_t begin, size_t end, void * ctx){
+    uint64_t * squares = (uint64_t *)ctx;
+    for (size_t i = begin; i < end; i++){
+        squares[i] = (uint64_t)i * i;
+    }
+}
+
+/*
+    @brief Función de trozo que suma 1 a cada elemento.
+
+    @param void * elements: Referencia al primer elemento del trozo (uint32_t).
+    @param size_t count: Número de elementos del trozo.
+    @param void * ctx: Sin uso.
+
+    @retval None.
+*/
+void add_one_chunk(void * elements, size_t count, void * ctx){
+    uint32_t * values = (uint32_t *)elements;
+    for (size_t i = 0; i < count; i++){
+        values[i]++;
+    }
+}
+
+/*
+    @brief Acumulación de un elemento uint32_t en una suma uint64_t.
+
+    @param void * acc: Referencia al acumulador (uint64_t).
+    @param const void * element: Referencia al elemento (uint32_t).
+    @param void * ctx: Sin uso.
+
+    @retval None.
+*/
+void sum_fold(void * acc, const void * element, void * ctx){
+    *(uint64_t *)acc += *(const uint32_t *)element;
+}
+
+/*
+    @brief Combinación de una suma parcial en el acumulador.
+
+    @param void * acc: Referencia al acumulador (uint64_t).
+    @param const void * partial: Referencia a la suma parcial (uint64_t).
+    @param void * ctx: Sin uso.
+
+    @retval None.
+*/
+void sum_combine(void * acc, const void * partial, void * ctx){
+    *(uint64_t *)acc += *(const uint64_t *)partial;
+}
+
+/*
+    @brief Predicado que indica si un elemento coincide con el valor dado como contexto.
+
+    @param const void * element: Referencia al elemento (uint32_t).
+    @param void * ctx: Referencia al valor buscado (uint32_t).
+
+    @retval bool: true si coinciden, false en caso contrario.
+*/
+bool is_target(const void * element, void * ctx){
+    return *(const uint32_t *)element == *(uint32_t *)ctx;
+}
+
+/*
+    @brief Comparador de uint32_t (estilo qsort).
+
+    @param const void * a: Referencia al primer elemento.
+    @param const void * b: Referencia al segundo elemento.
+
+    @retval int: <0, 0 o >0 según a sea menor, igual o mayor que b.
+*/
+int cmp_uint32(const void * a, const void * b){
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
\ No newline at end of file
@@ -0,0 +1,508 @@
+#include "tpool.h"
+
+#include <sched.h>
+#include <unistd.h>
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static void * _tpool_worker_main(void * arg);
+static uint8_t _tpool_push(tpool_pt pool, const tpool_task_pt task);
+static bool _tpool_find_task(tpool_pt pool, tpool_task_pt out_task);
+static void _tpool_execute(tpool_pt pool, tpool_task_pt task);
+static void _tpool_run_range(tpool_pt pool, tpool_group_pt group, void (*range_fn)(size_t, size_t, void *), size_t begin, size_t end, size_t grain, void * ctx);
+static void _tpool_stop_workers(tpool_pt pool, size_t started);
+/* ---------------------------------------------------------------- */
+
+
+/* --- Variables internas ----------------------------------------- */
+/* ---------------------------------------------------------------- */
+static _Thread_local tpool_worker_pt _tpool_self = NULL;   // Trabajador del hilo actual (NULL en hilos externos).
+static _Thread_local uint64_t _tpool_seed = 0;             // Semilla de robo de los hilos externos.
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear un pool de hilos con robo de trabajo y arrancar sus trabajadores.
+    @note: Cada trabajador tiene su cola Chase-Lev; las tareas enviadas desde otros hilos entran por una cola MPMC común.
+
+    @param size_t worker_count: Número de trabajadores (0 para uno por CPU disponible).
+
+    @retval tpool_pt: Referencia al pool creado.
+*/
+tpool_pt tpool_init(size_t worker_count){
+    // Número de trabajadores por defecto y comprobación de límites:
+    if (worker_count == 0){
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        worker_count = (cpus > 0) ? (size_t)cpus : 1;
+        if (worker_count > TPOOL_MAX_WORKERS){
+            worker_count = TPOOL_MAX_WORKERS;
+        }
+    }
+
+    if (worker_count > TPOOL_MAX_WORKERS){
+        return NULL;
+    }
+
+    // Reserva de memoria de la estructura, los trabajadores y la cola de entrada:
+    tpool_pt pool = (tpool_pt)malloc(sizeof(tpool_t));
+    if (pool == NULL){
+        return NULL;
+    }
+
+    pool->workers = (tpool_worker_pt)calloc(worker_count, sizeof(tpool_worker_t));
+    pool->inject = mpmcq_init(sizeof(tpool_task_t), TPOOL_INJECT_CAPACITY);
+    if ((pool->workers == NULL) || (pool->inject == NULL)){
+        free(pool->workers);
+        mpmcq_deinit(&pool->inject);
+        free(pool);
+        return NULL;
+    }
+
+    // Inicio de los miembros de la estructura:
+    pool->worker_count = worker_count;
+    pthread_mutex_init(&pool->sleep_lock, NULL);
+    pthread_cond_init(&pool->sleep_cond, NULL);
+    atomic_init(&pool->epoch, 0);
+    atomic_init(&pool->sleepers, 0);
+    atomic_init(&pool->stop, false);
+    pool->grain = 0;
+    pool->serial_threshold = TPOOL_DEFAULT_SERIAL;
+
+    for (size_t i = 0; i < worker_count; i++){
+        pool->workers[i].deque = wsdeque_init(sizeof(tpool_task_t), 0);
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+        pool->workers[i].seed = 0x9E3779B97F4A7C15ULL * (i + 1);
+        if (pool->workers[i].deque == NULL){
+            _tpool_stop_workers(pool, 0);
+            return NULL;
+        }
+    }
+
+    // Arranque de los trabajadores:
+    for (size_t i = 0; i < worker_count; i++){
+        if (pthread_create(&pool->workers[i].thread, NULL, _tpool_worker_main, &pool->workers[i]) != 0){
+            _tpool_stop_workers(pool, i);
+            return NULL;
+        }
+    }
+
+    return pool;
+}
+
+/*
+    @brief Función para detener los trabajadores y liberar el pool.
+    @note: Las tareas pendientes que no pertenezcan a un grupo ya esperado se descartan.
+
+    @param tpool_pt * pool: Referencia a la referencia del pool.
+
+    @retval None.
+*/
+void tpool_deinit(tpool_pt * pool){
+    // Comprobación de que el pool no sea nulo:
+    if ((pool == NULL) || (*pool == NULL)){
+        return;
+    }
+
+    _tpool_stop_workers(*pool, (*pool)->worker_count);
+    *pool = NULL;
+}
+
+/*
+    @brief Función para ajustar el grano por defecto de parallel_for y el umbral de ejecución en serie.
+
+    @param tpool_pt pool: Referencia al pool.
+    @param size_t grain: Tamaño máximo de rango que ejecuta una tarea sin dividir (0: automático según el número de trabajadores).
+    @param size_t serial_threshold: Rangos de hasta este tamaño se ejecutan en serie en el hilo llamante.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Pool no válido.
+*/
+uint8_t tpool_set_grain(tpool_pt pool, size_t grain, size_t serial_threshold){
+    // Comprobación de pool válido:
+    if (pool == NULL){
+        return 1;
+    }
+
+    pool->grain = grain;
+    pool->serial_threshold = serial_threshold;
+
+    return 0;
+}
+
+/*
+    @brief Función para iniciar un grupo de tareas vacío.
+
+    @param tpool_group_pt group: Referencia al grupo.
+
+    @retval None.
+*/
+void tpool_group_init(tpool_group_pt group){
+    // Comprobación de grupo válido:
+    if (group == NULL){
+        return;
+    }
+
+    atomic_init(&group->pending, 0);
+}
+
+/*
+    @brief Función para lanzar una tarea dentro de un grupo.
+    @note: Desde un trabajador la tarea va a su propia cola; desde otro hilo, a la cola de entrada. Si no cabe, se ejecuta en el acto.
+
+    @param tpool_pt pool: Referencia al pool.
+    @param tpool_group_pt group: Referencia al grupo.
+    @param void (*task_fn)(void *): Función de la tarea.
+    @param void * ctx: Contexto de la tarea.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Pool, grupo o función no válidos.
+*/
+uint8_t tpool_spawn(tpool_pt pool, tpool_group_pt group, void (*task_fn)(void *), void * ctx){
+    // Comprobación de pool, grupo y función válidos:
+    if ((pool == NULL) || (group == NULL) || (task_fn == NULL)){
+        return 1;
+    }
+
+    // Publicación de la tarea (o ejecución inmediata si las colas están llenas):
+    tpool_task_t task = {.task_fn = task_fn, .range_fn = NULL, .begin = 0, .end = 0, .grain = 0, .ctx = ctx, .group = group};
+    atomic_fetch_add_explicit(&group->pending, 1, memory_order_relaxed);
+    if (_tpool_push(pool, &task) != 0){
+        _tpool_execute(pool, &task);
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función para esperar a que terminen todas las tareas de un grupo, ejecutando tareas pendientes mientras tanto.
+
+    @param tpool_pt pool: Referencia al pool.
+    @param tpool_group_pt group: Referencia al grupo.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Pool o grupo no válidos.
+*/
+uint8_t tpool_group_wait(tpool_pt pool, tpool_group_pt group){
+    // Comprobación de pool y grupo válidos:
+    if ((pool == NULL) || (group == NULL)){
+        return 1;
+    }
+
+    // Ayuda a los trabajadores hasta que el grupo quede vacío:
+    tpool_task_t task;
+    while (atomic_load_explicit(&group->pending, memory_order_acquire) != 0){
+        if (_tpool_find_task(pool, &task)){
+            _tpool_execute(pool, &task);
+        } else {
+            sched_yield();
+        }
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función para ejecutar range_fn sobre [begin, end) repartiendo el rango entre los trabajadores.
+    @note: El rango se divide por mitades (la mitad derecha queda disponible para robo) hasta el grano; por debajo del umbral, o sin pool, se ejecuta en serie.
+    @note: Los trozos que recibe range_fn empiezan en begin + k * grano (pueden abarcar varios granos si no se pudo publicar una mitad).
+
+    @param tpool_pt pool: Referencia al pool (NULL para ejecutar en serie).
+    @param size_t begin: Inicio del rango.
+    @param size_t end: Fin (excluido) del rango.
+    @param size_t grain: Tamaño máximo de los trozos (0 para el grano por defecto del pool).
+    @param void (*range_fn)(size_t, size_t, void *): Función que procesa un trozo [inicio, fin) con el contexto.
+    @param void * ctx: Contexto de la función.
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 1: Función no válida.
+*/
+uint8_t tpool_parallel_for(tpool_pt pool, size_t begin, size_t end, size_t grain, void (*range_fn)(size_t, size_t, void *), void * ctx){
+    // Comprobación de función válida y rango no vacío:
+    if (range_fn == NULL){
+        return 1;
+    }
+
+    if (begin >= end){
+        return 0;
+    }
+
+    // Ejecución en serie por debajo del umbral:
+    size_t n = end - begin;
+    if ((pool == NULL) || (n <= pool->serial_threshold)){
+        range_fn(begin, end, ctx);
+        return 0;
+    }
+
+    // División recursiva desde el hilo llamante y espera del grupo:
+    tpool_group_t group;
+    tpool_group_init(&group);
+    _tpool_run_range(pool, &group, range_fn, begin, end, tpool_grain(pool, n, grain), ctx);
+
+    return tpool_group_wait(pool, &group);
+}
+
+/*
+    @brief Función que retorna el grano efectivo que usará parallel_for para un rango de n elementos.
+
+    @param const tpool_pt pool: Referencia al pool (NULL: un único trozo).
+    @param size_t n: Tamaño del rango.
+    @param size_t grain: Grano pedido (0 para el grano por defecto del pool, o automático si este también es 0).
+
+    @retval size_t: Grano efectivo (al menos 1).
+*/
+size_t tpool_grain(const tpool_pt pool, size_t n, size_t grain){
+    // Rango completo si no hay pool o se ejecutará en serie:
+    if ((pool == NULL) || (n <= pool->serial_threshold)){
+        return (n > 0) ? n : 1;
+    }
+
+    // Grano explícito, por defecto del pool o automático (varios trozos por hilo):
+    if (grain == 0){
+        grain = pool->grain;
+    }
+    if (grain == 0){
+        grain = n / ((pool->worker_count + 1) * TPOOL_AUTO_SPLIT);
+    }
+
+    return (grain > 0) ? grain : 1;
+}
+
+/*
+    @brief Función que retorna el número de trabajadores del pool.
+
+    @param const tpool_pt pool: Referencia al pool.
+
+    @retval size_t: Número de trabajadores.
+*/
+size_t tpool_worker_count(const tpool_pt pool){
+    // Comprobación de pool válido:
+    if (pool == NULL){
+        return 0;
+    }
+
+    return pool->worker_count;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+
+
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna con el bucle de un trabajador: busca tareas (propias, de entrada o robadas) y duerme si no hay.
+
+    @param void * arg: Referencia al trabajador (tpool_worker_pt).
+
+    @retval void *: NULL.
+*/
+static void * _tpool_worker_main(void * arg){
+    tpool_worker_pt worker = (tpool_worker_pt)arg;
+    tpool_pt pool = worker->pool;
+    _tpool_self = worker;
+
+    tpool_task_t task;
+    uint32_t rounds = 0;
+    while (!atomic_load_explicit(&pool->stop, memory_order_acquire)){
+        // Lectura del contador de publicaciones antes de buscar (una publicación posterior impide dormir):
+        unsigned int epoch = atomic_load(&pool->epoch);
+        if (_tpool_find_task(pool, &task)){
+            _tpool_execute(pool, &task);
+            rounds = 0;
+            continue;
+        }
+
+        if (++rounds < TPOOL_SPIN_ROUNDS){
+            sched_yield();
+            continue;
+        }
+
+        // Espera hasta una nueva publicación o la parada:
+        pthread_mutex_lock(&pool->sleep_lock);
+        atomic_fetch_add(&pool->sleepers, 1);
+        while (!atomic_load(&pool->stop) && (atomic_load(&pool->epoch) == epoch)){
+            pthread_cond_wait(&pool->sleep_cond, &pool->sleep_lock);
+        }
+        atomic_fetch_sub(&pool->sleepers, 1);
+        pthread_mutex_unlock(&pool->sleep_lock);
+        rounds = 0;
+    }
+
+    return NULL;
+}
+
+/*
+    @brief Función interna que publica una tarea en la cola del trabajador actual o en la cola de entrada, y despierta a uno dormido.
+
+    @param tpool_pt pool: Referencia al pool.
+    @param const tpool_task_pt task: Referencia a la tarea (se copia).
+
+    @retval uint8_t:
+                -> 0: No han ocurrido errores.
+                -> 2: No se ha podido publicar (cola llena o sin memoria).
+*/
+static uint8_t _tpool_push(tpool_pt pool, const tpool_task_pt task){
+    tpool_worker_pt self = _tpool_self;
+    uint8_t status;
+    if ((self != NULL) && (self->pool == pool)){
+        status = wsdeque_push(self->deque, task);
+    } else {
+        status = mpmcq_try_push(pool->inject, task);
+    }
+
+    if (status != 0){
+        return 2;
+    }
+
+    // Aviso a los trabajadores dormidos (emparejado con el contador de dormidos):
+    atomic_fetch_add(&pool->epoch, 1);
+    if (atomic_load(&pool->sleepers) != 0){
+        pthread_mutex_lock(&pool->sleep_lock);
+        pthread_cond_signal(&pool->sleep_cond);
+        pthread_mutex_unlock(&pool->sleep_lock);
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función interna que busca una tarea: cola propia (LIFO), cola de entrada y, por último, robo a otro trabajador.
+
+    @param tpool_pt pool: Referencia al pool.
+    @param tpool_task_pt out_task: Referencia a la tarea encontrada.
+
+    @retval bool: true si se ha encontrado una tarea, false en otro caso.
+*/
+static bool _tpool_find_task(tpool_pt pool, tpool_task_pt out_task){
+    tpool_worker_pt self = _tpool_self;
+    if ((self != NULL) && (self->pool != pool)){
+        self = NULL;
+    }
+
+    // Cola propia y cola de entrada:
+    if ((self != NULL) && (wsdeque_pop(self->deque, out_task) == 0)){
+        return true;
+    }
+
+    if (mpmcq_try_pop(pool->inject, out_task) == 0){
+        return true;
+    }
+
+    // Robo empezando por una víctima pseudoaleatoria:
+    uint64_t * seed = (self != NULL) ? &self->seed : &_tpool_seed;
+    if (*seed == 0){
+        *seed = (uint64_t)(uintptr_t)seed | 1;
+    }
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    size_t start = (size_t)(*seed % pool->worker_count);
+
+    for (size_t i = 0; i < pool->worker_count; i++){
+        tpool_worker_pt victim = &pool->workers[(start + i) % pool->worker_count];
+        if (victim == self){
+            continue;
+        }
+
+        uint8_t status;
+        while ((status = wsdeque_steal(victim->deque, out_task)) == 3);
+        if (status == 0){
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+    @brief Función interna que ejecuta una tarea y la descuenta de su grupo.
+
+    @param tpool_pt pool: Referencia al pool.
+    @param tpool_task_pt task: Referencia a la tarea.
+
+    @retval None.
+*/
+static void _tpool_execute(tpool_pt pool, tpool_task_pt task){
+    if (task->task_fn != NULL){
+        task->task_fn(task->ctx);
+    } else {
+        _tpool_run_range(pool, task->group, task->range_fn, task->begin, task->end, task->grain, task->ctx);
+    }
+
+    atomic_fetch_sub_explicit(&task->group->pending, 1, memory_order_release);
+}
+
+/*
+    @brief Función interna que divide un rango por mitades publicando la derecha y procesa el trozo izquierdo restante.
+    @note: Los puntos de corte son múltiplos del grano desde el inicio, así que cada trozo final está alineado al grano.
+
+    @param tpool_pt pool: Referencia al pool.
+    @param tpool_group_pt group: Referencia al grupo del bucle.
+    @param void (*range_fn)(size_t, size_t, void *): Función que procesa un trozo.
+    @param size_t begin: Inicio del rango.
+    @param size_t end: Fin (excluido) del rango.
+    @param size_t grain: Tamaño máximo de trozo.
+    @param void * ctx: Contexto de la función.
+
+    @retval None.
+*/
+static void _tpool_run_range(tpool_pt pool, tpool_group_pt group, void (*range_fn)(size_t, size_t, void *), size_t begin, size_t end, size_t grain, void * ctx){
+    while ((end - begin) > grain){
+        size_t chunks = (end - begin + grain - 1) / grain;
+        size_t mid = begin + (chunks / 2) * grain;
+        tpool_task_t task = {.task_fn = NULL, .range_fn = range_fn, .begin = mid, .end = end, .grain = grain, .ctx = ctx, .group = group};
+
+        atomic_fetch_add_explicit(&group->pending, 1, memory_order_relaxed);
+        if (_tpool_push(pool, &task) != 0){
+            atomic_fetch_sub_explicit(&group->pending, 1, memory_order_relaxed);
+            break;
+        }
+        end = mid;
+    }
+
+    range_fn(begin, end, ctx);
+}
+
+/*
+    @brief Función interna que detiene y espera a los trabajadores arrancados y libera todos los recursos del pool.
+
+    @param tpool_pt pool: Referencia al pool.
+    @param size_t started: Número de trabajadores arrancados.
+
+    @retval None.
+*/
+static void _tpool_stop_workers(tpool_pt pool, size_t started){
+    // Aviso de parada y espera de los hilos:
+    pthread_mutex_lock(&pool->sleep_lock);
+    atomic_store(&pool->stop, true);
+    pthread_cond_broadcast(&pool->sleep_cond);
+    pthread_mutex_unlock(&pool->sleep_lock);
+
+    for (size_t i = 0; i < started; i++){
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+
+    // Liberación de colas, sincronización y estructura:
+    for (size_t i = 0; i < pool->worker_count; i++){
+        wsdeque_deinit(&pool->workers[i].deque);
+    }
+    mpmcq_deinit(&pool->inject);
+    pthread_mutex_destroy(&pool->sleep_lock);
+    pthread_cond_destroy(&pool->sleep_cond);
+    free(pool->workers);
+    free(pool);
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
@@ -0,0 +1,106 @@
+#ifndef TPOOL_HEADER
+#define TPOOL_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "../deque/wsdeque.h"
+#include "../queue/mpmcq.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define TPOOL_MAX_WORKERS 256           // Número máximo de hilos trabajadores.
+#define TPOOL_INJECT_CAPACITY 1024      // Capacidad de la cola de tareas enviadas desde hilos externos.
+#define TPOOL_SPIN_ROUNDS 64            // Búsquedas de trabajo fallidas antes de dormir.
+#define TPOOL_DEFAULT_SERIAL 4096       // Rangos de hasta este tamaño se ejecutan en serie (umbral por defecto).
+#define TPOOL_AUTO_SPLIT 4              // Con grano automático, trozos por trabajador.
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos --------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct tpool_group{
+    atomic_size_t pending;              // Tareas del grupo pendientes de terminar.
+};
+
+struct tpool_task{
+    void (*task_fn)(void *);            // Función de tarea simple (NULL si es un rango).
+    void (*range_fn)(size_t, size_t, void *);   // Función de rango [inicio, fin) de parallel_for.
+    size_t begin;                       // Inicio del rango.
+    size_t end;                         // Fin (excluido) del rango.
+    size_t grain;                       // Tamaño máximo de rango que se ejecuta sin dividir.
+    void * ctx;                         // Contexto de usuario.
+    struct tpool_group * group;         // Grupo al que pertenece la tarea.
+};
+
+struct tpool_worker{
+    wsdeque_pt deque;                   // Cola de tareas propia (el resto de hilos roban de ella).
+    pthread_t thread;                   // Hilo del trabajador.
+    struct tpool * pool;                // Pool al que pertenece.
+    size_t index;                       // Índice del trabajador.
+    uint64_t seed;                      // Semilla para elegir víctimas de robo.
+};
+
+struct tpool{
+    struct tpool_worker * workers;      // Trabajadores.
+    size_t worker_count;                // Número de trabajadores.
+    mpmcq_pt inject;                    // Tareas enviadas desde hilos que no son trabajadores.
+
+    pthread_mutex_t sleep_lock;         // Protección de la espera de trabajadores sin tareas.
+    pthread_cond_t sleep_cond;          // Aviso de tareas nuevas o de parada.
+    atomic_uint epoch;                  // Contador de tareas publicadas (detecta avisos durante la búsqueda).
+    atomic_size_t sleepers;             // Trabajadores dormidos (o a punto de dormir).
+    atomic_bool stop;                   // Indica a los trabajadores que terminen.
+
+    size_t grain;                       // Grano por defecto de parallel_for (0: automático).
+    size_t serial_threshold;            // Rangos de hasta este tamaño se ejecutan en serie.
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct tpool_group tpool_group_t;
+typedef tpool_group_t * tpool_group_pt;
+
+typedef struct tpool_task tpool_task_t;
+typedef tpool_task_t * tpool_task_pt;
+
+typedef struct tpool_worker tpool_worker_t;
+typedef tpool_worker_t * tpool_worker_pt;
+
+typedef struct tpool tpool_t;
+typedef tpool_t * tpool_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción del pool:
+tpool_pt tpool_init(size_t worker_count);
+void tpool_deinit(tpool_pt * pool);
+uint8_t tpool_set_grain(tpool_pt pool, size_t grain, size_t serial_threshold);
+
+// Grupos de tareas:
+void tpool_group_init(tpool_group_pt group);
+uint8_t tpool_spawn(tpool_pt pool, tpool_group_pt group, void (*task_fn)(void *), void * ctx);
+uint8_t tpool_group_wait(tpool_pt pool, tpool_group_pt group);
+
+// Bucles paralelos:
+uint8_t tpool_parallel_for(tpool_pt pool, size_t begin, size_t end, size_t grain, void (*range_fn)(size_t, size_t, void *), void * ctx);
+
+// Utilidades generales:
+size_t tpool_grain(const tpool_pt pool, size_t n, size_t grain);
+size_t tpool_worker_count(const tpool_pt pool);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file
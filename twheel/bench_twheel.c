@@ -0,0 +1,209 @@
+#include "twheel.h"
+#include "../pqueue/pqueue.h"
+#include "../llist/dllist.h"
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_LIST_MAX 20000        // Temporizadores como máximo en la lista ordenada (inserción O(n)).
+
+struct bench_timer{
+    uint64_t expires;               // Tick de vencimiento.
+    uint64_t id;                    // Identificador del temporizador.
+};
+
+// Prototipos de funciones:
+double elapsed_ms(struct timespec start, struct timespec end);
+double mops(size_t ops, double ms);
+void count_expired(void * ctx, uint64_t expires, void * user);
+int cmp_timer(const void * a, const void * b, void * ctx);
+bool is_after(const void * target, const void * data, void * ctx);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Temporizadores vivos y alcance de los vencimientos en ticks (por argumento o por defecto):
+    size_t n = (argc > 1) ? strtoul(argv[1], NULL, 10) : 10000000;
+    uint64_t span = (argc > 2) ? strtoull(argv[2], NULL, 10) : (UINT64_C(1) << 20);
+    if (n == 0){
+        n = 1;
+    }
+    if (span < 2){
+        span = 2;
+    }
+
+    uint64_t * delays = (uint64_t *)malloc(n * sizeof(uint64_t));
+    twheel_handle_t * handles = (twheel_handle_t *)malloc(n * sizeof(twheel_handle_t));
+    size_t * pq_handles = (size_t *)malloc(n * sizeof(size_t));
+    if ((delays == NULL) || (handles == NULL) || (pq_handles == NULL)){
+        return 1;
+    }
+
+    uint64_t seed = 12345;
+    for (size_t i = 0; i < n; i++){
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        delays[i] = 1 + (seed >> 16) % (span - 1);
+    }
+
+    printf("\nTemporizadores: %ld, alcance: %lu ticks (se cancela la mitad)\n", n, span);
+    printf("%-22s %14s %14s %14s\n", "", "programar", "cancelar", "vencer");
+    printf("%-22s %14s %14s %14s\n", "", "(Mops/s)", "(Mops/s)", "(Mops/s)");
+
+    // Rueda jerárquica: programación, cancelación de la mitad por manejador y avance hasta vencer el resto:
+    struct timespec start, end;
+    twheel_pt wheel = twheel_init(0);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < n; i++){
+        twheel_schedule(wheel, delays[i], NULL, &handles[i]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double wheel_schedule = elapsed_ms(start, end);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < n; i += 2){
+        twheel_cancel(wheel, handles[i]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double wheel_cancel = elapsed_ms(start, end);
+
+    size_t wheel_fired = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    size_t wheel_expired = twheel_advance(wheel, span, count_expired, &wheel_fired);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double wheel_expire = elapsed_ms(start, end);
+    twheel_deinit(&wheel);
+
+    printf("%-22s %14.2f %14.2f %14.2f\n", "twheel", mops(n, wheel_schedule), mops((n + 1) / 2, wheel_cancel), mops(wheel_expired, wheel_expire));
+
+    // Montículo 4-ario indexado: inserción, borrado por manejador y extracción en orden de vencimiento:
+    pqueue_pt pqueue = pqueue_init(sizeof(struct bench_timer), 4, cmp_timer, NULL, true);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < n; i++){
+        struct bench_timer timer = {.expires = delays[i], .id = i};
+        pqueue_push(pqueue, &timer, &pq_handles[i]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double pq_schedule = elapsed_ms(start, end);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < n; i += 2){
+        pqueue_remove(pqueue, pq_handles[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double pq_cancel = elapsed_ms(start, end);
+
+    size_t pq_expired = 0;
+    struct bench_timer timer;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while (pqueue_pop(pqueue, &timer) == 0){
+        pq_expired++;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double pq_expire = elapsed_ms(start, end);
+    pqueue_deinit(&pqueue);
+
+    printf("%-22s %14.2f %14.2f %14.2f\n", "pqueue d=4 indexada", mops(n, pq_schedule), mops((n + 1) / 2, pq_cancel), mops(pq_expired, pq_expire));
+
+    // Lista doblemente enlazada ordenada (esquema anterior; inserción O(n), limitada a BENCH_LIST_MAX):
+    size_t list_n = (n < BENCH_LIST_MAX) ? n : BENCH_LIST_MAX;
+    dll_linkedlist_pt list = dllist_init(sizeof(struct bench_timer));
+    size_t index;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < list_n; i++){
+        timer = (struct bench_timer){.expires = delays[i], .id = i};
+        if (dllist_find_index(list, &timer, is_after, NULL, &index) == 0){
+            dllist_insert_at(list, &timer, index);
+        } else {
+            dllist_push_back(list, &timer);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double list_schedule = elapsed_ms(start, end);
+
+    size_t list_expired = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while (!dllist_is_empty(list)){
+        dllist_pop_front(list);
+        list_expired++;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double list_expire = elapsed_ms(start, end);
+    dllist_deinit(&list);
+
+    char name[32];
+    snprintf(name, sizeof(name), "dllist ordenada n=%ld", list_n);
+    printf("%-22s %14.2f %14s %14.2f\n", name, mops(list_n, list_schedule), "-", mops(list_expired, list_expire));
+
+    printf("\nComprobación de vencimientos: %s (rueda %ld, montículo %ld)\n",
+           ((wheel_expired == pq_expired) && (wheel_fired == wheel_expired)) ? "correcta" : "INCORRECTA", wheel_expired, pq_expired);
+
+    free(delays);
+    free(handles);
+    free(pq_handles);
+
+    return 0;
+}
+
+/*
+    @brief Función que calcula el tiempo transcurrido entre dos marcas de tiempo.
+
+    @param struct timespec start: Marca de inicio.
+    @param struct timespec end: Marca de fin.
+
+    @retval double: Tiempo transcurrido en milisegundos.
+*/
+double elapsed_ms(struct timespec start, struct timespec end){
+    return (double)(end.tv_sec - start.tv_sec) * 1e3 + (double)(end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+/*
+    @brief Función que calcula el rendimiento en millones de operaciones por segundo.
+
+    @param size_t ops: Número de operaciones.
+    @param double ms: Tiempo empleado en milisegundos.
+
+    @retval double: Millones de operaciones por segundo.
+*/
+double mops(size_t ops, double ms){
+    return (ms > 0) ? ops / (ms * 1e3) : 0;
+}
+
+/*
+    @brief Función de vencimiento que cuenta los temporizadores vencidos.
+
+    @param void * ctx: Contexto del temporizador (no usado).
+    @param uint64_t expires: Tick de vencimiento (no usado).
+    @param void * user: Referencia al contador (size_t).
+
+    @retval None.
+*/
+void count_expired(void * ctx, uint64_t expires, void * user){
+    (*(size_t *)user)++;
+}
+
+/*
+    @brief Función de comparación de temporizadores por tick de vencimiento (antes vence, antes sale).
+
+    @param const void * a: Referencia al primer temporizador.
+    @param const void * b: Referencia al segundo temporizador.
+    @param void * ctx: Contexto de usuario (no usado).
+
+    @retval int: <0, 0 o >0 si a vence antes, a la vez o después que b.
+*/
+int cmp_timer(const void * a, const void * b, void * ctx){
+    uint64_t x = ((const struct bench_timer *)a)->expires;
+    uint64_t y = ((const struct bench_timer *)b)->expires;
+    return (x > y) - (x < y);
+}
+
+/*
+    @brief Función que indica si un temporizador de la lista vence después del objetivo (posición de inserción ordenada).
+
+    @param const void * target: Referencia al temporizador a insertar.
+    @param const void * data: Referencia al temporizador de la lista.
+    @param void * ctx: Contexto de usuario (no usado).
+
+    @retval bool: true si el temporizador de la lista vence después.
+*/
+bool is_after(const void * target, const void * data, void * ctx){
+    return ((const struct bench_timer *)data)->expires > ((const struct bench_timer *)target)->expires;
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#!/bin/bash
+
+
+# Variables de entorno             #
+# -------------------------------- #
+CC=gcc
+CFLAGS_TEST="-g -Wall -O2"
+CFLAGS_LIB="-Wall -O2 -fPIC -shared"
+CFLAGS_BENCH="-Wall -O2 -march=native"
+
+SRC_TWHEEL="twheel.c ../llist/csllist.c ../array/array.c"
+SRC_TEST=test_twheel.c
+SRC_BENCH="bench_twheel.c ../pqueue/pqueue.c ../llist/dllist.c"
+
+TEST_PROG=test_twheel.elf
+BENCH_PROG=bench_twheel.elf
+LIB_PROG=twheel.so
+# -------------------------------- #
+
+
+# Lógica de uso                    #
+# -------------------------------- #
+if [ "$1" == "test" ]; then
+    echo
+    echo "[BUILD-TWHEEL-TEST]: Compilando programa de prueba de twheel..."
+    if $CC $CFLAGS_TEST $SRC_TEST $SRC_TWHEEL -o $TEST_PROG; then
+        echo "[BUILD-TWHEEL-TEST]: Compilación completada."
+        echo "[BUILD-TWHEEL-TEST]: Ejecutando programa de prueba..."
+        echo
+        ./$TEST_PROG
+        echo
+        echo "[BUILD-TWHEEL-TEST]: Ejecución de programa de prueba finalizado."
+    else
+        echo "[BUILD-TWHEEL-TEST][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$1" == "bench" ]; then
+    echo
+    echo "[BUILD-TWHEEL-BENCH]: Compilando benchmark de twheel..."
+    if $CC $CFLAGS_BENCH $SRC_BENCH $SRC_TWHEEL -o $BENCH_PROG; then
+        echo "[BUILD-TWHEEL-BENCH]: Compilación completada."
+        echo "[BUILD-TWHEEL-BENCH]: Ejecutando benchmark..."
+        echo
+        ./$BENCH_PROG "${@:2}"
+        echo
+        echo "[BUILD-TWHEEL-BENCH]: Ejecución de benchmark finalizada."
+    else
+        echo "[BUILD-TWHEEL-BENCH][ERR]: Error de compilación, ejecución abortada."
+    fi
+    echo
+
+elif [ "$1" == "lib" ]; then
+    echo
+    echo "[BUILD-TWHEEL-LIB]: Compilando la librería de twheel..."
+    if $CC $CFLAGS_LIB $SRC_TWHEEL -o $LIB_PROG; then
+        mv $LIB_PROG ./lib
+        echo "[BUILD-TWHEEL-LIB]: Librearía compilada."
+    else
+        echo "[BUILD-TWHEEL-LIB][ERR]: Error de compilación, librería no generada."
+    fi
+    echo
+
+elif [ "$1" == "clean" ]; then
+    echo
+    echo "[BUILD-TWHEEL-CLEAN]: Limpiando espacio de trabajo..."
+    rm -f ./$TEST_PROG ./$BENCH_PROG ./lib/$LIB_PROG
+    echo "[BUILD-TWHEEL-CLEAN]: Espacio de trabajo limpio."
+    echo
+
+else
+    echo
+    echo "[BUILD-TWHEEL][ERR]: Uso incorrecto u opciones inválidas."
+    echo -e "\n\t[Uso]:"
+    echo -e "\t\t-> ./build.sh test: \tCompila y ejecuta el programa de test (.elf)"
+    echo -e "\t\t-> ./build.sh bench [n] [alcance]: \tCompila y ejecuta el benchmark frente a pqueue y dllist ordenada (.elf)"
+    echo -e "\t\t-> ./build.sh lib: \tCompila y genera la librería compartida (.so) bajo la carpeta lib/"
+    echo -e "\t\t-> ./build.sh clean: \tLimpia el espacio de trabajo eliminando archivos generados"
+    echo
+    exit 1
+fi
+# -------------------------------- #
\ No newline at end of file
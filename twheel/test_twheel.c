@@ -0,0 +1,122 @@
+#include "twheel.h"
+#include <stdio.h>
+
+struct test_check{
+    twheel_pt wheel;            // Rueda comprobada.
+    size_t fired;               // Temporizadores vencidos.
+    size_t late;                // Temporizadores vencidos fuera de su tick.
+    size_t rescheduled;         // Temporizadores reprogramados desde la función de vencimiento.
+};
+
+// Prototipos de funciones:
+void print_expired(void * ctx, uint64_t expires, void * user);
+void check_expired(void * ctx, uint64_t expires, void * user);
+void reschedule_expired(void * ctx, uint64_t expires, void * user);
+
+// Función main:
+int main(int argc, char ** argv){
+
+    // Creación de la rueda (4 niveles de 256 cubetas):
+    twheel_pt wheel = twheel_init(0);
+    printf("\nSe ha creado la rueda correctamente en la dirección (%p)\n", (void *)wheel);
+
+    // Temporizadores en distintos niveles (el último más allá del alcance de la rueda):
+    uint64_t delays[] = {3, 1, 300, 70000, 20000000, (UINT64_C(1) << 33) + 5};
+    twheel_handle_t handles[6];
+    for (size_t i = 0; i < 6; i++){
+        twheel_schedule(wheel, delays[i], (void *)(uintptr_t)i, &handles[i]);
+    }
+    printf("Programados: %ld, tick actual: %lu\n", twheel_pending(wheel), twheel_now(wheel));
+
+    // Cancelación por manejador (una segunda cancelación no tiene efecto):
+    printf("Cancelación del temporizador 2: %u\n", twheel_cancel(wheel, handles[2]));
+    printf("Segunda cancelación del temporizador 2: %u\n", twheel_cancel(wheel, handles[2]));
+    printf("Pendientes: %ld, temporizador 3 pendiente: %d\n", twheel_pending(wheel), twheel_is_pending(wheel, handles[3]));
+
+    // Avance con vencimientos por lotes (con cascada entre niveles):
+    struct test_check check = {.wheel = wheel};
+    printf("\nAvance de 100000 ticks:\n");
+    size_t expired = twheel_advance(wheel, 100000, print_expired, &check);
+    printf("Vencidos: %ld, pendientes: %ld, tick actual: %lu\n", expired, twheel_pending(wheel), twheel_now(wheel));
+    printf("Cancelación de un temporizador ya vencido: %u\n", twheel_cancel(wheel, handles[0]));
+
+    printf("\nAvance hasta el tick 20000000:\n");
+    expired = twheel_advance(wheel, 20000000 - twheel_now(wheel), print_expired, &check);
+    printf("Vencidos: %ld, pendientes: %ld\n", expired, twheel_pending(wheel));
+    twheel_deinit(&wheel);
+
+    // Comprobación masiva: vencimientos pseudoaleatorios con un tercio cancelados:
+    size_t n = 200000;
+    uint64_t span = UINT64_C(1) << 20;
+    wheel = twheel_init(12345);
+    check = (struct test_check){.wheel = wheel};
+    twheel_handle_t * many = (twheel_handle_t *)malloc(n * sizeof(twheel_handle_t));
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < n; i++){
+        seed = seed * 1103515245 + 12345;
+        twheel_schedule(wheel, 1 + seed % (span - 1), NULL, &many[i]);
+    }
+    size_t cancelled = 0;
+    for (size_t i = 0; i < n; i += 3){
+        cancelled += (twheel_cancel(wheel, many[i]) == 0);
+    }
+    expired = twheel_advance(wheel, span, check_expired, &check);
+    printf("\nProgramados: %ld, cancelados: %ld, vencidos: %ld, fuera de su tick: %ld, pendientes: %ld\n",
+           n, cancelled, expired, check.late, twheel_pending(wheel));
+    free(many);
+
+    // Reprogramación desde la función de vencimiento (temporizador periódico):
+    check = (struct test_check){.wheel = wheel};
+    twheel_schedule(wheel, 10, NULL, NULL);
+    expired = twheel_advance(wheel, 1000, reschedule_expired, &check);
+    printf("Temporizador periódico (cada 10 ticks) durante 1000 ticks: %ld vencimientos, %ld fuera de su tick\n", expired, check.late);
+    twheel_deinit(&wheel);
+    printf("Dirección de la rueda tras destruirla: (%p)\n", (void *)wheel);
+
+    return 0;
+}
+
+/*
+    @brief Función de vencimiento que muestra el temporizador vencido.
+
+    @param void * ctx: Contexto del temporizador (su índice).
+    @param uint64_t expires: Tick de vencimiento.
+    @param void * user: Comprobación en curso.
+
+    @retval None.
+*/
+void print_expired(void * ctx, uint64_t expires, void * user){
+    struct test_check * check = (struct test_check *)user;
+    printf("\t-> Temporizador %lu: vence en el tick %lu (tick actual %lu)\n", (uintptr_t)ctx, expires, twheel_now(check->wheel));
+}
+
+/*
+    @brief Función de vencimiento que cuenta los temporizadores que vencen fuera de su tick.
+
+    @param void * ctx: Contexto del temporizador (no usado).
+    @param uint64_t expires: Tick de vencimiento.
+    @param void * user: Comprobación en curso.
+
+    @retval None.
+*/
+void check_expired(void * ctx, uint64_t expires, void * user){
+    struct test_check * check = (struct test_check *)user;
+    check->fired++;
+    check->late += (expires != twheel_now(check->wheel));
+}
+
+/*
+    @brief Función de vencimiento que reprograma el temporizador 10 ticks más tarde.
+
+    @param void * ctx: Contexto del temporizador (no usado).
+    @param uint64_t expires: Tick de vencimiento.
+    @param void * user: Comprobación en curso.
+
+    @retval None.
+*/
+void reschedule_expired(void * ctx, uint64_t expires, void * user){
+    struct test_check * check = (struct test_check *)user;
+    check_expired(ctx, expires, user);
+    twheel_schedule(check->wheel, 10, NULL, NULL);
+    check->rescheduled++;
+}
\ No newline at end of file
@@ -0,0 +1,430 @@
+#include "twheel.h"
+
+
+/* --- Prototipos de funciones internas --------------------------- */
+/* ---------------------------------------------------------------- */
+static csll_node_pt _twheel_node_get(twheel_pt wheel);
+static void _twheel_node_put(twheel_pt wheel, csll_node_pt node);
+static void _twheel_add(twheel_pt wheel, csll_node_pt node);
+static void _twheel_bucket_push(csll_linkedlist_pt bucket, csll_node_pt node);
+static csll_node_pt _twheel_bucket_take(csll_linkedlist_pt bucket);
+static void _twheel_cascade(twheel_pt wheel, size_t level, size_t slot);
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones ---------------------------- */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función para crear e inicializar una rueda de temporizadores jerárquica.
+    @note: Cada nivel tiene TWHEEL_SLOTS cubetas (listas circulares simplemente enlazadas); una cubeta del nivel n
+           abarca TWHEEL_SLOTS^n ticks y sus temporizadores bajan (cascada) al nivel inferior al llegar su turno.
+    @note: Los temporizadores a más de TWHEEL_MAX_SPAN ticks se colocan en el último nivel y se recolocan al visitarlo.
+
+    @param uint64_t start_tick: Tick actual en el momento de crear la rueda.
+
+    @retval twheel_pt: Referencia a la rueda creada (NULL si no hay memoria).
+*/
+twheel_pt twheel_init(uint64_t start_tick){
+    // Reserva de memoria de la estructura:
+    twheel_pt wheel = (twheel_pt)malloc(sizeof(twheel_t));
+    if (wheel == NULL){
+        return NULL;
+    }
+
+    wheel->chunks = array_init(sizeof(void *));
+    if (wheel->chunks == NULL){
+        free(wheel);
+        return NULL;
+    }
+
+    // Inicio de las cubetas (listas vacías de temporizadores):
+    for (size_t i = 0; i < TWHEEL_LEVELS; i++){
+        for (size_t j = 0; j < TWHEEL_SLOTS; j++){
+            wheel->buckets[i][j].head = NULL;
+            wheel->buckets[i][j].tail = NULL;
+            wheel->buckets[i][j].data_size = sizeof(twheel_timer_t);
+            wheel->buckets[i][j].size = 0;
+            wheel->buckets[i][j].cursor = NULL;
+            wheel->buckets[i][j].credit = 0;
+        }
+    }
+
+    // Inicio del resto de miembros de la estructura:
+    wheel->next_tick = start_tick + 1;
+    wheel->next_id = 1;
+    wheel->pending = 0;
+    wheel->free_nodes = NULL;
+
+    return wheel;
+}
+
+/*
+    @brief Función para destruir una rueda, descartando los temporizadores pendientes.
+    @note: Los manejadores de la rueda dejan de ser válidos.
+
+    @param twheel_pt * wheel: Referencia a la referencia de la rueda.
+
+    @retval None.
+*/
+void twheel_deinit(twheel_pt * wheel){
+    // Comprobación de rueda válida:
+    if ((wheel == NULL) || (*wheel == NULL)){
+        return;
+    }
+
+    // Liberación de los bloques de nodos (contienen todos los temporizadores, programados o libres):
+    void * chunk;
+    for (size_t i = 0; i < array_size((*wheel)->chunks); i++){
+        array_get((*wheel)->chunks, i, &chunk);
+        free(chunk);
+    }
+    array_deinit((*wheel)->chunks);
+
+    free(*wheel);
+    *wheel = NULL;
+}
+
+/*
+    @brief Función para programar un temporizador que vence tras un número de ticks. Coste O(1).
+    @note: El temporizador vence en el avance que alcance el tick twheel_now() + delay (con delay 0, en el siguiente avance).
+
+    @param twheel_pt wheel: Referencia a la rueda.
+    @param uint64_t delay: Ticks hasta el vencimiento.
+    @param void * ctx: Contexto de usuario que se entrega a la función de vencimiento.
+    @param twheel_handle_pt out_handle: Referencia donde guardar el manejador para cancelar (puede ser nula).
+
+    @retval uint8_t: Código de error.
+                    -> 0: Temporizador programado.
+                    -> 1: Rueda no válida.
+                    -> 2: No hay memoria para el temporizador.
+*/
+uint8_t twheel_schedule(twheel_pt wheel, uint64_t delay, void * ctx, twheel_handle_pt out_handle){
+    // Comprobación de rueda válida:
+    if (wheel == NULL){
+        return 1;
+    }
+
+    // Obtención de un nodo (libre o de un bloque nuevo):
+    csll_node_pt node = _twheel_node_get(wheel);
+    if (node == NULL){
+        return 2;
+    }
+
+    // Inicio del temporizador (sin desbordar el tick de vencimiento):
+    uint64_t now = wheel->next_tick - 1;
+    twheel_timer_pt timer = (twheel_timer_pt)node->data;
+    timer->expires = (delay > UINT64_MAX - now) ? UINT64_MAX : now + delay;
+    timer->id = wheel->next_id++;
+    timer->ctx = ctx;
+    timer->cancelled = false;
+
+    // Colocación en la cubeta que le corresponde:
+    _twheel_add(wheel, node);
+    wheel->pending++;
+
+    if (out_handle != NULL){
+        out_handle->timer = timer;
+        out_handle->id = timer->id;
+    }
+
+    return 0;
+}
+
+/*
+    @brief Función para cancelar un temporizador programado. Coste O(1).
+    @note: El temporizador se marca como cancelado y su nodo se recupera al visitar su cubeta (vencimiento o cascada),
+           sin recorrer la lista circular para desenlazarlo.
+    @note: Un manejador de un temporizador vencido o cancelado no afecta a temporizadores posteriores que reutilicen su nodo.
+
+    @param twheel_pt wheel: Referencia a la rueda.
+    @param twheel_handle_t handle: Manejador obtenido al programar el temporizador.
+
+    @retval uint8_t: Código de error.
+                    -> 0: Temporizador cancelado.
+                    -> 1: Rueda o manejador no válidos.
+                    -> 2: El temporizador ya venció o se canceló.
+*/
+uint8_t twheel_cancel(twheel_pt wheel, twheel_handle_t handle){
+    // Comprobación de rueda y manejador válidos:
+    if ((wheel == NULL) || (handle.timer == NULL) || (handle.id == 0)){
+        return 1;
+    }
+
+    // Comprobación de que el temporizador sigue programado:
+    if (!twheel_is_pending(wheel, handle)){
+        return 2;
+    }
+
+    handle.timer->cancelled = true;
+    wheel->pending--;
+
+    return 0;
+}
+
+/*
+    @brief Función que indica si el temporizador de un manejador sigue programado (ni vencido ni cancelado).
+
+    @param const twheel_pt wheel: Referencia a la rueda.
+    @param twheel_handle_t handle: Manejador obtenido al programar el temporizador.
+
+    @retval bool: true si el temporizador sigue programado.
+*/
+bool twheel_is_pending(const twheel_pt wheel, twheel_handle_t handle){
+    // Comprobación de rueda y manejador válidos:
+    if ((wheel == NULL) || (handle.timer == NULL) || (handle.id == 0)){
+        return false;
+    }
+
+    return (handle.timer->id == handle.id) && !handle.timer->cancelled;
+}
+
+/*
+    @brief Función para avanzar la rueda un número de ticks, ejecutando la función de vencimiento de cada temporizador vencido.
+    @note: En cada tick se bajan de nivel las cubetas que llegan a su turno y se vacía de una vez (por lotes) la cubeta
+           del nivel 0; la función de vencimiento puede programar o cancelar temporizadores.
+    @note: El coste es O(ticks + temporizadores vencidos + temporizadores recolocados).
+
+    @param twheel_pt wheel: Referencia a la rueda.
+    @param uint64_t ticks: Ticks que avanzar.
+    @param void (*expire_fn)(void *, uint64_t, void *): Función de vencimiento (contexto del temporizador, tick de vencimiento, contexto de usuario).
+    @param void * user: Contexto de usuario de la función de vencimiento.
+
+    @retval size_t: Número de temporizadores vencidos (0 si la rueda o la función no son válidas).
+*/
+size_t twheel_advance(twheel_pt wheel, uint64_t ticks, void (*expire_fn)(void *, uint64_t, void *), void * user){
+    // Comprobación de rueda y función válidas:
+    if ((wheel == NULL) || (expire_fn == NULL)){
+        return 0;
+    }
+
+    size_t expired = 0;
+    for (uint64_t i = 0; i < ticks; i++){
+        uint64_t tick = wheel->next_tick;
+        size_t slot = tick & TWHEEL_SLOT_MASK;
+
+        // Cascada de los niveles superiores al completar una vuelta del inferior:
+        for (size_t level = 1; (level < TWHEEL_LEVELS) && (((tick >> ((level - 1) * TWHEEL_SLOT_BITS)) & TWHEEL_SLOT_MASK) == 0); level++){
+            _twheel_cascade(wheel, level, (tick >> (level * TWHEEL_SLOT_BITS)) & TWHEEL_SLOT_MASK);
+        }
+
+        // Extracción de la cubeta del tick antes de avanzar (lo programado durante el vencimiento va a ticks posteriores):
+        csll_node_pt temp_node = _twheel_bucket_take(&wheel->buckets[0][slot]);
+        wheel->next_tick++;
+
+        while (temp_node != NULL){
+            csll_node_pt temp_next_node = temp_node->next;
+            twheel_timer_pt timer = (twheel_timer_pt)temp_node->data;
+
+            if (timer->cancelled){
+                _twheel_node_put(wheel, temp_node);
+            } else if (timer->expires > tick){
+                // Temporizador más allá del alcance de la rueda (recolocado en el último nivel):
+                _twheel_add(wheel, temp_node);
+            } else {
+                // Vencimiento (el nodo se libera antes de la llamada para que el manejador deje de ser válido):
+                void * ctx = timer->ctx;
+                uint64_t expires = timer->expires;
+                _twheel_node_put(wheel, temp_node);
+                wheel->pending--;
+                expired++;
+                expire_fn(ctx, expires, user);
+            }
+
+            temp_node = temp_next_node;
+        }
+    }
+
+    return expired;
+}
+
+/*
+    @brief Función que retorna el tick actual de la rueda (último tick procesado).
+
+    @param const twheel_pt wheel: Referencia a la rueda.
+
+    @retval uint64_t: Tick actual (0 si la rueda no es válida).
+*/
+uint64_t twheel_now(const twheel_pt wheel){
+    // Comprobación de rueda válida:
+    if (wheel == NULL){
+        return 0;
+    }
+
+    return wheel->next_tick - 1;
+}
+
+/*
+    @brief Función que retorna el número de temporizadores programados (sin contar vencidos ni cancelados).
+
+    @param const twheel_pt wheel: Referencia a la rueda.
+
+    @retval size_t: Número de temporizadores pendientes (0 si la rueda no es válida).
+*/
+size_t twheel_pending(const twheel_pt wheel){
+    // Comprobación de rueda válida:
+    if (wheel == NULL){
+        return 0;
+    }
+
+    return wheel->pending;
+}
+/* ---------------------------------------------------------------- */
+
+
+
+/* --- Implementación de las funciones estáticas ------------------ */
+/* ---------------------------------------------------------------- */
+/*
+    @brief Función interna que obtiene un nodo libre, reservando un bloque de TWHEEL_CHUNK_TIMERS nodos si no quedan.
+    @note: Nodo y temporizador comparten reserva (el temporizador va a continuación del nodo).
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param twheel_pt wheel: Referencia a la rueda.
+
+    @retval csll_node_pt: Nodo obtenido (NULL si no hay memoria).
+*/
+static csll_node_pt _twheel_node_get(twheel_pt wheel){
+    if (wheel->free_nodes == NULL){
+        // Reserva de un bloque nuevo y registro para liberarlo al destruir la rueda:
+        size_t node_size = sizeof(csll_node_t) + sizeof(twheel_timer_t);
+        uint8_t * chunk = (uint8_t *)malloc(TWHEEL_CHUNK_TIMERS * node_size);
+        if (chunk == NULL){
+            return NULL;
+        }
+
+        array_pt chunks = wheel->chunks;
+        if ((chunks->size == chunks->capacity) && (array_reserve(chunks, 2 * chunks->capacity + ALLOC_BLOCK_SIZE) != 0)){
+            free(chunk);
+            return NULL;
+        }
+        array_set(chunks, &chunk, chunks->size);
+
+        // Encadenado de los nodos del bloque en la lista de libres:
+        for (size_t i = TWHEEL_CHUNK_TIMERS; i > 0; i--){
+            csll_node_pt node = (csll_node_pt)(chunk + (i - 1) * node_size);
+            node->data = (uint8_t *)node + sizeof(csll_node_t);
+            ((twheel_timer_pt)node->data)->id = 0;
+            node->next = wheel->free_nodes;
+            wheel->free_nodes = node;
+        }
+    }
+
+    csll_node_pt node = wheel->free_nodes;
+    wheel->free_nodes = node->next;
+    node->next = NULL;
+
+    return node;
+}
+
+/*
+    @brief Función interna que devuelve un nodo a la lista de libres, invalidando los manejadores de su temporizador.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param twheel_pt wheel: Referencia a la rueda.
+    @param csll_node_pt node: Nodo a liberar.
+
+    @retval None.
+*/
+static void _twheel_node_put(twheel_pt wheel, csll_node_pt node){
+    ((twheel_timer_pt)node->data)->id = 0;
+    node->next = wheel->free_nodes;
+    wheel->free_nodes = node;
+}
+
+/*
+    @brief Función interna que coloca un temporizador en la cubeta que le corresponde según su distancia al siguiente tick.
+    @note: Con distancia menor que TWHEEL_SLOTS^(n+1) va al nivel n, en la cubeta dada por los bits de ese nivel del vencimiento;
+           los vencidos van a la cubeta del siguiente tick y los que exceden TWHEEL_MAX_SPAN se colocan a esa distancia.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param twheel_pt wheel: Referencia a la rueda.
+    @param csll_node_pt node: Nodo del temporizador.
+
+    @retval None.
+*/
+static void _twheel_add(twheel_pt wheel, csll_node_pt node){
+    uint64_t expires = ((twheel_timer_pt)node->data)->expires;
+    uint64_t delta = (expires > wheel->next_tick) ? expires - wheel->next_tick : 0;
+    if (delta > TWHEEL_MAX_SPAN){
+        delta = TWHEEL_MAX_SPAN;
+    }
+    uint64_t position = wheel->next_tick + delta;
+
+    // Nivel: el menor cuyo alcance cubre la distancia:
+    size_t level = 0;
+    while ((level < TWHEEL_LEVELS - 1) && (delta >= (UINT64_C(1) << ((level + 1) * TWHEEL_SLOT_BITS)))){
+        level++;
+    }
+
+    _twheel_bucket_push(&wheel->buckets[level][(position >> (level * TWHEEL_SLOT_BITS)) & TWHEEL_SLOT_MASK], node);
+}
+
+/*
+    @brief Función interna que añade un nodo al final de una cubeta, manteniendo la lista circular.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param csll_linkedlist_pt bucket: Referencia a la cubeta.
+    @param csll_node_pt node: Nodo a añadir.
+
+    @retval None.
+*/
+static void _twheel_bucket_push(csll_linkedlist_pt bucket, csll_node_pt node){
+    if (csllist_is_empty(bucket)){
+        bucket->head = node;
+    } else {
+        bucket->tail->next = node;
+    }
+    node->next = bucket->head;
+    bucket->tail = node;
+    bucket->size++;
+}
+
+/*
+    @brief Función interna que vacía una cubeta de una vez, retornando sus nodos como cadena abierta.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param csll_linkedlist_pt bucket: Referencia a la cubeta.
+
+    @retval csll_node_pt: Primer nodo de la cadena (NULL si la cubeta estaba vacía).
+*/
+static csll_node_pt _twheel_bucket_take(csll_linkedlist_pt bucket){
+    if (csllist_is_empty(bucket)){
+        return NULL;
+    }
+
+    // Corte de la lista circular por el final:
+    csll_node_pt head = bucket->head;
+    bucket->tail->next = NULL;
+    bucket->head = NULL;
+    bucket->tail = NULL;
+    bucket->size = 0;
+
+    return head;
+}
+
+/*
+    @brief Función interna que baja de nivel los temporizadores de una cubeta, descartando los cancelados.
+    @note: Al ser una función de uso interno, se obvian comprobaciones como punteros nulos. (Se suponen presentes en funciones públicas)
+
+    @param twheel_pt wheel: Referencia a la rueda.
+    @param size_t level: Nivel de la cubeta.
+    @param size_t slot: Índice de la cubeta en su nivel.
+
+    @retval None.
+*/
+static void _twheel_cascade(twheel_pt wheel, size_t level, size_t slot){
+    csll_node_pt temp_node = _twheel_bucket_take(&wheel->buckets[level][slot]);
+    while (temp_node != NULL){
+        csll_node_pt temp_next_node = temp_node->next;
+
+        if (((twheel_timer_pt)temp_node->data)->cancelled){
+            _twheel_node_put(wheel, temp_node);
+        } else {
+            _twheel_add(wheel, temp_node);
+        }
+
+        temp_node = temp_next_node;
+    }
+}
+/* ---------------------------------------------------------------- */
\ No newline at end of file
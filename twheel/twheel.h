@@ -0,0 +1,85 @@
+#ifndef TWHEEL_HEADER
+#define TWHEEL_HEADER
+
+
+/* --- Librerías -------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "../array/array.h"
+#include "../llist/csllist.h"
+/* ---------------------------------------------------------------- */
+
+
+/* --- Constantes ------------------------------------------------- */
+/* ---------------------------------------------------------------- */
+#define TWHEEL_LEVELS 4                 // Niveles de la rueda (cada nivel abarca TWHEEL_SLOTS veces el anterior).
+#define TWHEEL_SLOT_BITS 8              // log2 del número de cubetas por nivel.
+#define TWHEEL_SLOTS (1 << TWHEEL_SLOT_BITS)    // Cubetas por nivel.
+#define TWHEEL_SLOT_MASK (TWHEEL_SLOTS - 1)     // Máscara del índice de cubeta.
+#define TWHEEL_MAX_SPAN ((UINT64_C(1) << (TWHEEL_LEVELS * TWHEEL_SLOT_BITS)) - 1)  // Máximo de ticks que abarca la rueda.
+#define TWHEEL_CHUNK_TIMERS 4096        // Temporizadores reservados de una vez al agotar los libres.
+/* ---------------------------------------------------------------- */
+
+
+/* --- Estructuras de datos --------------------------------------- */
+/* ---------------------------------------------------------------- */
+struct twheel_timer{
+    uint64_t expires;               // Tick de vencimiento.
+    uint64_t id;                    // Identificador del temporizador (0 si está libre).
+    void * ctx;                     // Contexto de usuario entregado al vencer.
+    bool cancelled;                 // Indica si se ha cancelado (se descarta al visitar su cubeta).
+};
+
+struct twheel_handle{
+    struct twheel_timer * timer;    // Temporizador referenciado.
+    uint64_t id;                    // Identificador del temporizador al programarlo.
+};
+
+struct twheel{
+    csll_linkedlist_t buckets[TWHEEL_LEVELS][TWHEEL_SLOTS];    // Cubetas de cada nivel (listas circulares de temporizadores).
+    uint64_t next_tick;             // Siguiente tick por procesar.
+    uint64_t next_id;               // Siguiente identificador de temporizador.
+    size_t pending;                 // Temporizadores programados y no cancelados.
+    csll_node_pt free_nodes;        // Nodos libres para reutilizar (enlazados por next).
+    array_pt chunks;                // Bloques de nodos reservados (void *).
+};
+/* ---------------------------------------------------------------- */
+
+
+/* --- Tipos de datos --------------------------------------------- */
+/* ---------------------------------------------------------------- */
+typedef struct twheel_timer twheel_timer_t;
+typedef twheel_timer_t * twheel_timer_pt;
+
+typedef struct twheel_handle twheel_handle_t;
+typedef twheel_handle_t * twheel_handle_pt;
+
+typedef struct twheel twheel_t;
+typedef twheel_t * twheel_pt;
+/* ---------------------------------------------------------------- */
+
+
+/* --- Prototipos de funciones ------------------------------------ */
+/* ---------------------------------------------------------------- */
+// Creación y destrucción de la rueda:
+twheel_pt twheel_init(uint64_t start_tick);
+void twheel_deinit(twheel_pt * wheel);
+
+// Programación y cancelación de temporizadores:
+uint8_t twheel_schedule(twheel_pt wheel, uint64_t delay, void * ctx, twheel_handle_pt out_handle);
+uint8_t twheel_cancel(twheel_pt wheel, twheel_handle_t handle);
+bool twheel_is_pending(const twheel_pt wheel, twheel_handle_t handle);
+
+// Avance del tiempo:
+size_t twheel_advance(twheel_pt wheel, uint64_t ticks, void (*expire_fn)(void *, uint64_t, void *), void * user);
+
+// Utilidades generales:
+uint64_t twheel_now(const twheel_pt wheel);
+size_t twheel_pending(const twheel_pt wheel);
+/* ---------------------------------------------------------------- */
+
+#endif
\ No newline at end of file